@@ -19,6 +19,7 @@
 **/
 
 #include "src/FileBlockChainStorage.h"
+#include "src/StateCheckpointService.h"
 #include "catapult/extensions/LocalNodeBootstrapper.h"
 
 namespace catapult { namespace filechain {
@@ -27,6 +28,9 @@ namespace catapult { namespace filechain {
 		void RegisterExtension(extensions::LocalNodeBootstrapper& bootstrapper) {
 			// register storage
 			bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage());
+
+			// register service(s)
+			bootstrapper.extensionManager().addServiceRegistrar(CreateStateCheckpointServiceRegistrar());
 		}
 	}
 }}
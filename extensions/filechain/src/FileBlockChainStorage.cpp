@@ -43,7 +43,8 @@ namespace catapult { namespace filechain {
 				cache::SupplementalData supplementalData;
 				bool isStateLoaded = false;
 				try {
-					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData);
+					auto blockHashSupplier = [&storage = stateRef.Storage](auto height) { return GetBlockHash(storage, height); };
+					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData, blockHashSupplier);
 				} catch (...) {
 					CATAPULT_LOG(error) << "error when loading state, remove state directories and start again";
 					throw;
@@ -123,7 +124,10 @@ namespace catapult { namespace filechain {
 
 		public:
 			void saveToStorage(const extensions::LocalNodeStateConstRef& stateRef) override {
-				SaveState(stateRef.Config.User.DataDirectory, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
+				auto cacheView = stateRef.Cache.createView();
+				auto blockHash = GetBlockHash(stateRef.Storage, cacheView.height());
+				cache::SupplementalData supplementalData{ stateRef.State, stateRef.Score.get() };
+				SaveState(stateRef.Config.User.DataDirectory, stateRef.Cache, cacheView, supplementalData, blockHash);
 			}
 		};
 	}
@@ -23,8 +23,12 @@
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache/SupplementalDataStorage.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FileLock.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
@@ -34,11 +38,15 @@ namespace catapult { namespace filechain {
 	namespace {
 		constexpr size_t Default_Loader_Batch_Size = 100'000;
 		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
+		constexpr auto Block_Hash_Filename = "blockhash.dat";
 		constexpr auto State_Lock_Filename = "state.lock";
+		constexpr auto State_Directory_Name = "state";
+		constexpr auto Temp_State_Directory_Name = "state.tmp";
+		constexpr auto Old_State_Directory_Name = "state.old";
 
 		std::string GetStatePath(const std::string& baseDirectory, const std::string& filename) {
 			boost::filesystem::path path = baseDirectory;
-			path /= "state";
+			path /= State_Directory_Name;
 			if (!boost::filesystem::exists(path))
 				boost::filesystem::create_directory(path);
 
@@ -52,8 +60,8 @@ namespace catapult { namespace filechain {
 			cacheStorage.loadAll(file, Default_Loader_Batch_Size);
 		}
 
-		void SaveCache(const std::string& baseDirectory, const std::string& filename, const cache::CacheStorage& cacheStorage) {
-			auto path = GetStatePath(baseDirectory, filename);
+		void SaveCache(const boost::filesystem::path& directory, const std::string& filename, const cache::CacheStorage& cacheStorage) {
+			auto path = (directory / filename).generic_string();
 			io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write));
 			cacheStorage.saveAll(file);
 		}
@@ -63,12 +71,74 @@ namespace catapult { namespace filechain {
 			return boost::filesystem::exists(path);
 		}
 
+		bool HasMatchingBlockHash(const std::string& baseDirectory, Height chainHeight, const BlockHashSupplier& blockHashSupplier) {
+			auto path = GetStatePath(baseDirectory, Block_Hash_Filename);
+			if (!boost::filesystem::exists(path))
+				return false;
+
+			Hash256 savedBlockHash;
+			{
+				io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
+				file.read(savedBlockHash);
+			}
+
+			// the saved block hash can only be checked when the local chain contains a block at the saved height
+			auto blockHash = blockHashSupplier(chainHeight);
+			if (Hash256() == blockHash || savedBlockHash == blockHash)
+				return true;
+
+			CATAPULT_LOG(warning)
+					<< "saved block hash " << utils::HexFormat(savedBlockHash) << " does not match local block hash "
+					<< utils::HexFormat(blockHash) << " at height " << chainHeight;
+			return false;
+		}
+
+		class VectorOutputStream : public io::OutputStream {
+		public:
+			explicit VectorOutputStream(std::vector<uint8_t>& buffer) : m_buffer(buffer)
+			{}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override
+			{}
+
+		private:
+			std::vector<uint8_t>& m_buffer;
+		};
+
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		template<typename TStorage, typename TAction>
+		void ForEachStorageParallel(const std::vector<std::unique_ptr<TStorage>>& storages, TAction action) {
+			if (storages.empty())
+				return;
+
+			// subcaches are saved in separate files, so they can be processed in parallel
+			// (state is only saved and loaded occasionally, so a pool is only created for the duration of the operation)
+			auto pPool = thread::CreateIoServiceThreadPool(storages.size(), "state storage");
+			pPool->start();
+			thread::ParallelForEachAndWait(pPool->service(), storages, [action](const auto& pStorage, auto index) {
+				action(*pStorage, index);
+			});
+		}
+	}
+
+	Hash256 GetBlockHash(const io::BlockStorageCache& storage, Height height) {
+		auto hashes = storage.view().loadHashesFrom(height, 1);
+		return hashes.empty() ? Hash256() : *hashes.cbegin();
 	}
 
-	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData) {
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			const BlockHashSupplier& blockHashSupplier) {
 		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
 		io::FileLock stateLock(lockFilePath);
 		if (!stateLock.try_lock()) {
@@ -81,9 +151,6 @@ namespace catapult { namespace filechain {
 
 		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
 
-		for (const auto& pStorage : cache.storages())
-			LoadCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
-
 		Height chainHeight;
 		{
 			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
@@ -91,46 +158,145 @@ namespace catapult { namespace filechain {
 			cache::LoadSupplementalData(file, supplementalData, chainHeight);
 		}
 
+		// a state that was saved before a rollback cannot be used because the local chain does not contain the saved blocks anymore
+		if (!HasMatchingBlockHash(dataDirectory, chainHeight, blockHashSupplier))
+			return false;
+
+		ForEachStorageParallel(cache.storages(), [&dataDirectory](auto& storage, auto) {
+			LoadCache(dataDirectory, GetStorageFilename(storage), storage);
+		});
+
 		auto cacheDelta = cache.createDelta();
 		cache.commit(chainHeight);
 		return true;
 	}
 
 	namespace {
-		bool TryRemoveLockFile(const std::string& lockFilePath) {
-			boost::system::error_code ignored_ec;
-			auto isLockFilePresent = boost::filesystem::exists(lockFilePath);
-			auto isLockFileRemoved = boost::filesystem::remove(lockFilePath, ignored_ec);
-			CATAPULT_LOG(debug)
-					<< "saving state with lock file " << lockFilePath
-					<< " (exists = " << isLockFilePresent << ", removed = " << isLockFileRemoved << ")";
-			return !boost::filesystem::exists(lockFilePath);
+		void SyncFile(const boost::filesystem::path& path) {
+			io::RawFile(path.generic_string(), io::OpenMode::Read_Append, io::LockMode::None).flush();
 		}
-	}
 
-	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData) {
-		// 1. if the previous SaveState crashed, an orphaned lock file will be present, which would have caused LoadState to be bypassed
-		//    and instead triggered a rebuild of the cache by reloading all blocks
-		// 2. in the current SaveState, delete any existing lock file (state is not written incrementally) and create a new one
-		// 3. if successful, the lock file will be deleted and the next LoadState will load directly from the saved state
-		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
-		io::FileLock stateLock(lockFilePath);
-		if (TryRemoveLockFile(lockFilePath))
-			stateLock.lock();
-		else
-			CATAPULT_LOG(warning) << "lock file could not be removed and must be removed manually";
+		void SyncDirectory(const boost::filesystem::path& path) {
+#ifdef _MSC_VER
+			// directories cannot be opened as files on windows, where renames are persisted by the file system itself
+			static_cast<void>(path);
+#else
+			io::RawFile(path.generic_string(), io::OpenMode::Read_Only, io::LockMode::None).flush();
+#endif
+		}
 
-		for (const auto& pStorage : cache.storages())
-			SaveCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		void SyncDirectoryContents(const boost::filesystem::path& directory) {
+			for (boost::filesystem::directory_iterator iter(directory); boost::filesystem::directory_iterator() != iter; ++iter)
+				SyncFile(iter->path());
 
-		{
-			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
-			io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write));
+			SyncDirectory(directory);
+		}
+
+		template<typename TSaveFiles>
+		void SaveStateAtomically(const std::string& dataDirectory, TSaveFiles saveFiles) {
+			boost::filesystem::path basePath = dataDirectory;
+			auto stateDirectory = basePath / State_Directory_Name;
+			auto tempStateDirectory = basePath / Temp_State_Directory_Name;
+			auto oldStateDirectory = basePath / Old_State_Directory_Name;
+
+			// 1. save the new state into an empty temporary directory, so that the previous state is untouched until the new state
+			//    is complete (a leftover temporary directory from a crashed SaveState is discarded)
+			boost::filesystem::remove_all(tempStateDirectory);
+			boost::filesystem::create_directory(tempStateDirectory);
+			saveFiles(tempStateDirectory);
+
+			// 2. flush all files and the temporary directory to the storage device before renaming, so that a power loss after
+			//    the renames cannot leave a state directory containing empty or partially written files
+			SyncDirectoryContents(tempStateDirectory);
+
+			// 3. swap the state directories by renaming them; if this is interrupted, either the previous state, the new state
+			//    or no state is present, so LoadState never sees a partially written state and falls back to reloading all blocks
+			boost::filesystem::remove_all(oldStateDirectory);
+			if (boost::filesystem::exists(stateDirectory))
+				boost::filesystem::rename(stateDirectory, oldStateDirectory);
+
+			boost::filesystem::rename(tempStateDirectory, stateDirectory);
+			boost::filesystem::remove_all(oldStateDirectory);
 
+			// 4. flush the renames
+			SyncDirectory(basePath);
+		}
+	}
+
+	namespace {
+		void SaveSupplementalData(io::OutputStream& output, const cache::SupplementalData& supplementalData, Height chainHeight) {
 			cache::SupplementalData data;
 			data.State = supplementalData.State;
 			data.ChainScore = supplementalData.ChainScore;
-			cache::SaveSupplementalData(data, cache.createView().height(), file);
+			cache::SaveSupplementalData(data, chainHeight, output);
+		}
+
+		void SaveBuffer(const boost::filesystem::path& directory, const std::string& filename, const RawBuffer& buffer) {
+			auto path = (directory / filename).generic_string();
+			io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write));
+			file.write(buffer);
+			file.flush();
 		}
 	}
+
+	void SaveState(
+			const std::string& dataDirectory,
+			const cache::CatapultCache& cache,
+			const cache::CatapultCacheView& cacheView,
+			const cache::SupplementalData& supplementalData,
+			const Hash256& blockHash) {
+		// note: subcache storages acquire their own subcache views, which is safe because cacheView prevents any
+		// (pending) commits and is held until all subcaches are saved
+		utils::StackLogger stopwatch("save state", utils::LogLevel::Info);
+		SaveStateAtomically(dataDirectory, [&cache, &cacheView, &supplementalData, &blockHash](const auto& directory) {
+			ForEachStorageParallel(cache.storages(), [&directory](const auto& storage, auto) {
+				SaveCache(directory, GetStorageFilename(storage), storage);
+			});
+
+			{
+				auto path = (directory / Supplemental_Data_Filename).generic_string();
+				io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write));
+				SaveSupplementalData(file, supplementalData, cacheView.height());
+			}
+
+			SaveBuffer(directory, Block_Hash_Filename, blockHash);
+		});
+	}
+
+	StateSnapshot CreateStateSnapshot(
+			const cache::CatapultCache& cache,
+			const cache::CatapultCacheView& cacheView,
+			const cache::SupplementalData& supplementalData,
+			const Hash256& blockHash) {
+		// note: subcache storages acquire their own subcache views, which is safe because cacheView prevents any
+		// (pending) commits and is held until all subcaches are serialized
+		utils::StackLogger stopwatch("create state snapshot", utils::LogLevel::Info);
+
+		StateSnapshot snapshot;
+		snapshot.SerializedCaches.resize(cache.storages().size());
+		ForEachStorageParallel(cache.storages(), [&snapshot](const auto& storage, auto index) {
+			auto& serializedCache = snapshot.SerializedCaches[index];
+			serializedCache.first = GetStorageFilename(storage);
+
+			VectorOutputStream output(serializedCache.second);
+			storage.saveAll(output);
+		});
+
+		VectorOutputStream output(snapshot.SerializedSupplementalData);
+		SaveSupplementalData(output, supplementalData, cacheView.height());
+
+		snapshot.BlockHash = blockHash;
+		return snapshot;
+	}
+
+	void SaveState(const std::string& dataDirectory, const StateSnapshot& snapshot) {
+		utils::StackLogger stopwatch("save state snapshot", utils::LogLevel::Info);
+		SaveStateAtomically(dataDirectory, [&snapshot](const auto& directory) {
+			for (const auto& serializedCache : snapshot.SerializedCaches)
+				SaveBuffer(directory, serializedCache.first, serializedCache.second);
+
+			SaveBuffer(directory, Supplemental_Data_Filename, snapshot.SerializedSupplementalData);
+			SaveBuffer(directory, Block_Hash_Filename, snapshot.BlockHash);
+		});
+	}
 }}
@@ -19,21 +19,72 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
+#include "catapult/types.h"
 #include <string>
+#include <vector>
 
 namespace catapult {
 	namespace cache {
 		class CatapultCache;
+		class CatapultCacheView;
 		struct SupplementalData;
 	}
+	namespace io { class BlockStorageCache; }
 }
 
 namespace catapult { namespace filechain {
 
+	/// Supplies the hash of the block at a height in the local chain.
+	using BlockHashSupplier = std::function<Hash256 (Height)>;
+
+	/// Gets the hash of the block at \a height in \a storage or a zero hash if \a storage does not contain such a block.
+	Hash256 GetBlockHash(const io::BlockStorageCache& storage, Height height);
+
 	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory.
-	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData);
+	/// \a cacheView is a view of \a cache that determines the saved height and \a blockHash is the hash of the block at that height.
+	/// \note All subcaches are saved in parallel while \a cacheView prevents changes from being committed.
+	/// \note The state is saved into a temporary directory that replaces the previous state directory only when it is complete.
+	void SaveState(
+			const std::string& dataDirectory,
+			const cache::CatapultCache& cache,
+			const cache::CatapultCacheView& cacheView,
+			const cache::SupplementalData& supplementalData,
+			const Hash256& blockHash);
+
+	/// Serialized local node state at a single height.
+	struct StateSnapshot {
+		/// Serialized subcaches paired with the names of the files they are saved in.
+		std::vector<std::pair<std::string, std::vector<uint8_t>>> SerializedCaches;
+
+		/// Serialized supplemental data (including the chain height).
+		std::vector<uint8_t> SerializedSupplementalData;
+
+		/// Hash of the block at the chain height.
+		Hash256 BlockHash;
+	};
+
+	/// Creates a snapshot of catapult \a cache state along with \a supplementalData.
+	/// \a cacheView is a view of \a cache that determines the snapshot height and \a blockHash is the hash of the block at that height.
+	/// \note All subcaches are serialized in parallel while \a cacheView prevents changes from being committed.
+	StateSnapshot CreateStateSnapshot(
+			const cache::CatapultCache& cache,
+			const cache::CatapultCacheView& cacheView,
+			const cache::SupplementalData& supplementalData,
+			const Hash256& blockHash);
+
+	/// Save state \a snapshot into state directory inside \a dataDirectory.
+	/// \note The snapshot is detached from the cache, so no cache locks are held while it is saved.
+	void SaveState(const std::string& dataDirectory, const StateSnapshot& snapshot);
 
 	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory.
-	/// Returns \c true if data has been loaded, \c false if there was nothing to load.
-	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData);
+	/// Returns \c true if data has been loaded, \c false if there was nothing to load or if the saved block hash does not match
+	/// the hash returned by \a blockHashSupplier for the saved height (e.g. because the chain was rolled back after the state was saved).
+	/// \note The saved block hash is not checked when \a blockHashSupplier returns a zero hash.
+	/// \note All subcaches are loaded in parallel.
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			const BlockHashSupplier& blockHashSupplier);
 }}
@@ -0,0 +1,193 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StateCheckpointService.h"
+#include "LocalNodeStateStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/config/LocalNodeConfiguration.h"
+#include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/ServiceState.h"
+#include "catapult/thread/MultiServicePool.h"
+#include "catapult/utils/ExceptionLogging.h"
+#include "catapult/utils/SpinLock.h"
+#include <boost/asio.hpp>
+
+namespace catapult { namespace filechain {
+
+	namespace {
+		class StateCheckpointer : public std::enable_shared_from_this<StateCheckpointer> {
+		public:
+			StateCheckpointer(const extensions::ServiceState& state, const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+					: m_dataDirectory(state.config().User.DataDirectory)
+					, m_checkpointInterval(state.config().Node.StateCheckpointInterval)
+					, m_cache(state.cache())
+					, m_state(state.state())
+					, m_storage(state.storage())
+					, m_score(state.score())
+					, m_pPool(pPool)
+					, m_lastCheckpointHeight(state.cache().createView().height())
+					, m_isSaveScheduled(false)
+			{}
+
+		public:
+			void shutdown() {
+				utils::SpinLockGuard guard(m_lock);
+				m_pPool.reset();
+			}
+
+			void checkpointIfDue() {
+				if (isShutdown())
+					return;
+
+				std::unique_ptr<StateSnapshot> pSnapshot;
+				Height height;
+				{
+					// the cache view is only held while the snapshot is serialized in memory, so commits are not blocked while
+					// the snapshot is saved
+					// (the whole cache is serialized on the calling dispatcher thread, which stalls block processing until it completes)
+					auto cacheView = m_cache.createView();
+					height = cacheView.height();
+					if (!isCheckpointDue(height))
+						return;
+
+					m_lastCheckpointHeight = height;
+
+					// this is called after a commit, so state, score and storage are all consistent with the cache
+					cache::SupplementalData supplementalData{ m_state, m_score.get() };
+					auto blockHash = GetBlockHash(m_storage, height);
+					pSnapshot = std::make_unique<StateSnapshot>(CreateStateSnapshot(m_cache, cacheView, supplementalData, blockHash));
+				}
+
+				// at most one snapshot is pending, so a snapshot that has not been saved yet is replaced by a newer one
+				// (this bounds memory usage when checkpoints are due faster than they can be saved, e.g. during initial sync)
+				utils::SpinLockGuard guard(m_lock);
+				if (!m_pPool)
+					return;
+
+				m_pPendingSnapshot = std::move(pSnapshot);
+				m_pendingSnapshotHeight = height;
+				if (m_isSaveScheduled)
+					return;
+
+				m_isSaveScheduled = true;
+				m_pPool->service().post([pThis = shared_from_this()]() {
+					pThis->savePendingSnapshots();
+				});
+			}
+
+		private:
+			bool isShutdown() {
+				utils::SpinLockGuard guard(m_lock);
+				return !m_pPool;
+			}
+
+			bool isCheckpointDue(Height height) const {
+				// also checkpoint after a rollback below the last checkpoint because that checkpoint cannot be loaded anymore
+				return height < m_lastCheckpointHeight
+						|| height.unwrap() - m_lastCheckpointHeight.unwrap() >= m_checkpointInterval;
+			}
+
+			void savePendingSnapshots() {
+				for (;;) {
+					std::unique_ptr<StateSnapshot> pSnapshot;
+					Height height;
+					{
+						utils::SpinLockGuard guard(m_lock);
+						if (!m_pPendingSnapshot) {
+							m_isSaveScheduled = false;
+							return;
+						}
+
+						pSnapshot = std::move(m_pPendingSnapshot);
+						height = m_pendingSnapshotHeight;
+					}
+
+					save(*pSnapshot, height);
+				}
+			}
+
+			void save(const StateSnapshot& snapshot, Height height) {
+				try {
+					SaveState(m_dataDirectory, snapshot);
+					CATAPULT_LOG(info) << "saved state checkpoint at height " << height;
+				} catch (...) {
+					CATAPULT_LOG(warning) << UNHANDLED_EXCEPTION_MESSAGE("saving state checkpoint");
+				}
+			}
+
+		private:
+			std::string m_dataDirectory;
+			uint32_t m_checkpointInterval;
+			const cache::CatapultCache& m_cache;
+			const state::CatapultState& m_state;
+			const io::BlockStorageCache& m_storage;
+			const extensions::LocalNodeChainScore& m_score;
+
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+			Height m_lastCheckpointHeight;
+			std::unique_ptr<StateSnapshot> m_pPendingSnapshot;
+			Height m_pendingSnapshotHeight;
+			bool m_isSaveScheduled;
+			utils::SpinLock m_lock;
+		};
+
+		class StateCheckpointServiceRegistrar : public extensions::ServiceRegistrar {
+		public:
+			extensions::ServiceRegistrarInfo info() const override {
+				// needs to be registered before DispatcherService (transactionsChangeHandler | Post_Remote_Peers)
+				return { "StateCheckpoint", extensions::ServiceRegistrarPhase::Initial };
+			}
+
+			void registerServiceCounters(extensions::ServiceLocator&) override {
+				// no additional counters
+			}
+
+			void registerServices(extensions::ServiceLocator&, extensions::ServiceState& state) override {
+				const auto& nodeConfig = state.config().Node;
+				if (0 == nodeConfig.StateCheckpointInterval)
+					return;
+
+				// cache database storage only supports loading state saved at the storage height
+				if (nodeConfig.ShouldUseCacheDatabaseStorage) {
+					CATAPULT_LOG(info) << "state checkpoints are disabled because cache database storage is enabled";
+					return;
+				}
+
+				// (the service group must be after the isolated pool in order to allow proper shutdown)
+				auto pCheckpointer = std::make_shared<StateCheckpointer>(state, state.pool().pushIsolatedPool("state checkpoint", 1));
+				state.pool().pushServiceGroup("state checkpoint")->registerService(pCheckpointer);
+
+				// transactions change handlers are called after all changes are committed
+				// (the checkpointer is captured weakly because the service group waits for all references to be released)
+				auto pWeakCheckpointer = std::weak_ptr<StateCheckpointer>(pCheckpointer);
+				state.hooks().addTransactionsChangeHandler([pWeakCheckpointer](const auto&) {
+					auto pCheckpointer = pWeakCheckpointer.lock();
+					if (pCheckpointer)
+						pCheckpointer->checkpointIfDue();
+				});
+			}
+		};
+	}
+
+	DECLARE_SERVICE_REGISTRAR(StateCheckpoint)() {
+		return std::make_unique<StateCheckpointServiceRegistrar>();
+	}
+}}
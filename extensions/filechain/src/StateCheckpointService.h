@@ -0,0 +1,30 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/extensions/ServiceRegistrar.h"
+
+namespace catapult { namespace filechain {
+
+	/// Creates a registrar for a state checkpoint service.
+	/// \note This service is responsible for periodically saving the local node state so that only the blocks following
+	///       the last checkpoint need to be replayed after an unclean shutdown.
+	DECLARE_SERVICE_REGISTRAR(StateCheckpoint)();
+}}
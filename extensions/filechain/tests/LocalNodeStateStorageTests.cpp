@@ -23,11 +23,13 @@
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/FileLock.h"
 #include "catapult/model/Address.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/core/mocks/MockMemoryBasedStorage.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
@@ -72,13 +74,15 @@ namespace catapult { namespace filechain {
 			EXPECT_EQ(expectedView.sub<cache::BlockDifficultyCache>().size(), actualView.sub<cache::BlockDifficultyCache>().size());
 		}
 
-		cache::SupplementalData SaveState(const std::string& dataDirectory, cache::CatapultCache& cache) {
+		constexpr Height Saved_Height(54321);
+
+		cache::SupplementalData SeedCache(cache::CatapultCache& cache) {
 			cache::SupplementalData supplementalData;
 			{
 				auto delta = cache.createDelta();
 				PopulateAccountStateCache(delta.sub<cache::AccountStateCache>());
 				PopulateBlockDifficultyCache(delta.sub<cache::BlockDifficultyCache>());
-				cache.commit(Height(54321));
+				cache.commit(Saved_Height);
 			}
 
 			// Sanity:
@@ -86,28 +90,94 @@ namespace catapult { namespace filechain {
 
 			supplementalData.ChainScore = model::ChainScore(0x1234567890ABCDEF, 0xFEDCBA0987654321);
 			supplementalData.State.LastRecalculationHeight = model::ImportanceHeight(12345);
-			filechain::SaveState(dataDirectory, cache, supplementalData);
 			return supplementalData;
 		}
+
+		cache::SupplementalData SaveState(const std::string& dataDirectory, cache::CatapultCache& cache, const Hash256& blockHash) {
+			auto supplementalData = SeedCache(cache);
+			filechain::SaveState(dataDirectory, cache, cache.createView(), supplementalData, blockHash);
+			return supplementalData;
+		}
+
+		bool LoadState(
+				const std::string& dataDirectory,
+				cache::CatapultCache& cache,
+				cache::SupplementalData& supplementalData,
+				const Hash256& blockHash) {
+			return filechain::LoadState(dataDirectory, cache, supplementalData, [blockHash](auto height) {
+				return Saved_Height == height ? blockHash : Hash256();
+			});
+		}
 	}
 
 	TEST(TEST_CLASS, CanSaveAndLoadState) {
 		// Arrange: seed and save the cache state
 		test::TempDirectoryGuard tempDir;
 		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
-		auto originalSupplementalData = SaveState(tempDir.name(), originalCache);
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		auto originalSupplementalData = SaveState(tempDir.name(), originalCache, blockHash);
 
 		// Act: load the cache
 		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 		cache::SupplementalData supplementalData;
-		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, blockHash);
 
 		// Assert:
 		EXPECT_TRUE(isStateLoaded);
 		AssertSubCaches(originalCache, cache);
 		EXPECT_EQ(originalSupplementalData.ChainScore, supplementalData.ChainScore);
 		EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
-		EXPECT_EQ(Height(54321), cache.createView().height());
+		EXPECT_EQ(Saved_Height, cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadStateSnapshot) {
+		// Arrange: seed the cache state and save a snapshot of it
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		auto originalSupplementalData = SeedCache(originalCache);
+		auto snapshot = CreateStateSnapshot(originalCache, originalCache.createView(), originalSupplementalData, blockHash);
+		filechain::SaveState(tempDir.name(), snapshot);
+
+		// Act: load the cache
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, blockHash);
+
+		// Assert:
+		EXPECT_TRUE(isStateLoaded);
+		AssertSubCaches(originalCache, cache);
+		EXPECT_EQ(originalSupplementalData.ChainScore, supplementalData.ChainScore);
+		EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
+		EXPECT_EQ(Saved_Height, cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, StateSnapshotIsDetachedFromCache) {
+		// Arrange: seed the cache state and create a snapshot of it
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		auto originalSupplementalData = SeedCache(originalCache);
+		auto snapshot = CreateStateSnapshot(originalCache, originalCache.createView(), originalSupplementalData, blockHash);
+
+		// - change the cache after the snapshot was created
+		{
+			auto delta = originalCache.createDelta();
+			PopulateAccountStateCache(delta.sub<cache::AccountStateCache>());
+			originalCache.commit(Saved_Height + Height(1));
+		}
+
+		// Act: save the snapshot and load the cache
+		filechain::SaveState(tempDir.name(), snapshot);
+
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, blockHash);
+
+		// Assert: the state at the time of the snapshot was loaded
+		EXPECT_TRUE(isStateLoaded);
+		SanityAssertCache(cache);
+		EXPECT_EQ(Saved_Height, cache.createView().height());
 	}
 
 	namespace {
@@ -115,7 +185,8 @@ namespace catapult { namespace filechain {
 		void AssertLoadStateFailure(const std::string& dataDirectory, TAction corruptSavedState) {
 			// Arrange: seed and save the cache state
 			auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
-			SaveState(dataDirectory, originalCache);
+			auto blockHash = test::GenerateRandomData<Hash256_Size>();
+			SaveState(dataDirectory, originalCache, blockHash);
 
 			// - corrupt the saved state
 			corruptSavedState();
@@ -123,7 +194,7 @@ namespace catapult { namespace filechain {
 			// Act: load the cache
 			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 			cache::SupplementalData supplementalData;
-			auto isStateLoaded = LoadState(dataDirectory, cache, supplementalData);
+			auto isStateLoaded = LoadState(dataDirectory, cache, supplementalData, blockHash);
 
 			// Assert:
 			EXPECT_FALSE(isStateLoaded);
@@ -142,6 +213,18 @@ namespace catapult { namespace filechain {
 		});
 	}
 
+	TEST(TEST_CLASS, CannotLoadStateIfBlockHashFileIsNotPresent) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// Assert:
+		AssertLoadStateFailure(tempDir.name(), [dataDirectory = tempDir.name()]() {
+			// Arrange: remove the block hash file
+			auto blockHashPath = boost::filesystem::path(dataDirectory) / "state" / "blockhash.dat";
+			ASSERT_TRUE(boost::filesystem::remove(blockHashPath));
+		});
+	}
+
 	TEST(TEST_CLASS, CannotLoadStateIfLockFileIsPresent) {
 		// Arrange:
 		test::TempDirectoryGuard tempDir;
@@ -168,7 +251,8 @@ namespace catapult { namespace filechain {
 
 		// - seed and save the cache state in the presence of a lock file
 		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
-		auto originalSupplementalData = SaveState(tempDir.name(), originalCache);
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		auto originalSupplementalData = SaveState(tempDir.name(), originalCache, blockHash);
 
 		// Sanity: the lock file should have been removed by SaveState
 		EXPECT_FALSE(boost::filesystem::exists(lockFilePath));
@@ -176,13 +260,155 @@ namespace catapult { namespace filechain {
 		// Act: load the cache
 		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 		cache::SupplementalData supplementalData;
-		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, blockHash);
 
 		// Assert:
 		EXPECT_TRUE(isStateLoaded);
 		AssertSubCaches(originalCache, cache);
 		EXPECT_EQ(originalSupplementalData.ChainScore, supplementalData.ChainScore);
 		EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
-		EXPECT_EQ(Height(54321), cache.createView().height());
+		EXPECT_EQ(Saved_Height, cache.createView().height());
+	}
+
+	namespace {
+		bool HasDirectory(const std::string& dataDirectory, const std::string& name) {
+			return boost::filesystem::exists(boost::filesystem::path(dataDirectory) / name);
+		}
+	}
+
+	TEST(TEST_CLASS, SaveStateReplacesPreviousState) {
+		// Arrange: seed and save two different cache states
+		test::TempDirectoryGuard tempDir;
+		auto originalCache1 = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		auto blockHash1 = test::GenerateRandomData<Hash256_Size>();
+		SaveState(tempDir.name(), originalCache1, blockHash1);
+
+		auto originalCache2 = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		auto blockHash2 = test::GenerateRandomData<Hash256_Size>();
+		SaveState(tempDir.name(), originalCache2, blockHash2);
+
+		// Act: load the cache
+		auto cache1 = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData1;
+		auto isState1Loaded = LoadState(tempDir.name(), cache1, supplementalData1, blockHash1);
+
+		auto cache2 = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData2;
+		auto isState2Loaded = LoadState(tempDir.name(), cache2, supplementalData2, blockHash2);
+
+		// Assert: only the second state is present
+		EXPECT_FALSE(isState1Loaded);
+		EXPECT_TRUE(isState2Loaded);
+		AssertSubCaches(originalCache2, cache2);
+
+		// - no intermediate directories are left behind
+		EXPECT_FALSE(HasDirectory(tempDir.name(), "state.tmp"));
+		EXPECT_FALSE(HasDirectory(tempDir.name(), "state.old"));
 	}
+
+	TEST(TEST_CLASS, SaveStateDiscardsLeftoverTemporaryState) {
+		// Arrange: simulate a temporary state directory left behind by an interrupted save
+		test::TempDirectoryGuard tempDir;
+		auto tempStateDirectory = boost::filesystem::path(tempDir.name()) / "state.tmp";
+		ASSERT_TRUE(boost::filesystem::create_directory(tempStateDirectory));
+		{
+			std::ofstream junkFileStream((tempStateDirectory / "junk.dat").generic_string());
+		}
+
+		// Act: seed and save the cache state
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		SaveState(tempDir.name(), originalCache, blockHash);
+
+		// Assert: the leftover file was not moved into the state directory
+		EXPECT_FALSE(HasDirectory(tempDir.name(), "state.tmp"));
+		EXPECT_FALSE(boost::filesystem::exists(boost::filesystem::path(tempDir.name()) / "state" / "junk.dat"));
+
+		// - the saved state can be loaded
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		EXPECT_TRUE(LoadState(tempDir.name(), cache, supplementalData, blockHash));
+		AssertSubCaches(originalCache, cache);
+	}
+
+	TEST(TEST_CLASS, CannotLoadStateIfSavedBlockHashDoesNotMatchLocalBlockHash) {
+		// Arrange: seed and save the cache state
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache, test::GenerateRandomData<Hash256_Size>());
+
+		// Act: load the cache when the local chain has a different block at the saved height (e.g. after a rollback)
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_FALSE(isStateLoaded);
+		EXPECT_EQ(Height(0), cache.createView().height());
+		EXPECT_EQ(0u, cache.createView().sub<cache::AccountStateCache>().size());
+	}
+
+	TEST(TEST_CLASS, CanLoadStateIfLocalChainDoesNotContainBlockAtSavedHeight) {
+		// Arrange: seed and save the cache state
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache, test::GenerateRandomData<Hash256_Size>());
+
+		// Act: load the cache when the local chain does not contain a block at the saved height
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, Hash256());
+
+		// Assert:
+		EXPECT_TRUE(isStateLoaded);
+		AssertSubCaches(originalCache, cache);
+		EXPECT_EQ(Saved_Height, cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, LoadStateRequestsBlockHashAtSavedHeight) {
+		// Arrange: seed and save the cache state
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache, Hash256());
+
+		// Act: load the cache
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		std::vector<Height> heights;
+		auto isStateLoaded = filechain::LoadState(tempDir.name(), cache, supplementalData, [&heights](auto height) {
+			heights.push_back(height);
+			return Hash256();
+		});
+
+		// Assert:
+		EXPECT_TRUE(isStateLoaded);
+		EXPECT_EQ(std::vector<Height>({ Saved_Height }), heights);
+	}
+
+	// region GetBlockHash
+
+	TEST(TEST_CLASS, GetBlockHashReturnsHashOfBlockInStorage) {
+		// Arrange: mock storage contains nemesis block
+		io::BlockStorageCache storage(std::make_unique<mocks::MockMemoryBasedStorage>());
+		auto expectedHash = storage.view().loadBlockElement(Height(1))->EntityHash;
+
+		// Act:
+		auto hash = GetBlockHash(storage, Height(1));
+
+		// Assert:
+		EXPECT_EQ(expectedHash, hash);
+	}
+
+	TEST(TEST_CLASS, GetBlockHashReturnsZeroHashWhenStorageDoesNotContainBlock) {
+		// Arrange: mock storage contains nemesis block
+		io::BlockStorageCache storage(std::make_unique<mocks::MockMemoryBasedStorage>());
+
+		// Act:
+		auto hash = GetBlockHash(storage, Height(2));
+
+		// Assert:
+		EXPECT_EQ(Hash256(), hash);
+	}
+
+	// endregion
 }}
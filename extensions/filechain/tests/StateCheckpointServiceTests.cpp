@@ -0,0 +1,197 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "filechain/src/StateCheckpointService.h"
+#include "filechain/src/LocalNodeStateStorage.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/consumers/BlockChainSyncHandlers.h"
+#include "tests/test/local/ServiceLocatorTestContext.h"
+#include "tests/test/local/ServiceTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace filechain {
+
+#define TEST_CLASS StateCheckpointServiceTests
+
+	namespace {
+		struct StateCheckpointServiceTraits {
+			static constexpr auto CreateRegistrar = CreateStateCheckpointServiceRegistrar;
+		};
+
+		using TestContext = test::ServiceLocatorTestContext<StateCheckpointServiceTraits>;
+
+		void SetConfiguration(TestContext& context, const std::string& dataDirectory, uint32_t checkpointInterval) {
+			const auto& config = context.testState().config();
+			const_cast<config::UserConfiguration&>(config.User).DataDirectory = dataDirectory;
+			const_cast<config::NodeConfiguration&>(config.Node).StateCheckpointInterval = checkpointInterval;
+		}
+
+		void CommitAndNotify(TestContext& context, Height height) {
+			auto& cache = context.testState().state().cache();
+			{
+				auto cacheDelta = cache.createDelta();
+				cache.commit(height);
+			}
+
+			utils::HashPointerSet addedTransactionHashes;
+			std::vector<model::TransactionInfo> revertedTransactionInfos;
+			context.testState().state().hooks().transactionsChangeHandler()({ addedTransactionHashes, revertedTransactionInfos });
+		}
+
+		bool HasCheckpoint(const std::string& dataDirectory) {
+			return boost::filesystem::exists(boost::filesystem::path(dataDirectory) / "state" / "supplemental.dat");
+		}
+
+		Height LoadCheckpointHeight(const std::string& dataDirectory) {
+			cache::CatapultCache cache({});
+			cache::SupplementalData supplementalData;
+			LoadState(dataDirectory, cache, supplementalData, [](auto) { return Hash256(); });
+			return cache.createView().height();
+		}
+	}
+
+	ADD_SERVICE_REGISTRAR_INFO_TEST(StateCheckpoint, Initial)
+
+	TEST(TEST_CLASS, NoServicesOrCountersAreRegistered) {
+		// Assert:
+		test::AssertNoServicesOrCountersAreRegistered<TestContext>();
+	}
+
+	TEST(TEST_CLASS, CheckpointerIsNotRegisteredWhenCheckpointsAreDisabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		TestContext context;
+		SetConfiguration(context, tempDir.name(), 0);
+
+		// Act:
+		context.boot();
+		CommitAndNotify(context, Height(10));
+		context.shutdown();
+
+		// Assert:
+		EXPECT_EQ(0u, context.testState().state().pool().numServiceGroups());
+		EXPECT_FALSE(HasCheckpoint(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, CheckpointerIsNotRegisteredWhenCacheDatabaseStorageIsEnabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		TestContext context;
+		SetConfiguration(context, tempDir.name(), 5);
+		const_cast<config::NodeConfiguration&>(context.testState().config().Node).ShouldUseCacheDatabaseStorage = true;
+
+		// Act:
+		context.boot();
+		CommitAndNotify(context, Height(10));
+		context.shutdown();
+
+		// Assert:
+		EXPECT_EQ(0u, context.testState().state().pool().numServiceGroups());
+		EXPECT_FALSE(HasCheckpoint(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, CheckpointerIsRegisteredWhenCheckpointsAreEnabled) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		TestContext context;
+		SetConfiguration(context, tempDir.name(), 5);
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(1u, context.testState().state().pool().numServiceGroups());
+		EXPECT_EQ(2u, context.testState().state().pool().numServices());
+	}
+
+	TEST(TEST_CLASS, CheckpointIsNotSavedBeforeIntervalElapses) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		TestContext context;
+		SetConfiguration(context, tempDir.name(), 5);
+		context.boot();
+
+		// Act:
+		CommitAndNotify(context, Height(4));
+		context.shutdown();
+
+		// Assert:
+		EXPECT_FALSE(HasCheckpoint(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, CheckpointIsSavedWhenIntervalElapses) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		TestContext context;
+		SetConfiguration(context, tempDir.name(), 5);
+		context.boot();
+
+		// Act:
+		CommitAndNotify(context, Height(5));
+		context.shutdown();
+
+		// Assert:
+		EXPECT_TRUE(HasCheckpoint(tempDir.name()));
+		EXPECT_EQ(Height(5), LoadCheckpointHeight(tempDir.name()));
+	}
+
+	namespace {
+		Height CommitAndLoadCheckpointHeight(const std::vector<Height>& heights) {
+			// Arrange:
+			test::TempDirectoryGuard tempDir;
+			TestContext context;
+			SetConfiguration(context, tempDir.name(), 5);
+			context.boot();
+
+			// Act: checkpoints are saved asynchronously, so only check the last one after all of them are saved
+			for (auto height : heights)
+				CommitAndNotify(context, height);
+
+			context.shutdown();
+			return LoadCheckpointHeight(tempDir.name());
+		}
+	}
+
+	TEST(TEST_CLASS, CheckpointIsNotSavedBeforeIntervalRelativeToLastCheckpointElapses) {
+		// Act: save a checkpoint at height 6, height 10 is within the interval of the last checkpoint
+		auto checkpointHeight = CommitAndLoadCheckpointHeight({ Height(6), Height(10) });
+
+		// Assert:
+		EXPECT_EQ(Height(6), checkpointHeight);
+	}
+
+	TEST(TEST_CLASS, CheckpointIsSavedWhenIntervalRelativeToLastCheckpointElapses) {
+		// Act: save a checkpoint at height 6, height 11 is not within the interval of the last checkpoint
+		auto checkpointHeight = CommitAndLoadCheckpointHeight({ Height(6), Height(10), Height(11) });
+
+		// Assert:
+		EXPECT_EQ(Height(11), checkpointHeight);
+	}
+
+	TEST(TEST_CLASS, CheckpointIsSavedAfterRollbackBelowLastCheckpoint) {
+		// Act: save a checkpoint at height 6, height 4 is below the last checkpoint
+		auto checkpointHeight = CommitAndLoadCheckpointHeight({ Height(6), Height(4) });
+
+		// Assert:
+		EXPECT_EQ(Height(4), checkpointHeight);
+	}
+}}
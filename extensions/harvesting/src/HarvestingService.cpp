@@ -28,6 +28,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace harvesting {
 
@@ -70,6 +71,24 @@ namespace catapult { namespace harvesting {
 			});
 		}
 
+		chain::ExecutionConfiguration CreateExecutionConfiguration(const plugins::PluginManager& pluginManager) {
+			chain::ExecutionConfiguration executionConfig;
+			executionConfig.Network = pluginManager.config().Network;
+			executionConfig.pObserver = pluginManager.createObserver();
+			executionConfig.pValidator = pluginManager.createStatefulValidator();
+			executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+			return executionConfig;
+		}
+
+		TransactionsInfoSupplier CreateValidatingTransactionsInfoSupplier(const extensions::ServiceState& state) {
+			// only harvest transactions that are valid when executed in order against the confirmed state
+			return CreateTransactionsInfoSupplier(
+					state.utCache(),
+					state.cache(),
+					CreateExecutionConfiguration(state.pluginManager()),
+					state.timeSupplier());
+		}
+
 		thread::Task CreateHarvestingTask(extensions::ServiceState& state, UnlockedAccounts& unlockedAccounts) {
 			const auto& cache = state.cache();
 			const auto& blockChainConfig = state.config().BlockChain;
@@ -79,7 +98,7 @@ namespace catapult { namespace harvesting {
 							cache,
 							blockChainConfig,
 							unlockedAccounts,
-							CreateTransactionsInfoSupplier(state.utCache())));
+							CreateValidatingTransactionsInfoSupplier(state)));
 
 			auto minHarvesterBalance = blockChainConfig.MinHarvesterBalance;
 			return thread::CreateNamedTask("harvesting task", [&cache, &unlockedAccounts, pHarvesterTask, minHarvesterBalance]() {
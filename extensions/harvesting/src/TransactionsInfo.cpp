@@ -19,26 +19,98 @@
 **/
 
 #include "TransactionsInfo.h"
+#include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/MemoryUtCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/chain/ProcessingNotificationSubscriber.h"
+#include "catapult/utils/HexFormatter.h"
 
 namespace catapult { namespace harvesting {
 
-	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache) {
-		return [&utCache](auto count) {
-			TransactionsInfo info;
-			std::vector<const model::TransactionInfo*> transactionInfos;
+	namespace {
+		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-			auto view = utCache.view();
-			if (0 != count) {
-				view.forEach([count, &info, &transactionInfos](const auto& transactionInfo) {
-					info.Transactions.push_back(transactionInfo.pEntity);
-					transactionInfos.push_back(&transactionInfo);
-					return info.Transactions.size() != count;
-				});
+		cache::CatapultCacheDetachedDelta DetachConfirmedState(const cache::CatapultCache& cache, Height& height) {
+			// the detachable delta holds a reader lock on the confirmed state until it is destroyed
+			auto detachableDelta = cache.createDetachableDelta();
+			height = detachableDelta.height();
+			return detachableDelta.detach();
+		}
+
+		TransactionInfoPointers FilterValidTransactionInfos(
+				const TransactionInfoPointers& transactionInfos,
+				const cache::CatapultCache& cache,
+				const chain::ExecutionConfiguration& executionConfig,
+				Timestamp currentTime) {
+			// execute the transactions against a detached copy of the confirmed state so that no cache locks are held
+			Height cacheHeight;
+			auto detachedDelta = DetachConfirmedState(cache, cacheHeight);
+			auto pCacheDelta = detachedDelta.lock();
+			if (!pCacheDelta) {
+				// the confirmed state changed, so a block based on it would be rejected anyway
+				CATAPULT_LOG(debug) << "confirmed state changed while selecting transactions for harvesting";
+				return TransactionInfoPointers();
+			}
+
+			// note that the validator and observer context height is one larger than the chain height
+			// since the validation and observation has to be for the *next* block
+			auto effectiveHeight = cacheHeight + Height(1);
+			auto readOnlyCache = pCacheDelta->toReadOnly();
+			auto validatorContext = validators::ValidatorContext(effectiveHeight, currentTime, executionConfig.Network, readOnlyCache);
+
+			// note that the "real" state is currently only required by block observers, so a dummy state can be used
+			state::CatapultState dummyState;
+			auto observerContext = observers::ObserverContext(*pCacheDelta, dummyState, effectiveHeight, observers::NotifyMode::Commit);
+
+			TransactionInfoPointers validTransactionInfos;
+			for (const auto* pTransactionInfo : transactionInfos) {
+				const auto& entityHash = pTransactionInfo->EntityHash;
+
+				chain::ProcessingNotificationSubscriber sub(
+						*executionConfig.pValidator,
+						validatorContext,
+						*executionConfig.pObserver,
+						observerContext);
+				sub.enableUndo();
+				executionConfig.pNotificationPublisher->publish(model::WeakEntityInfo(*pTransactionInfo->pEntity, entityHash), sub);
+				if (!IsValidationResultSuccess(sub.result())) {
+					CATAPULT_LOG(debug) << "skipping transaction " << utils::HexFormat(entityHash) << " for harvesting: " << sub.result();
+					sub.undo();
+					continue;
+				}
+
+				validTransactionInfos.push_back(pTransactionInfo);
 			}
 
+			return validTransactionInfos;
+		}
+
+		TransactionsInfo CreateTransactionsInfo(const TransactionInfoPointers& transactionInfos) {
+			TransactionsInfo info;
+			for (const auto* pTransactionInfo : transactionInfos)
+				info.Transactions.push_back(pTransactionInfo->pEntity);
+
 			CalculateBlockTransactionsHash(transactionInfos, info.TransactionsHash);
 			return info;
+		}
+	}
+
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache) {
+		return [&utCache](auto count) {
+			auto view = utCache.view();
+			return CreateTransactionsInfo(view.prioritizedTransactionInfos(count));
+		};
+	}
+
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
+			const cache::MemoryUtCache& utCache,
+			const cache::CatapultCache& cache,
+			const chain::ExecutionConfiguration& executionConfig,
+			const chain::TimeSupplier& timeSupplier) {
+		return [&utCache, &cache, executionConfig, timeSupplier](auto count) {
+			auto view = utCache.view();
+			auto transactionInfos = view.prioritizedTransactionInfos(count);
+			return CreateTransactionsInfo(FilterValidTransactionInfos(transactionInfos, cache, executionConfig, timeSupplier()));
 		};
 	}
 }}
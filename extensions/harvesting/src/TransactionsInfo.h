@@ -19,9 +19,16 @@
 **/
 
 #pragma once
+#include "catapult/chain/ChainFunctions.h"
+#include "catapult/chain/ExecutionConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 
-namespace catapult { namespace cache { class MemoryUtCache; } }
+namespace catapult {
+	namespace cache {
+		class CatapultCache;
+		class MemoryUtCache;
+	}
+}
 
 namespace catapult { namespace harvesting {
 
@@ -38,5 +45,16 @@ namespace catapult { namespace harvesting {
 	using TransactionsInfoSupplier = std::function<TransactionsInfo (uint32_t)>;
 
 	/// Creates a default transactions info supplier around \a utCache.
+	/// \note When \a utCache prioritizes by fee, the highest paying transactions are supplied.
 	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache);
+
+	/// Creates a transactions info supplier around \a utCache that only supplies transactions that are valid when executed
+	/// in order against the confirmed state in \a cache using \a executionConfig and the time supplied by \a timeSupplier.
+	/// \note When \a utCache prioritizes by fee, the supplied transactions are not necessarily valid as a group
+	///        (e.g. a selected transaction can depend on an unselected one), so invalid transactions are dropped.
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
+			const cache::MemoryUtCache& utCache,
+			const cache::CatapultCache& cache,
+			const chain::ExecutionConfiguration& executionConfig,
+			const chain::TimeSupplier& timeSupplier);
 }}
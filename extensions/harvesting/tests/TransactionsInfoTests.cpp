@@ -20,7 +20,9 @@
 
 #include "harvesting/src/TransactionsInfo.h"
 #include "catapult/cache/MemoryUtCache.h"
+#include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace harvesting {
@@ -80,4 +82,153 @@ namespace catapult { namespace harvesting {
 		// Assert:
 		AssertSupplierBehavior(10, 15, 10);
 	}
+
+	TEST(TEST_CLASS, SupplierReturnsHighestPayingTransactionInfosInInsertionOrderIfCachePrioritizesByFee) {
+		// Arrange: create transactions with equal sizes and different fees
+		cache::MemoryUtCache cache(cache::MemoryCacheOptions(1000, 1000, true));
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		std::vector<Amount> fees{ Amount(10), Amount(50), Amount(20), Amount(40), Amount(30) };
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			auto pTransaction = test::CopyEntity(*transactionInfos[i].pEntity);
+			pTransaction->Fee = fees[i];
+			transactionInfos[i].pEntity = std::move(pTransaction);
+		}
+
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto info = CreateTransactionsInfoSupplier(cache)(3);
+
+		// Assert: the three highest paying transactions are returned in insertion order
+		ASSERT_EQ(3u, info.Transactions.size());
+		EXPECT_EQ(Amount(50), info.Transactions[0]->Fee);
+		EXPECT_EQ(Amount(40), info.Transactions[1]->Fee);
+		EXPECT_EQ(Amount(30), info.Transactions[2]->Fee);
+	}
+
+	// region validating supplier
+
+	namespace {
+		class ValidatingSupplierTestContext {
+		public:
+			explicit ValidatingSupplierTestContext(size_t count)
+					: m_pUtCache(PrepareCache(count))
+					, m_cache(test::CreateEmptyCatapultCache()) {
+				auto delta = m_cache.createDelta();
+				m_cache.commit(Height(7));
+			}
+
+		public:
+			auto& utCache() {
+				return *m_pUtCache;
+			}
+
+			const auto& cache() const {
+				return m_cache;
+			}
+
+			auto& executionConfig() {
+				return m_executionConfig;
+			}
+
+		public:
+			void setFailure(size_t index) {
+				auto transactionInfos = test::ExtractTransactionInfos(m_pUtCache->view(), index + 1);
+				m_executionConfig.pValidator->setResult(
+						validators::ValidationResult::Failure,
+						transactionInfos.back()->EntityHash,
+						1);
+			}
+
+			TransactionsInfo supply(uint32_t count) {
+				auto supplier = CreateTransactionsInfoSupplier(*m_pUtCache, m_cache, m_executionConfig.Config, []() {
+					return Timestamp(987);
+				});
+				return supplier(count);
+			}
+
+		private:
+			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
+			cache::CatapultCache m_cache;
+			test::MockExecutionConfiguration m_executionConfig;
+		};
+	}
+
+	TEST(TEST_CLASS, ValidatingSupplierReturnsAllTransactionInfosIfAllAreValid) {
+		// Arrange:
+		ValidatingSupplierTestContext context(10);
+
+		// Act:
+		auto info = context.supply(5);
+
+		// Assert:
+		auto expectedTransactionInfos = test::ExtractTransactionInfos(context.utCache().view(), 5);
+		ASSERT_EQ(5u, info.Transactions.size());
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_EQ(*expectedTransactionInfos[i]->pEntity, *info.Transactions[i]) << "transaction at " << i;
+
+		Hash256 expectedHash;
+		CalculateBlockTransactionsHash(expectedTransactionInfos, expectedHash);
+		EXPECT_EQ(expectedHash, info.TransactionsHash);
+	}
+
+	TEST(TEST_CLASS, ValidatingSupplierExecutesTransactionInfosInOrderAgainstNextHeight) {
+		// Arrange:
+		ValidatingSupplierTestContext context(10);
+
+		// Act:
+		context.supply(3);
+
+		// Assert: each transaction produces two notifications
+		auto expectedTransactionInfos = test::ExtractTransactionInfos(context.utCache().view(), 3);
+		const auto& params = context.executionConfig().pValidator->params();
+		ASSERT_EQ(6u, params.size());
+		for (auto i = 0u; i < params.size(); ++i) {
+			auto message = "notification at " + std::to_string(i);
+			EXPECT_EQ(expectedTransactionInfos[i / 2]->EntityHash, params[i].HashCopy) << message;
+			EXPECT_EQ(i % 2 + 1, params[i].SequenceId) << message;
+			EXPECT_EQ(Height(8), params[i].Context.Height) << message;
+			EXPECT_EQ(Timestamp(987), params[i].Context.BlockTime) << message;
+
+			// - changes of previous transactions are visible to subsequent transactions
+			EXPECT_EQ(i, params[i].NumDifficultyInfos) << message;
+		}
+	}
+
+	TEST(TEST_CLASS, ValidatingSupplierDropsTransactionInfosThatFailValidation) {
+		// Arrange:
+		ValidatingSupplierTestContext context(10);
+		context.setFailure(1);
+		context.setFailure(3);
+
+		// Act:
+		auto info = context.supply(5);
+
+		// Assert: only the valid transactions are returned (in order)
+		auto transactionInfos = test::ExtractTransactionInfos(context.utCache().view(), 5);
+		decltype(transactionInfos) expectedTransactionInfos{ transactionInfos[0], transactionInfos[2], transactionInfos[4] };
+		ASSERT_EQ(3u, info.Transactions.size());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(*expectedTransactionInfos[i]->pEntity, *info.Transactions[i]) << "transaction at " << i;
+
+		// - the hash only covers the valid transactions
+		Hash256 expectedHash;
+		CalculateBlockTransactionsHash(expectedTransactionInfos, expectedHash);
+		EXPECT_EQ(expectedHash, info.TransactionsHash);
+	}
+
+	TEST(TEST_CLASS, ValidatingSupplierDoesNotModifyConfirmedState) {
+		// Arrange:
+		ValidatingSupplierTestContext context(10);
+
+		// Act:
+		auto info = context.supply(5);
+
+		// Assert: the observer modified a copy of the confirmed state
+		EXPECT_EQ(5u, info.Transactions.size());
+		EXPECT_EQ(10u, context.executionConfig().pObserver->params().size());
+		EXPECT_EQ(0u, context.cache().createView().sub<cache::BlockDifficultyCache>().size());
+	}
+
+	// endregion
 }}
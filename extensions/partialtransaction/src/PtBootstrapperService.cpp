@@ -25,6 +25,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
+#include "catapult/thread/Task.h"
 
 namespace catapult { namespace partialtransaction {
 
@@ -34,6 +35,27 @@ namespace catapult { namespace partialtransaction {
 		constexpr auto Cache_Service_Name = "pt.cache";
 		constexpr auto Hooks_Service_Name = "pt.hooks";
 
+		void NotifyPruned(
+				subscribers::TransactionStatusSubscriber& transactionStatusSubscriber,
+				const std::vector<model::DetachedTransactionInfo>& prunedInfos) {
+			auto pruneStatus = utils::to_underlying_type(extensions::Failure_Extension_Partial_Transaction_Cache_Prune);
+			for (const auto& prunedInfo : prunedInfos)
+				transactionStatusSubscriber.notifyStatus(*prunedInfo.pEntity, prunedInfo.EntityHash, pruneStatus);
+		}
+
+		thread::Task CreatePrunePartialTransactionsTask(
+				PtCache& ptCache,
+				subscribers::TransactionStatusSubscriber& transactionStatusSubscriber,
+				const supplier<Timestamp>& timeSupplier) {
+			return thread::CreateNamedTask("prune partial transactions task", [&ptCache, &transactionStatusSubscriber, timeSupplier]() {
+				// expired transactions are found without scanning the cache, so the modifier is only held briefly
+				// and subscribers are notified after it is released
+				auto prunedInfos = ptCache.modifier().prune(timeSupplier());
+				NotifyPruned(transactionStatusSubscriber, prunedInfos);
+				return thread::make_ready_future(thread::TaskResult::Continue);
+			});
+		}
+
 		class PtBootstrapperServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit PtBootstrapperServiceRegistrar(const PtCacheSupplier& ptCacheSupplier) : m_ptCacheSupplier(ptCacheSupplier)
@@ -67,10 +89,7 @@ namespace catapult { namespace partialtransaction {
 						modifier.remove(*pHash);
 
 					// 2. prune the pt cache
-					auto pruneStatus = utils::to_underlying_type(extensions::Failure_Extension_Partial_Transaction_Cache_Prune);
-					auto prunedInfos = modifier.prune(timeSupplier());
-					for (const auto& prunedInfo : prunedInfos)
-						transactionStatusSubscriber.notifyStatus(*prunedInfo.pEntity, prunedInfo.EntityHash, pruneStatus);
+					NotifyPruned(transactionStatusSubscriber, modifier.prune(timeSupplier()));
 				});
 
 				state.hooks().addTransactionEventHandler([&ptCache, &transactionStatusSubscriber](const auto& eventData) {
@@ -84,6 +103,9 @@ namespace catapult { namespace partialtransaction {
 						transactionStatusSubscriber.notifyStatus(*removedInfo.pEntity, removedInfo.EntityHash, status);
 					}
 				});
+
+				// add tasks
+				state.tasks().push_back(CreatePrunePartialTransactionsTask(ptCache, transactionStatusSubscriber, timeSupplier));
 			}
 
 		private:
@@ -185,16 +185,16 @@ namespace catapult { namespace partialtransaction {
 						[&dispatcher](auto&& transactionRange) {
 							dispatcher.queue(std::move(transactionRange), InputSource::Remote_Pull);
 						},
-						[&ptUpdater, &newCosignatures, pRecentHashCache, pCacheLock](auto&& cosignature) {
+						[&newCosignatures, pRecentHashCache, pCacheLock](auto&& cosignature) {
 							utils::SpinLockGuard guard(*pCacheLock);
-							if (pRecentHashCache->add(ToHash(cosignature))) {
-								ptUpdater.update(cosignature);
+							if (pRecentHashCache->add(ToHash(cosignature)))
 								newCosignatures.push_back(cosignature);
-							}
 						});
 
-				if (!newCosignatures.empty())
+				if (!newCosignatures.empty()) {
+					ptUpdater.update(newCosignatures);
 					cosignaturesSink(newCosignatures);
+				}
 			});
 
 			hooks.setPtRangeConsumer([&dispatcher = *pBatchRangeDispatcher](auto&& transactionRange) {
@@ -205,14 +205,15 @@ namespace catapult { namespace partialtransaction {
 				utils::SpinLockGuard guard(*pCacheLock);
 				std::vector<model::DetachedCosignature> newCosignatures;
 				for (const auto& cosignature : cosignatureRange.Range) {
-					if (pRecentHashCache->add(ToHash(cosignature))) {
-						ptUpdater.update(cosignature);
+					if (pRecentHashCache->add(ToHash(cosignature)))
 						newCosignatures.push_back(cosignature);
-					}
 				}
 
-				if (!newCosignatures.empty())
+				// verify all new cosignatures in a single batch
+				if (!newCosignatures.empty()) {
+					ptUpdater.update(newCosignatures);
 					cosignaturesSink(newCosignatures);
+				}
 			});
 
 			state.tasks().push_back(extensions::CreateBatchTransactionTask(*pBatchRangeDispatcher, "partial transaction"));
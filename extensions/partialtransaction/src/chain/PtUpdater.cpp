@@ -197,40 +197,65 @@ namespace catapult { namespace chain {
 
 	public:
 		thread::future<CosignatureUpdateResult> update(const model::DetachedCosignature& cosignature) {
-			auto pPromise = std::make_shared<thread::promise<CosignatureUpdateResult>>(); // needs to be copyable to pass to post
+			return update(DetachedCosignatures{ cosignature }).then([](auto&& resultsFuture) {
+				return resultsFuture.get()[0];
+			});
+		}
+
+		thread::future<std::vector<CosignatureUpdateResult>> update(const DetachedCosignatures& cosignatures) {
+			// needs to be copyable to pass to post
+			auto pPromise = std::make_shared<thread::promise<std::vector<CosignatureUpdateResult>>>();
 			auto updateFuture = pPromise->get_future();
 
-			m_pPool->service().post([pThis = shared_from_this(), cosignature, pPromise]() {
-				auto result = pThis->updateImpl(cosignature);
-				pPromise->set_value(std::move(result));
+			m_pPool->service().post([pThis = shared_from_this(), cosignatures, pPromise]() {
+				auto results = pThis->updateImpl(cosignatures);
+				pPromise->set_value(std::move(results));
 			});
 
 			return updateFuture;
 		}
 
 	private:
-		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature) {
-			auto eligiblityResult = checkEligibility(cosignature);
-
-			// proactively refresh the cache even if the new cosignature is invalid
-			if (eligiblityResult.isCacheStale() && !eligiblityResult.isPurgeRequired())
-				refreshStaleCacheEntry(eligiblityResult.staleTransactionInfo());
-
-			if (!eligiblityResult.isEligibile()) {
-				if (eligiblityResult.isPurgeRequired())
-					remove(cosignature.ParentHash);
+		std::vector<CosignatureUpdateResult> updateImpl(const DetachedCosignatures& cosignatures) {
+			// check the eligibility of all cosignatures first so that the signatures of all eligible ones can be verified in one batch
+			std::vector<CosignatureUpdateResult> results(cosignatures.size(), CosignatureUpdateResult::Ineligible);
+			std::vector<size_t> eligibleIndexes;
+			std::vector<crypto::SignatureInput> signatureInputs;
+			for (auto i = 0u; i < cosignatures.size(); ++i) {
+				const auto& cosignature = cosignatures[i];
+				auto eligiblityResult = checkEligibility(cosignature);
+
+				// proactively refresh the cache even if the new cosignature is invalid
+				if (eligiblityResult.isCacheStale() && !eligiblityResult.isPurgeRequired())
+					refreshStaleCacheEntry(eligiblityResult.staleTransactionInfo());
+
+				if (!eligiblityResult.isEligibile()) {
+					if (eligiblityResult.isPurgeRequired())
+						remove(cosignature.ParentHash);
+
+					results[i] = eligiblityResult.updateResult();
+					continue;
+				}
 
-				return eligiblityResult.updateResult();
+				eligibleIndexes.push_back(i);
+				signatureInputs.emplace_back(cosignature.Signer, cosignature.ParentHash, cosignature.Signature);
 			}
 
-			if (!crypto::Verify(cosignature.Signer, cosignature.ParentHash, cosignature.Signature)) {
-				CATAPULT_LOG(debug)
-						<< "ignoring unverifiable cosignature (signer = " << utils::HexFormat(cosignature.Signer)
-						<< ", parentHash = " << utils::HexFormat(cosignature.ParentHash) << ")";
-				return CosignatureUpdateResult::Unverifiable;
+			auto verifyResults = crypto::VerifyMulti(signatureInputs.data(), signatureInputs.size());
+			for (auto i = 0u; i < eligibleIndexes.size(); ++i) {
+				const auto& cosignature = cosignatures[eligibleIndexes[i]];
+				if (!verifyResults[i]) {
+					CATAPULT_LOG(debug)
+							<< "ignoring unverifiable cosignature (signer = " << utils::HexFormat(cosignature.Signer)
+							<< ", parentHash = " << utils::HexFormat(cosignature.ParentHash) << ")";
+					results[eligibleIndexes[i]] = CosignatureUpdateResult::Unverifiable;
+					continue;
+				}
+
+				results[eligibleIndexes[i]] = addCosignature(cosignature);
 			}
 
-			return addCosignature(cosignature);
+			return results;
 		}
 
 		thread::future<TransactionUpdateResult> update(
@@ -239,14 +264,9 @@ namespace catapult { namespace chain {
 			if (cosignatures.empty())
 				return thread::make_ready_future(TransactionUpdateResult{ updateType, 0u });
 
-			std::vector<thread::future<CosignatureUpdateResult>> futures;
-			for (const auto& cosignature : cosignatures)
-				futures.emplace_back(update(cosignature));
-
-			return thread::when_all(std::move(futures)).then([updateType](auto&& resultsFuture) {
+			return update(cosignatures).then([updateType](auto&& resultsFuture) {
 				auto results = resultsFuture.get();
-				auto numCosignaturesAdded = std::count_if(results.begin(), results.end(), [](auto& resultFuture) {
-					auto result = resultFuture.get();
+				auto numCosignaturesAdded = std::count_if(results.cbegin(), results.cend(), [](auto result) {
 					return CosignatureUpdateResult::Added_Incomplete == result || CosignatureUpdateResult::Added_Complete == result;
 				});
 
@@ -416,4 +436,8 @@ namespace catapult { namespace chain {
 	thread::future<CosignatureUpdateResult> PtUpdater::update(const model::DetachedCosignature& cosignature) {
 		return m_pImpl->update(cosignature);
 	}
+
+	thread::future<std::vector<CosignatureUpdateResult>> PtUpdater::update(const std::vector<model::DetachedCosignature>& cosignatures) {
+		return m_pImpl->update(cosignatures);
+	}
 }}
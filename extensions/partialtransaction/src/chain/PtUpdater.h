@@ -22,6 +22,7 @@
 #include "catapult/chain/ChainFunctions.h"
 #include "catapult/thread/Future.h"
 #include <memory>
+#include <vector>
 
 namespace catapult {
 	namespace cache { class MemoryPtCacheProxy; }
@@ -108,6 +109,10 @@ namespace catapult { namespace chain {
 		/// Updates this cache by adding a new \a cosignature.
 		thread::future<CosignatureUpdateResult> update(const model::DetachedCosignature& cosignature);
 
+		/// Updates this cache by adding new \a cosignatures.
+		/// \note The signatures of all eligible cosignatures are verified in a single batch.
+		thread::future<std::vector<CosignatureUpdateResult>> update(const std::vector<model::DetachedCosignature>& cosignatures);
+
 	private:
 		class Impl;
 		std::shared_ptr<Impl> m_pImpl; // shared_ptr to allow use of enable_shared_from_this
@@ -255,6 +255,58 @@ namespace catapult { namespace partialtransaction {
 
 	// endregion
 
+	// region PtBootstrapperService tasks
+
+	namespace {
+		constexpr auto Prune_Task_Name = "prune partial transactions task";
+	}
+
+	TEST(TEST_CLASS, PruneTaskIsScheduled) {
+		// Assert:
+		test::AssertRegisteredTask(TestContext(), 1, Prune_Task_Name);
+	}
+
+	TEST(TEST_CLASS, PruneTaskPurgesExpiredTransactionsFromCache) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		// - seed the cache (deadlines t[+1.5]..t[-3.5])
+		auto transactionInfos = test::CreateTransactionInfos(6, [](auto i) {
+			return SubtractNonNegative(utils::NetworkTime(), utils::TimeSpan::FromHours(i)) + utils::TimeSpan::FromMinutes(90);
+		});
+		auto& ptCache = GetMemoryPtCache(context.locator());
+		for (const auto& transactionInfo : transactionInfos)
+			ptCache.modifier().add(transactionInfo);
+
+		// Act: trigger pruning of four infos (t[+1.5] and t[+0.5] are preserved)
+		test::RunTaskTestPostBoot(context, 1, Prune_Task_Name, [](const auto& task) {
+			auto result = task.Callback().get();
+			EXPECT_EQ(thread::TaskResult::Continue, result);
+		});
+
+		// Assert:
+		auto view = ptCache.view();
+		EXPECT_EQ(2u, view.size());
+		EXPECT_TRUE(view.find(transactionInfos[0].EntityHash));
+		EXPECT_TRUE(view.find(transactionInfos[1].EntityHash));
+
+		// - check status notifications (ordered from smallest to largest deadline)
+		const auto& subscriber = context.testState().transactionStatusSubscriber();
+		ASSERT_EQ(4u, subscriber.params().size());
+		for (auto i = 0u; i < subscriber.params().size(); ++i) {
+			auto message = "status at " + std::to_string(i);
+			const auto& info = transactionInfos[5 - i];
+			const auto& status = subscriber.params()[i];
+
+			EXPECT_EQ(*info.pEntity, status.Transaction) << message;
+			EXPECT_EQ(test::ToString(info.EntityHash), test::ToString(status.HashCopy)) << message;
+			EXPECT_EQ(utils::to_underlying_type(extensions::Failure_Extension_Partial_Transaction_Cache_Prune), status.Status) << message;
+		}
+	}
+
+	// endregion
+
 	// region PtBootstrapperService hooks (TransactionEventHandler)
 
 	namespace {
@@ -46,8 +46,9 @@ namespace catapult { namespace partialtransaction {
 
 		constexpr auto Num_Pre_Existing_Services = 3u;
 		constexpr auto Num_Expected_Services = 2u + Num_Pre_Existing_Services;
-		constexpr auto Num_Expected_Counters = 2u;
-		constexpr auto Num_Expected_Tasks = 1u;
+		constexpr auto Num_Expected_Counters = 3u;
+		constexpr auto Num_Pre_Existing_Tasks = 1u;
+		constexpr auto Num_Expected_Tasks = 1u + Num_Pre_Existing_Tasks;
 
 		constexpr auto Service_Name = "api.partial";
 		constexpr auto Counter_Name = "PT ELEM TOT";
@@ -476,7 +477,7 @@ namespace catapult { namespace partialtransaction {
 
 			// Act:
 			invokeHook(GetPtServerHooks(context.locator()), std::move(transactionRange));
-			context.testState().state().tasks()[0].Callback(); // forward all batched transactions to the dispatcher
+			context.testState().state().tasks()[Num_Pre_Existing_Tasks].Callback(); // forward all batched transactions to the dispatcher
 
 			// Assert: wait for element processing to finish
 			WAIT_FOR_VALUE_EXPR(3u, context.cache().view().size());
@@ -866,6 +866,70 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region update cosignatures - batch
+
+	TEST(TEST_CLASS, AddingMultipleCosignaturesWithMatchingTransactionAddsAllCosignatures) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create compatible cosignatures
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < 3; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: all cosignatures were added
+			EXPECT_EQ(std::vector<CosignatureUpdateResult>(3, CosignatureUpdateResult::Added_Incomplete), results);
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0], cosignatures[1], cosignatures[2]
+			});
+
+			EXPECT_TRUE(context.completedTransactions().empty());
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, AddingMultipleCosignaturesReturnsResultForEachCosignature) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create cosignatures: valid, unverifiable, without matching transaction, duplicate
+			const auto& existingCosignature = transaction.CosignaturesPtr()[1];
+			std::vector<model::DetachedCosignature> cosignatures{
+				test::GenerateValidCosignature(transactionInfo.EntityHash),
+				test::GenerateValidCosignature(transactionInfo.EntityHash),
+				test::GenerateValidCosignature(test::GenerateRandomData<Hash256_Size>()),
+				{ existingCosignature.Signer, existingCosignature.Signature, transactionInfo.EntityHash }
+			};
+			cosignatures[1].Signature[0] ^= 0xFF;
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: only the valid cosignature was added
+			EXPECT_EQ(std::vector<CosignatureUpdateResult>({
+				CosignatureUpdateResult::Added_Incomplete,
+				CosignatureUpdateResult::Unverifiable,
+				CosignatureUpdateResult::Ineligible,
+				CosignatureUpdateResult::Redundant
+			}), results);
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0]
+			});
+
+			EXPECT_TRUE(context.completedTransactions().empty());
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+		});
+	}
+
+	// endregion
+
 	// region update cosignature - invalid
 
 	TEST(TEST_CLASS, AddingCosignatureThatTriggersUnexpectedTransactionFailurePurgesTransactionFromCache) {
@@ -58,6 +58,12 @@ namespace catapult { namespace sync {
 	namespace {
 		// region utils
 
+		// minimum number of transactions processed by a single worker of a data parallel consumer stage
+		constexpr size_t Min_Parallel_Partition_Size = 32;
+
+		// number of blocks beyond the executing block for which notifications are published ahead of time during sync
+		constexpr size_t Num_Sync_Lookahead_Blocks = 2;
+
 		ConsumerDispatcherOptions CreateBlockConsumerDispatcherOptions(const config::NodeConfiguration& config) {
 			auto options = ConsumerDispatcherOptions("block dispatcher", config.BlockDisruptorSize);
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
@@ -111,18 +117,24 @@ namespace catapult { namespace sync {
 
 		BlockChainProcessor CreateSyncProcessor(
 				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
-			return CreateBlockChainProcessor(
+				const chain::ExecutionConfiguration& executionConfig,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+			return CreatePipelinedBlockChainProcessor(
 					[&blockChainConfig](const cache::ReadOnlyCatapultCache& cache) {
 						cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 						return chain::BlockHitPredicate(blockChainConfig, [view](const auto& publicKey, auto height) {
 							return view.getAccountImportanceOrDefault(publicKey, height);
 						});
 					},
-					chain::CreateBatchEntityProcessor(executionConfig));
+					executionConfig,
+					pValidatorPool,
+					Num_Sync_Lookahead_Blocks);
 		}
 
-		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockChainSyncHandlers CreateBlockChainSyncHandlers(
+				extensions::ServiceState& state,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool,
+				RollbackInfo& rollbackInfo) {
 			const auto& blockChainConfig = state.config().BlockChain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -138,7 +150,7 @@ namespace catapult { namespace sync {
 				rollbackInfo.increment();
 				undoBlockHandler(blockElement, observerState);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, CreateExecutionConfiguration(pluginManager), pValidatorPool);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -163,15 +175,19 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
-				m_consumers.push_back(CreateBlockHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
+			void addHashConsumers(const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
+						m_state.pluginManager().transactionRegistry(),
+						pParallelPolicy));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 					m_state.timeSupplier(),
 					extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
-			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
-				m_consumers.push_back(CreateBlockAddressExtractionConsumer(publisher));
+			void addPrecomputedTransactionAddressConsumer(
+					const model::NotificationPublisher& publisher,
+					const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+				m_consumers.push_back(CreateBlockAddressExtractionConsumer(publisher, pParallelPolicy));
 			}
 
 			std::shared_ptr<ConsumerDispatcher> build(
@@ -192,7 +208,8 @@ namespace catapult { namespace sync {
 						m_state.state(),
 						m_state.storage(),
 						m_state.config().BlockChain.MaxRollbackBlocks,
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						m_state.pluginManager().createNotificationPublisher(),
+						CreateBlockChainSyncHandlers(m_state, pValidatorPool, rollbackInfo)));
 
 				disruptorConsumers.push_back(CreateNewBlockConsumer(m_state.hooks().newBlockSink(), InputSource::Local));
 				return CreateConsumerDispatcher(
@@ -240,16 +257,20 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
-				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
+			void addHashConsumers(const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
+						m_state.pluginManager().transactionRegistry(),
+						pParallelPolicy));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
 						m_state.hooks().knownHashPredicate(m_state.utCache())));
 			}
 
-			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
-				m_consumers.push_back(CreateTransactionAddressExtractionConsumer(publisher));
+			void addPrecomputedTransactionAddressConsumer(
+					const model::NotificationPublisher& publisher,
+					const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+				m_consumers.push_back(CreateTransactionAddressExtractionConsumer(publisher, pParallelPolicy));
 			}
 
 			std::shared_ptr<ConsumerDispatcher> build(
@@ -315,8 +336,18 @@ namespace catapult { namespace sync {
 					CreateUtUpdaterThrottle(state.config()));
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
+			// when the accounts changed by a block are known, only unconfirmed transactions referencing them need to be revalidated,
+			// but periodically revalidate all unconfirmed transactions in order to catch other state changes (e.g. expirations)
 			auto& utUpdater = *pUtUpdater;
-			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
+			auto fullRevalidationInterval = state.config().Node.UnconfirmedTransactionsFullRevalidationInterval;
+			state.hooks().addTransactionsChangeHandler([&utUpdater, fullRevalidationInterval, numIncrementalUpdates = 0u](
+					const auto& changeInfo) mutable {
+				if (changeInfo.pChangedAddresses && ++numIncrementalUpdates < fullRevalidationInterval) {
+					utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos, *changeInfo.pChangedAddresses);
+					return;
+				}
+
+				numIncrementalUpdates = 0;
 				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
 			});
 
@@ -334,6 +365,21 @@ namespace catapult { namespace sync {
 			return pRollbackInfo;
 		}
 
+		auto CreateAndRegisterParallelPolicy(
+				extensions::ServiceLocator& locator,
+				const std::string& serviceName,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+			auto pParallelPolicy = std::make_shared<ParallelConsumerPolicy>(pPool, Min_Parallel_Partition_Size);
+			locator.registerRootedService(serviceName, pParallelPolicy);
+			return pParallelPolicy;
+		}
+
+		void AddParallelPolicyCounter(extensions::ServiceLocator& locator, const std::string& serviceName, const std::string& counterName) {
+			locator.registerServiceCounter<ParallelConsumerPolicy>(serviceName, counterName, [](const auto& parallelPolicy) {
+				return parallelPolicy.speedupPercentage();
+			});
+		}
+
 		void AddRollbackCounter(
 				extensions::ServiceLocator& locator,
 				const std::string& counterName,
@@ -355,6 +401,12 @@ namespace catapult { namespace sync {
 				extensions::AddDispatcherCounters(locator, "dispatcher.block", "BLK");
 				extensions::AddDispatcherCounters(locator, "dispatcher.transaction", "TX");
 
+				// speedup percentages of the data parallel consumer stages
+				AddParallelPolicyCounter(locator, "dispatcher.block.hash", "BLK HASH PAR");
+				AddParallelPolicyCounter(locator, "dispatcher.block.address", "BLK ADDR PAR");
+				AddParallelPolicyCounter(locator, "dispatcher.transaction.hash", "TX HASH PAR");
+				AddParallelPolicyCounter(locator, "dispatcher.transaction.address", "TX ADDR PAR");
+
 				AddRollbackCounter(locator, "RB COMMIT ALL", RollbackResult::Committed, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
@@ -370,16 +422,22 @@ namespace catapult { namespace sync {
 				// (notice that the dispatcher service group must be after the validator isolated pool in order to allow proper shutdown)
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
+				// (data parallel consumer stages split their work across the validator pool)
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(CreateAndRegisterParallelPolicy(locator, "dispatcher.block.hash", pValidatorPool));
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
-				transactionDispatcherBuilder.addHashConsumers();
+				transactionDispatcherBuilder.addHashConsumers(
+						CreateAndRegisterParallelPolicy(locator, "dispatcher.transaction.hash", pValidatorPool));
 
 				if (state.config().Node.ShouldPrecomputeTransactionAddresses) {
 					auto pPublisher = state.pluginManager().createNotificationPublisher();
-					blockDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
-					transactionDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
+					blockDispatcherBuilder.addPrecomputedTransactionAddressConsumer(
+							*pPublisher,
+							CreateAndRegisterParallelPolicy(locator, "dispatcher.block.address", pValidatorPool));
+					transactionDispatcherBuilder.addPrecomputedTransactionAddressConsumer(
+							*pPublisher,
+							CreateAndRegisterParallelPolicy(locator, "dispatcher.transaction.address", pValidatorPool));
 					locator.registerRootedService("dispatcher.notificationPublisher", std::move(pPublisher));
 				}
 
@@ -53,9 +53,33 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
+			chainSynchronizerConfig.MaxHelperPeers = config.Node.MaxHelperPeersPerSyncAttempt;
 			return chainSynchronizerConfig;
 		}
 
+		chain::RemoteChainApisSupplier CreateRemoteChainApisSupplier(
+				const extensions::ServiceState& state,
+				net::PacketIoPicker& packetIoPicker) {
+			auto syncTimeout = state.config().Node.SyncTimeout;
+			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
+			return [&packetIoPicker, &transactionRegistry, syncTimeout](auto count) {
+				std::vector<std::shared_ptr<const api::RemoteChainApi>> remoteChainApis;
+				for (auto i = 0u; i < count; ++i) {
+					auto packetIoPair = packetIoPicker.pickOne(syncTimeout);
+					if (!packetIoPair)
+						break;
+
+					// the packet io pair is captured by the deleter so that the peer is not released before the api is destroyed
+					auto pRemoteChainApi = api::CreateRemoteChainApi(*packetIoPair.io(), transactionRegistry);
+					remoteChainApis.push_back(std::shared_ptr<const api::RemoteChainApi>(
+							pRemoteChainApi.release(),
+							[packetIoPair](const auto* pApi) { delete pApi; }));
+				}
+
+				return remoteChainApis;
+			};
+		}
+
 		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& config = state.config();
 			auto chainSynchronizer = chain::CreateChainSynchronizer(
@@ -64,7 +88,8 @@ namespace catapult { namespace sync {
 							[&score = state.score()]() { return score.get(); },
 							config.Node.MaxBlocksPerSyncAttempt),
 					CreateChainSynchronizerConfiguration(config),
-					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
+					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source),
+					CreateRemoteChainApisSupplier(state, packetWriters));
 
 			thread::Task task;
 			task.Name = "synchronizer task";
@@ -79,7 +104,7 @@ namespace catapult { namespace sync {
 
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			auto utSynchronizer = chain::CreateUtSynchronizer(
-					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
+					[&cache = state.utCache()]() { return cache.snapshot()->shortHashes(); },
 					state.hooks().transactionRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
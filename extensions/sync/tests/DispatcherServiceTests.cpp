@@ -43,8 +43,8 @@ namespace catapult { namespace sync {
 #define TEST_CLASS DispatcherServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 8u;
+		constexpr auto Num_Expected_Services = 7u;
+		constexpr auto Num_Expected_Counters = 14u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -245,6 +245,8 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.batch"));
 		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.utUpdater"));
 		EXPECT_TRUE(!!context.locator().service<void>("rollbacks"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.block.hash"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.hash"));
 
 		// - all counters should be zero
 		EXPECT_EQ(0u, context.counter(Block_Elements_Counter_Name));
@@ -306,15 +308,17 @@ namespace catapult { namespace sync {
 		context.boot();
 
 		// Assert:
-		EXPECT_EQ(Num_Expected_Services + 1, context.locator().numServices());
+		EXPECT_EQ(Num_Expected_Services + 3, context.locator().numServices());
 		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(7u, GetBlockDispatcherStatus(context.locator()).Size);
 		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
 
-		// - notification publisher service should exist
+		// - notification publisher and address extraction parallel policy services should exist
 		EXPECT_TRUE(!!context.locator().service<model::NotificationPublisher>("dispatcher.notificationPublisher"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.block.address"));
+		EXPECT_TRUE(!!context.locator().service<void>("dispatcher.transaction.address"));
 	}
 
 	TEST(TEST_CLASS, CanShutdownService) {
@@ -25,6 +25,7 @@
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/ImportanceHeight.h"
+#include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
@@ -434,4 +435,84 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region throttling - eviction by UtUpdater
+
+	namespace {
+		constexpr uint32_t Eviction_Cache_Size = 3;
+
+		void AssertEvictionByUtUpdater(Importance signerImportance, bool shouldEvict) {
+			// Arrange: prepare account state cache
+			auto catapultCache = CreateCatapultCacheWithImportanceGrouping(100);
+			std::vector<Key> cachedSigners;
+			Key signer;
+			{
+				auto delta = catapultCache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				for (const auto* pAccountState : SeedAccountStateCache(accountStateCacheDelta, Eviction_Cache_Size, Importance()))
+					cachedSigners.push_back(pAccountState->PublicKey);
+
+				signer = AddAccount(accountStateCacheDelta, signerImportance).PublicKey;
+				catapultCache.commit(Height(1));
+			}
+
+			// - fill a fee prioritized cache with low paying transactions
+			cache::MemoryUtCache transactionsCache(cache::MemoryCacheOptions(1024, Eviction_Cache_Size, true));
+			std::vector<Hash256> cachedHashes;
+			for (const auto& cachedSigner : cachedSigners) {
+				auto transactionInfo = CreateTransactionInfo(cachedSigner, Amount(10));
+				cachedHashes.push_back(transactionInfo.EntityHash);
+				transactionsCache.modifier().add(transactionInfo);
+			}
+
+			// - throttle based on importance as soon as the cache contains more than a single transaction
+			SpamThrottleConfiguration throttleConfig(Amount(10'000'000), Importance(1'000'000), Eviction_Cache_Size, 1);
+			test::MockExecutionConfiguration executionConfig;
+			std::vector<Hash256> failedHashes;
+			chain::UtUpdater updater(
+					transactionsCache,
+					catapultCache,
+					executionConfig.Config,
+					[]() { return Timestamp(); },
+					[&failedHashes](const auto&, const auto& hash, auto) { failedHashes.push_back(hash); },
+					CreateTransactionSpamThrottle(throttleConfig, [](const auto&) { return false; }));
+
+			// - create a transaction that pays more than all cached transactions
+			auto transactionInfo = CreateTransactionInfo(signer, Amount(100));
+			std::vector<model::TransactionInfo> transactionInfos;
+			transactionInfos.push_back(transactionInfo.copy());
+
+			// Act:
+			updater.update(transactionInfos);
+
+			// Assert:
+			auto view = transactionsCache.view();
+			EXPECT_EQ(Eviction_Cache_Size, view.size());
+			ASSERT_EQ(1u, failedHashes.size());
+			if (shouldEvict) {
+				// - the new transaction replaced a cached transaction
+				EXPECT_TRUE(view.contains(transactionInfo.EntityHash));
+				EXPECT_NE(cachedHashes.cend(), std::find(cachedHashes.cbegin(), cachedHashes.cend(), failedHashes[0]));
+				EXPECT_FALSE(view.contains(failedHashes[0]));
+			} else {
+				// - the new transaction was dropped and all cached transactions were kept
+				EXPECT_FALSE(view.contains(transactionInfo.EntityHash));
+				EXPECT_EQ(transactionInfo.EntityHash, failedHashes[0]);
+				for (const auto& hash : cachedHashes)
+					EXPECT_TRUE(view.contains(hash));
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, UtUpdaterEvictsTransactionWhenThrottleAcceptsTransactionAfterEviction) {
+		// Act + Assert: the importance of the signer is high enough to add a transaction to the cache with one free slot
+		AssertEvictionByUtUpdater(Importance(100'000), true);
+	}
+
+	TEST(TEST_CLASS, UtUpdaterDoesNotEvictTransactionWhenThrottleRejectsTransactionAfterEviction) {
+		// Act + Assert: the signer has no importance, so the transaction is rejected even with one free slot
+		AssertEvictionByUtUpdater(Importance(), false);
+	}
+
+	// endregion
 }}
@@ -26,7 +26,9 @@
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/ChainHandlers.h"
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/io/BlockStorageCache.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/MultiServicePool.h"
 
 namespace catapult { namespace syncsource {
 
@@ -41,17 +43,36 @@ namespace catapult { namespace syncsource {
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
 			handlers::UtRetriever UtRetriever;
+			handlers::BlocksPrefetcher BlocksPrefetcher;
 		};
 
-		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
+		handlers::BlocksPrefetcher CreateBlocksPrefetcher(const io::BlockStorageCache& storage, thread::MultiServicePool& pool) {
+			// read ahead on a dedicated thread so that the handler threads are not blocked by the additional reads
+			auto pPrefetchPool = pool.pushIsolatedPool("block prefetcher", 1);
+			return [&storage, pPrefetchPoolWeak = std::weak_ptr<thread::IoServiceThreadPool>(pPrefetchPool)](auto height, auto numBlocks) {
+				auto pPrefetchPool = pPrefetchPoolWeak.lock();
+				if (!pPrefetchPool)
+					return;
+
+				pPrefetchPool->service().post([&storage, height, numBlocks]() {
+					// use a separate view for each block so that writers are never blocked for long
+					for (auto i = 0u; i < numBlocks; ++i)
+						storage.view().prefetch(height + Height(i), 1);
+				});
+			};
+		}
+
+		HandlersConfiguration CreateHandlersConfiguration(extensions::ServiceState& state) {
 			HandlersConfiguration config;
 			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks());
 
 			config.ChainScoreSupplier = [&chainScore = state.score()]() { return chainScore.get(); };
 			config.UtRetriever = [&cache = state.utCache()](const auto& shortHashes) {
-				return cache.view().unknownTransactions(shortHashes);
+				return cache.snapshot()->unknownTransactions(shortHashes);
 			};
 
+			config.BlocksPrefetcher = CreateBlocksPrefetcher(state.storage(), state.pool());
+
 			SetConfig(config.BlocksHandlerConfig, state.config().Node);
 			return config;
 		}
@@ -66,7 +87,7 @@ namespace catapult { namespace syncsource {
 
 			handlers::RegisterChainInfoHandler(handlers, storage, config.ChainScoreSupplier);
 			handlers::RegisterBlockHashesHandler(handlers, storage, static_cast<uint32_t>(config.BlocksHandlerConfig.MaxBlocks));
-			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
+			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig, config.BlocksPrefetcher);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
 		}
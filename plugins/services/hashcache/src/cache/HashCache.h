@@ -22,6 +22,7 @@
 #include "HashCacheDelta.h"
 #include "HashCacheView.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/TimestampedHashFilter.h"
 
 namespace catapult { namespace cache {
 
@@ -31,10 +32,28 @@ namespace catapult { namespace cache {
 	/// \note The cache can be pruned according to the retention time.
 	class BasicHashCache : public HashBasicCache {
 	public:
-		/// Creates a cache around \a config with the specified retention time (\a retentionTime).
-		explicit BasicHashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
+		/// Creates a cache around \a config with the specified retention time (\a retentionTime)
+		/// that adds all committed hashes to \a pHashFilter.
+		explicit BasicHashCache(
+				const CacheConfiguration& config,
+				const utils::TimeSpan& retentionTime,
+				const std::shared_ptr<TimestampedHashFilter>& pHashFilter)
 				: HashBasicCache(config, HashCacheTypes::Options{ retentionTime })
+				, m_pHashFilter(pHashFilter)
 		{}
+
+	public:
+		/// Commits all pending changes from \a delta to the underlying storage.
+		void commit(const CacheDeltaType& delta) {
+			// removed hashes are left in the filter because it can only be used to rule out hashes
+			for (const auto& timestampedHash : delta.addedElements())
+				m_pHashFilter->insert(timestampedHash.Time, timestampedHash.Hash);
+
+			HashBasicCache::commit(delta);
+		}
+
+	private:
+		std::shared_ptr<TimestampedHashFilter> m_pHashFilter;
 	};
 
 	/// Synchronized cache composed of timestamped hashes of (transaction) elements.
@@ -45,7 +64,36 @@ namespace catapult { namespace cache {
 	public:
 		/// Creates a cache around \a config with the specified retention time (\a retentionTime).
 		explicit HashCache(const CacheConfiguration& config, const utils::TimeSpan& retentionTime)
-				: SynchronizedCache<BasicHashCache>(BasicHashCache(config, retentionTime))
+				: HashCache(config, retentionTime, CreateHashFilter(retentionTime))
 		{}
+
+	private:
+		HashCache(
+				const CacheConfiguration& config,
+				const utils::TimeSpan& retentionTime,
+				const std::shared_ptr<TimestampedHashFilter>& pHashFilter)
+				: SynchronizedCache<BasicHashCache>(BasicHashCache(config, retentionTime, pHashFilter))
+				, m_pHashFilter(pHashFilter)
+		{}
+
+	public:
+		/// Gets a lock-free filter of all hashes committed to this cache.
+		/// \note The filter is not updated when hashes are removed, so it can only be used to rule out hashes.
+		const TimestampedHashFilter& hashFilter() const {
+			return *m_pHashFilter;
+		}
+
+	private:
+		static std::shared_ptr<TimestampedHashFilter> CreateHashFilter(const utils::TimeSpan& retentionTime) {
+			// hashes can have timestamps up to one retention time in the past and (at most) one retention time in the future,
+			// so windows are sized to let the filter cover more than twice the retention time
+			constexpr size_t Num_Windows = 10;
+			constexpr size_t Num_Blocks_Per_Window = 16 * 1024;
+			auto windowDuration = utils::TimeSpan::FromMilliseconds(std::max<uint64_t>(1, (retentionTime.millis() + 3) / 4));
+			return std::make_shared<TimestampedHashFilter>(windowDuration, Num_Windows, Num_Blocks_Per_Window);
+		}
+
+	private:
+		std::shared_ptr<TimestampedHashFilter> m_pHashFilter;
 	};
 }}
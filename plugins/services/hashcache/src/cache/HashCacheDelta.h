@@ -50,6 +50,11 @@ namespace catapult { namespace cache {
 		/// Gets the pruning boundary that is used during commit.
 		deltaset::PruningBoundary<ValueType> pruningBoundary() const;
 
+		/// Gets all timestamped hashes added to this delta.
+		const auto& addedElements() const {
+			return m_pOrderedDelta->deltas().Added;
+		}
+
 	public:
 		/// Removes all timestamped hashes that have timestamps prior to the given \a timestamp minus the retention time.
 		void prune(Timestamp timestamp);
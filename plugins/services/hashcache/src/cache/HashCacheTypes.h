@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "TimeBucketedHashSet.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
@@ -62,7 +63,9 @@ namespace catapult { namespace cache {
 	};
 
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	/// \note Hashes are stored in time buckets so that pruning can drop whole buckets.
+	struct HashCacheTypes
+			: public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor, TimeBucketedHashSet>, std::true_type> {
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
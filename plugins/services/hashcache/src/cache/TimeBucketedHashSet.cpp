@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TimeBucketedHashSet.h"
+
+namespace catapult { namespace cache {
+
+	// region const_iterator
+
+	TimeBucketedHashSet::const_iterator::const_iterator(
+			BucketMap::const_iterator bucketIter,
+			BucketType::const_iterator elementIter,
+			BucketMap::const_iterator bucketEnd)
+			: m_bucketIter(bucketIter)
+			, m_elementIter(elementIter)
+			, m_bucketEnd(bucketEnd)
+	{}
+
+	bool TimeBucketedHashSet::const_iterator::operator==(const const_iterator& rhs) const {
+		// element iterators are only meaningful when not at the end
+		return m_bucketIter == rhs.m_bucketIter && (m_bucketEnd == m_bucketIter || m_elementIter == rhs.m_elementIter);
+	}
+
+	bool TimeBucketedHashSet::const_iterator::operator!=(const const_iterator& rhs) const {
+		return !(*this == rhs);
+	}
+
+	TimeBucketedHashSet::const_iterator::reference TimeBucketedHashSet::const_iterator::operator*() const {
+		return *m_elementIter;
+	}
+
+	TimeBucketedHashSet::const_iterator::pointer TimeBucketedHashSet::const_iterator::operator->() const {
+		return &*m_elementIter;
+	}
+
+	TimeBucketedHashSet::const_iterator& TimeBucketedHashSet::const_iterator::operator++() {
+		// buckets are never empty, so the first element of the next bucket (if any) is always valid
+		if (m_bucketIter->second.cend() == ++m_elementIter) {
+			if (m_bucketEnd != ++m_bucketIter)
+				m_elementIter = m_bucketIter->second.cbegin();
+		}
+
+		return *this;
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::const_iterator::operator++(int) {
+		auto copy = *this;
+		++*this;
+		return copy;
+	}
+
+	// endregion
+
+	// region TimeBucketedHashSet
+
+	TimeBucketedHashSet::TimeBucketedHashSet() : m_size(0)
+	{}
+
+	bool TimeBucketedHashSet::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TimeBucketedHashSet::size() const {
+		return m_size;
+	}
+
+	size_t TimeBucketedHashSet::numBuckets() const {
+		return m_buckets.size();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::begin() const {
+		return cbegin();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::end() const {
+		return cend();
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::cbegin() const {
+		return m_buckets.empty() ? cend() : makeIterator(m_buckets.cbegin(), m_buckets.cbegin()->second.cbegin());
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::cend() const {
+		return makeIterator(m_buckets.cend(), BucketType::const_iterator());
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::find(const value_type& value) const {
+		auto bucketIter = m_buckets.find(GetBucketId(value.Time));
+		if (m_buckets.cend() == bucketIter)
+			return cend();
+
+		auto elementIter = bucketIter->second.find(value);
+		return bucketIter->second.cend() == elementIter ? cend() : makeIterator(bucketIter, elementIter);
+	}
+
+	size_t TimeBucketedHashSet::count(const value_type& value) const {
+		return cend() == find(value) ? 0 : 1;
+	}
+
+	std::pair<TimeBucketedHashSet::iterator, bool> TimeBucketedHashSet::insert(const value_type& value) {
+		auto bucketIter = m_buckets.emplace(GetBucketId(value.Time), BucketType()).first;
+		auto result = bucketIter->second.insert(value);
+		if (result.second)
+			++m_size;
+
+		return std::make_pair(makeIterator(bucketIter, result.first), result.second);
+	}
+
+	TimeBucketedHashSet::iterator TimeBucketedHashSet::insert(const_iterator, const value_type& value) {
+		return insert(value).first;
+	}
+
+	TimeBucketedHashSet::iterator TimeBucketedHashSet::erase(const_iterator position) {
+		// std::map::erase with a const_iterator returns a (mutable) iterator, which is needed to modify the bucket
+		auto bucketIter = m_buckets.erase(position.m_bucketIter, position.m_bucketIter);
+		auto elementIter = bucketIter->second.erase(position.m_elementIter);
+		--m_size;
+
+		if (bucketIter->second.empty())
+			bucketIter = m_buckets.erase(bucketIter);
+		else if (bucketIter->second.cend() != elementIter)
+			return makeIterator(bucketIter, elementIter);
+		else
+			++bucketIter;
+
+		return m_buckets.cend() == bucketIter ? cend() : makeIterator(bucketIter, bucketIter->second.cbegin());
+	}
+
+	size_t TimeBucketedHashSet::erase(const value_type& value) {
+		auto iter = find(value);
+		if (cend() == iter)
+			return 0;
+
+		erase(iter);
+		return 1;
+	}
+
+	void TimeBucketedHashSet::clear() {
+		m_buckets.clear();
+		m_size = 0;
+	}
+
+	void TimeBucketedHashSet::prune(const value_type& boundary) {
+		// drop all buckets that end before the boundary bucket
+		auto boundaryBucketId = GetBucketId(boundary.Time);
+		auto boundaryBucketIter = m_buckets.lower_bound(boundaryBucketId);
+		for (auto iter = m_buckets.begin(); boundaryBucketIter != iter; ++iter)
+			m_size -= iter->second.size();
+
+		m_buckets.erase(m_buckets.begin(), boundaryBucketIter);
+
+		// only elements in the boundary bucket need to be compared individually
+		if (m_buckets.end() == boundaryBucketIter || boundaryBucketId != boundaryBucketIter->first)
+			return;
+
+		auto& bucket = boundaryBucketIter->second;
+		for (auto iter = bucket.cbegin(); bucket.cend() != iter;) {
+			if (*iter < boundary) {
+				iter = bucket.erase(iter);
+				--m_size;
+			} else {
+				++iter;
+			}
+		}
+
+		if (bucket.empty())
+			m_buckets.erase(boundaryBucketIter);
+	}
+
+	uint64_t TimeBucketedHashSet::GetBucketId(Timestamp timestamp) {
+		return timestamp.unwrap() / Bucket_Duration_Millis;
+	}
+
+	TimeBucketedHashSet::const_iterator TimeBucketedHashSet::makeIterator(
+			BucketMap::const_iterator bucketIter,
+			BucketType::const_iterator elementIter) const {
+		return const_iterator(bucketIter, elementIter, m_buckets.cend());
+	}
+
+	// endregion
+
+	void PruneBaseSet(TimeBucketedHashSet& set, const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary) {
+		set.prune(pruningBoundary.value());
+	}
+}}
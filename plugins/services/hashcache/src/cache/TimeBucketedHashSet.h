@@ -0,0 +1,178 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/deltaset/PruningBoundary.h"
+#include "catapult/state/TimestampedHash.h"
+#include "catapult/utils/FlatHashSet.h"
+#include "catapult/utils/Hashers.h"
+#include <map>
+
+namespace catapult { namespace cache {
+
+	/// Set of timestamped hashes that groups hashes by timestamp into buckets of flat hash sets.
+	/// \note Lookups only probe the single bucket containing the timestamp and pruning drops whole buckets.
+	/// \note Elements are ordered by bucket, but elements within a bucket are unordered.
+	class TimeBucketedHashSet {
+	private:
+		struct TimestampedHashHasher {
+			size_t operator()(const state::TimestampedHash& timestampedHash) const {
+				return utils::ArrayHasher<state::TimestampedHash::HashType>()(timestampedHash.Hash);
+			}
+		};
+
+		using BucketType = utils::FlatHashSet<state::TimestampedHash, TimestampedHashHasher>;
+		using BucketMap = std::map<uint64_t, BucketType>;
+
+	public:
+		using key_type = state::TimestampedHash;
+		using value_type = state::TimestampedHash;
+		using size_type = size_t;
+
+		/// Duration of the time range covered by a single bucket.
+		static constexpr uint64_t Bucket_Duration_Millis = 60'000;
+
+	public:
+		/// Const iterator.
+		class const_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = const state::TimestampedHash;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates a default iterator.
+			const_iterator() = default;
+
+			/// Creates an iterator pointing to \a elementIter in \a bucketIter with end bucket \a bucketEnd.
+			const_iterator(BucketMap::const_iterator bucketIter, BucketType::const_iterator elementIter, BucketMap::const_iterator bucketEnd);
+
+		public:
+			/// Returns \c true if this iterator is equal to \a rhs.
+			bool operator==(const const_iterator& rhs) const;
+
+			/// Returns \c true if this iterator is not equal to \a rhs.
+			bool operator!=(const const_iterator& rhs) const;
+
+		public:
+			/// Returns a reference to the current element.
+			reference operator*() const;
+
+			/// Returns a pointer to the current element.
+			pointer operator->() const;
+
+		public:
+			/// Advances the iterator to the next element.
+			const_iterator& operator++();
+
+			/// Advances the iterator to the next element.
+			const_iterator operator++(int);
+
+		private:
+			BucketMap::const_iterator m_bucketIter;
+			BucketType::const_iterator m_elementIter;
+			BucketMap::const_iterator m_bucketEnd;
+
+		private:
+			friend class TimeBucketedHashSet;
+		};
+
+		/// Iterator (elements are never mutable because they are hashed).
+		using iterator = const_iterator;
+
+	public:
+		/// Creates an empty set.
+		TimeBucketedHashSet();
+
+	public:
+		/// Gets a value indicating whether or not the set is empty.
+		bool empty() const;
+
+		/// Gets the number of elements in the set.
+		size_t size() const;
+
+		/// Gets the number of buckets in the set.
+		size_t numBuckets() const;
+
+	public:
+		/// Returns a const iterator to the first element.
+		const_iterator begin() const;
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator end() const;
+
+		/// Returns a const iterator to the first element.
+		const_iterator cbegin() const;
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator cend() const;
+
+	public:
+		/// Searches for \a value in the set.
+		const_iterator find(const value_type& value) const;
+
+		/// Gets the number of elements equal to \a value (zero or one).
+		size_t count(const value_type& value) const;
+
+	public:
+		/// Inserts \a value into the set if it is not already in the set.
+		std::pair<iterator, bool> insert(const value_type& value);
+
+		/// Inserts \a value into the set if it is not already in the set.
+		/// \note The hint is ignored and only provided for compatibility with std::set.
+		iterator insert(const_iterator hint, const value_type& value);
+
+		/// Inserts all values in the range [\a first, \a last) into the set.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+	public:
+		/// Erases the element at \a position and returns an iterator to the following element.
+		iterator erase(const_iterator position);
+
+		/// Erases the element equal to \a value and returns the number of erased elements (zero or one).
+		size_t erase(const value_type& value);
+
+		/// Erases all elements.
+		void clear();
+
+		/// Erases all elements less than \a boundary.
+		/// \note Buckets completely before \a boundary are dropped without visiting their elements.
+		void prune(const value_type& boundary);
+
+	private:
+		static uint64_t GetBucketId(Timestamp timestamp);
+
+		const_iterator makeIterator(BucketMap::const_iterator bucketIter, BucketType::const_iterator elementIter) const;
+
+	private:
+		BucketMap m_buckets;
+		size_t m_size;
+	};
+
+	/// Prunes all elements less than \a pruningBoundary from \a set.
+	/// \note This overload (found via argument dependent lookup) is used by OrderedSet when committing.
+	void PruneBaseSet(TimeBucketedHashSet& set, const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary);
+}}
@@ -45,6 +45,9 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("HASH C"), [&cache]() {
 				return cache.sub<cache::HashCache>().createView()->size();
 			});
+			counters.emplace_back(utils::DiagnosticCounterId("HASH C FPR"), [&cache]() {
+				return cache.sub<cache::HashCache>().hashFilter().falsePositiveRate();
+			});
 		});
 
 		manager.addStatefulValidatorHook([](auto& builder) {
@@ -67,5 +67,20 @@ namespace catapult { namespace cache {
 		EXPECT_FALSE(HashCacheContains(cache, Timestamp(5), test::GenerateRandomData<Hash256_Size>()));
 	}
 
+	TEST(TEST_CLASS, HashCacheContains_UsesHashFilterToShortCircuitUnknownHashes) {
+		// Arrange:
+		auto cache = test::HashCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		auto hash = PopulateHashCache(cache);
+
+		// Act:
+		HashCacheContains(cache, Timestamp(5), hash);
+		HashCacheContains(cache, Timestamp(5), test::GenerateRandomData<Hash256_Size>());
+
+		// Assert: only the unknown hash was (definitely) ruled out by the filter
+		const auto& hashFilter = cache.sub<HashCache>().hashFilter();
+		EXPECT_EQ(1u, hashFilter.numDefiniteMisses());
+		EXPECT_EQ(0u, hashFilter.numFalsePositives());
+	}
+
 	// endregion
 }}
@@ -61,7 +61,7 @@ namespace catapult { namespace cache {
 	DEFINE_CACHE_CONTAINS_TESTS(HashCacheMixinTraits, ViewAccessor, _View)
 	DEFINE_CACHE_CONTAINS_TESTS(HashCacheMixinTraits, DeltaAccessor, _Delta)
 
-	DEFINE_CACHE_ITERATION_TESTS_ORDERING(HashCacheMixinTraits, ViewAccessor, Ordered, _View)
+	DEFINE_CACHE_ITERATION_TESTS(HashCacheMixinTraits, ViewAccessor, _View)
 
 	DEFINE_CACHE_MUTATION_TESTS(HashCacheMixinTraits, DeltaAccessor, _Delta)
 
@@ -110,5 +110,83 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(state::TimestampedHash::HashType(), pruningBoundary.value().Hash);
 	}
 
+	namespace {
+		state::TimestampedHash CreateTimestampedHash(uint64_t minutes, uint8_t id) {
+			return state::TimestampedHash(Timestamp(minutes * 60 * 1000 + id), { { id } });
+		}
+	}
+
+	TEST(TEST_CLASS, CommitPrunesAllHashesBeforePruningBoundary) {
+		// Arrange: add hashes spread across multiple minutes
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromMinutes(10));
+		{
+			auto delta = cache.createDelta();
+			for (auto minutes = 0u; minutes < 20; ++minutes) {
+				for (uint8_t id = 0; id < 5; ++id)
+					delta->insert(CreateTimestampedHash(minutes, id));
+			}
+
+			cache.commit();
+		}
+
+		// Act: prune everything before 7 minutes and 2 milliseconds (17 minutes minus retention time)
+		{
+			auto delta = cache.createDelta();
+			delta->prune(Timestamp((17 * 60 * 1000) + 2));
+			cache.commit();
+		}
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(13u * 5 - 2, view->size());
+		EXPECT_FALSE(view->contains(CreateTimestampedHash(6, 4)));
+		EXPECT_FALSE(view->contains(CreateTimestampedHash(7, 1)));
+		EXPECT_TRUE(view->contains(CreateTimestampedHash(7, 2)));
+		EXPECT_TRUE(view->contains(CreateTimestampedHash(19, 4)));
+	}
+
+	// endregion
+
+	// region hashFilter
+
+	TEST(TEST_CLASS, CommitAddsAllAddedHashesToHashFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(1));
+		auto timestampedHash = state::TimestampedHash(Timestamp(1000), test::GenerateRandomData<Hash256_Size>());
+		{
+			auto delta = cache.createDelta();
+			delta->insert(timestampedHash);
+
+			// Act:
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_TRUE(cache.hashFilter().mayContain(timestampedHash.Time, timestampedHash.Hash));
+		EXPECT_FALSE(cache.hashFilter().mayContain(timestampedHash.Time, test::GenerateRandomData<Hash256_Size>()));
+	}
+
+	TEST(TEST_CLASS, CommitDoesNotRemoveRemovedHashesFromHashFilter) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(1));
+		auto timestampedHash = state::TimestampedHash(Timestamp(1000), test::GenerateRandomData<Hash256_Size>());
+		{
+			auto delta = cache.createDelta();
+			delta->insert(timestampedHash);
+			cache.commit();
+		}
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->remove(timestampedHash);
+			cache.commit();
+		}
+
+		// Assert: filter can only be used to rule out hashes
+		EXPECT_FALSE(cache.createView()->contains(timestampedHash));
+		EXPECT_TRUE(cache.hashFilter().mayContain(timestampedHash.Time, timestampedHash.Hash));
+	}
+
 	// endregion
 }}
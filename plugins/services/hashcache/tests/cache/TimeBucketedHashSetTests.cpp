@@ -0,0 +1,266 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/TimeBucketedHashSet.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimeBucketedHashSetTests
+
+	namespace {
+		constexpr auto Bucket_Duration = TimeBucketedHashSet::Bucket_Duration_Millis;
+
+		state::TimestampedHash CreateTimestampedHash(uint64_t time, uint8_t id) {
+			return state::TimestampedHash(Timestamp(time), { { id, static_cast<uint8_t>(time) } });
+		}
+
+		std::vector<state::TimestampedHash> SeedSet(TimeBucketedHashSet& set, size_t numBuckets, uint8_t numHashesPerBucket) {
+			// add hashes at the start, middle and end of each bucket
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto i = 0u; i < numBuckets; ++i) {
+				for (uint8_t id = 0; id < numHashesPerBucket; ++id) {
+					auto offset = (Bucket_Duration - 1) * (id % 3) / 2;
+					timestampedHashes.push_back(CreateTimestampedHash(i * Bucket_Duration + offset, id));
+					set.insert(timestampedHashes.back());
+				}
+			}
+
+			return timestampedHashes;
+		}
+
+		std::set<state::TimestampedHash> ToOrderedSet(const TimeBucketedHashSet& set) {
+			return std::set<state::TimestampedHash>(set.cbegin(), set.cend());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptySet) {
+		// Act:
+		TimeBucketedHashSet set;
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.size());
+		EXPECT_EQ(0u, set.numBuckets());
+		EXPECT_EQ(set.cend(), set.cbegin());
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(0, 0)));
+	}
+
+	// endregion
+
+	// region insert / find
+
+	TEST(TEST_CLASS, CanInsertSingleElement) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		auto timestampedHash = CreateTimestampedHash(Bucket_Duration + 7, 3);
+
+		// Act:
+		auto result = set.insert(timestampedHash);
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(timestampedHash, *result.first);
+
+		EXPECT_EQ(1u, set.size());
+		EXPECT_EQ(1u, set.numBuckets());
+		EXPECT_EQ(1u, set.count(timestampedHash));
+		EXPECT_EQ(timestampedHash, *set.find(timestampedHash));
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotAddDuplicateElement) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		auto timestampedHash = CreateTimestampedHash(Bucket_Duration + 7, 3);
+		set.insert(timestampedHash);
+
+		// Act:
+		auto result = set.insert(timestampedHash);
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(timestampedHash, *result.first);
+		EXPECT_EQ(1u, set.size());
+	}
+
+	TEST(TEST_CLASS, CanInsertElementsIntoMultipleBuckets) {
+		// Act:
+		TimeBucketedHashSet set;
+		auto timestampedHashes = SeedSet(set, 5, 10);
+
+		// Assert:
+		EXPECT_EQ(50u, set.size());
+		EXPECT_EQ(5u, set.numBuckets());
+		EXPECT_EQ(std::set<state::TimestampedHash>(timestampedHashes.cbegin(), timestampedHashes.cend()), ToOrderedSet(set));
+		for (const auto& timestampedHash : timestampedHashes)
+			EXPECT_EQ(1u, set.count(timestampedHash)) << timestampedHash;
+	}
+
+	TEST(TEST_CLASS, FindRequiresMatchingTimestamp) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		auto timestampedHash = CreateTimestampedHash(Bucket_Duration + 7, 3);
+		set.insert(timestampedHash);
+
+		// Act + Assert: same hash with timestamps in the same bucket and in another bucket
+		auto hash1 = timestampedHash;
+		hash1.Time = Timestamp(Bucket_Duration + 8);
+		auto hash2 = timestampedHash;
+		hash2.Time = Timestamp(2 * Bucket_Duration + 7);
+
+		EXPECT_EQ(set.cend(), set.find(hash1));
+		EXPECT_EQ(set.cend(), set.find(hash2));
+	}
+
+	TEST(TEST_CLASS, IterationVisitsBucketsInTimeOrder) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		SeedSet(set, 5, 10);
+
+		// Act:
+		std::vector<uint64_t> bucketIds;
+		for (const auto& timestampedHash : set)
+			bucketIds.push_back(timestampedHash.Time.unwrap() / Bucket_Duration);
+
+		// Assert:
+		EXPECT_EQ(50u, bucketIds.size());
+		EXPECT_TRUE(std::is_sorted(bucketIds.cbegin(), bucketIds.cend()));
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseElementByValue) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		auto timestampedHashes = SeedSet(set, 5, 10);
+
+		// Act:
+		auto numErased1 = set.erase(timestampedHashes[12]);
+		auto numErased2 = set.erase(timestampedHashes[12]);
+
+		// Assert:
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(0u, numErased2);
+		EXPECT_EQ(49u, set.size());
+		EXPECT_EQ(0u, set.count(timestampedHashes[12]));
+	}
+
+	TEST(TEST_CLASS, EraseOfLastElementInBucketRemovesBucket) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		auto timestampedHashes = SeedSet(set, 3, 2);
+
+		// Act:
+		set.erase(timestampedHashes[2]);
+		set.erase(timestampedHashes[3]);
+
+		// Assert:
+		EXPECT_EQ(4u, set.size());
+		EXPECT_EQ(2u, set.numBuckets());
+	}
+
+	TEST(TEST_CLASS, CanEraseAllElementsByIterator) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		SeedSet(set, 5, 10);
+
+		// Act:
+		auto numErased = 0u;
+		for (auto iter = set.cbegin(); set.cend() != iter; ++numErased)
+			iter = set.erase(iter);
+
+		// Assert:
+		EXPECT_EQ(50u, numErased);
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.numBuckets());
+	}
+
+	TEST(TEST_CLASS, ClearRemovesAllElements) {
+		// Arrange:
+		TimeBucketedHashSet set;
+		SeedSet(set, 5, 10);
+
+		// Act:
+		set.clear();
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.numBuckets());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	// endregion
+
+	// region prune
+
+	namespace {
+		void AssertPrune(const state::TimestampedHash& boundary, size_t expectedNumBuckets) {
+			// Arrange:
+			TimeBucketedHashSet set;
+			auto timestampedHashes = SeedSet(set, 5, 10);
+
+			// Act:
+			set.prune(boundary);
+
+			// Assert:
+			std::set<state::TimestampedHash> expectedHashes;
+			for (const auto& timestampedHash : timestampedHashes) {
+				if (!(timestampedHash < boundary))
+					expectedHashes.insert(timestampedHash);
+			}
+
+			EXPECT_EQ(expectedHashes.size(), set.size());
+			EXPECT_EQ(expectedNumBuckets, set.numBuckets());
+			EXPECT_EQ(expectedHashes, ToOrderedSet(set));
+		}
+	}
+
+	TEST(TEST_CLASS, PruneBeforeFirstBucketHasNoEffect) {
+		AssertPrune(state::TimestampedHash(Timestamp(0)), 5);
+	}
+
+	TEST(TEST_CLASS, PruneAtBucketStartDropsPreviousBuckets) {
+		AssertPrune(state::TimestampedHash(Timestamp(2 * Bucket_Duration)), 3);
+	}
+
+	TEST(TEST_CLASS, PruneWithinBucketDropsPreviousBucketsAndOlderElementsInBucket) {
+		AssertPrune(state::TimestampedHash(Timestamp(2 * Bucket_Duration + Bucket_Duration / 2)), 3);
+	}
+
+	TEST(TEST_CLASS, PruneAtBucketEndDropsBucketWhenAllElementsAreOlder) {
+		// Arrange: boundary is greater than all hashes with the last timestamp in the bucket
+		auto boundary = state::TimestampedHash(Timestamp(3 * Bucket_Duration - 1));
+		boundary.Hash.fill(0xFF);
+
+		// Act + Assert:
+		AssertPrune(boundary, 2);
+	}
+
+	TEST(TEST_CLASS, PruneAfterLastBucketDropsAllBuckets) {
+		AssertPrune(state::TimestampedHash(Timestamp(10 * Bucket_Duration)), 0);
+	}
+
+	// endregion
+}}
@@ -48,7 +48,7 @@ namespace catapult { namespace cache {
 	// endregion
 
 	public:
-		using PrimaryTypes = MutableUnorderedMapAdapter<TDescriptor, utils::ArrayHasher<IdentifierType>>;
+		using PrimaryTypes = MutableFlatMapAdapter<TDescriptor, utils::ArrayHasher<IdentifierType>>;
 		using HeightGroupingTypes = MutableUnorderedMapAdapter<HeightGroupingTypesDescriptor, utils::BaseValueHasher<Height>>;
 
 	public:
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/utils/ArraySet.h"
+#include "catapult/utils/CopyOnWrite.h"
 
 namespace catapult { namespace state {
 
@@ -35,17 +36,20 @@ namespace catapult { namespace state {
 	public:
 		/// Gets cosignatory account keys.
 		const utils::KeySet& cosignatories() const {
-			return m_cosignatories;
+			return m_cosignatories.get();
 		}
 
 		/// Gets cosignatory account keys.
+		/// \note Keys are shared with copies of this mixin until they are accessed via this accessor.
+		/// \note Read-only callers should use the const overload, which never copies.
 		utils::KeySet& cosignatories() {
-			return m_cosignatories;
+			return m_cosignatories.getMutable();
 		}
 
 		/// Returns \c true if \a key is a cosignatory.
 		bool hasCosignatory(const Key& key) const {
-			return m_cosignatories.end() != m_cosignatories.find(key);
+			const auto& cosignatories = m_cosignatories.get();
+			return cosignatories.end() != cosignatories.find(key);
 		}
 
 		/// Gets the number of cosignatories required when approving (any) transaction.
@@ -69,7 +73,7 @@ namespace catapult { namespace state {
 		}
 
 	private:
-		utils::KeySet m_cosignatories;
+		utils::CopyOnWrite<utils::KeySet> m_cosignatories;
 		uint8_t m_minApproval;
 		uint8_t m_minRemoval;
 	};
@@ -79,16 +83,18 @@ namespace catapult { namespace state {
 	public:
 		/// Gets multisig account keys.
 		const utils::KeySet& multisigAccounts() const {
-			return m_multisigAccounts;
+			return m_multisigAccounts.get();
 		}
 
 		/// Gets multisig account keys.
+		/// \note Keys are shared with copies of this mixin until they are accessed via this accessor.
+		/// \note Read-only callers should use the const overload, which never copies.
 		utils::KeySet& multisigAccounts() {
-			return m_multisigAccounts;
+			return m_multisigAccounts.getMutable();
 		}
 
 	private:
-		utils::KeySet m_multisigAccounts;
+		utils::CopyOnWrite<utils::KeySet> m_multisigAccounts;
 	};
 
 	/// Multisig entry.
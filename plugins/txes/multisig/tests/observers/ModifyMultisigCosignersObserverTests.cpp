@@ -77,7 +77,7 @@ namespace catapult { namespace observers {
 				ASSERT_TRUE(m_multisigCache.contains(accountKey))
 						<< "cache is missing account " << utils::HexFormat(accountKey);
 
-				auto& multisigEntry = m_multisigCache.get(accountKey);
+				const auto& multisigEntry = m_multisigCache.get(accountKey);
 				assertAccountsInSet(cosignatoryKeys, multisigEntry.cosignatories());
 			}
 
@@ -85,7 +85,7 @@ namespace catapult { namespace observers {
 				// Assert:
 				ASSERT_TRUE(m_multisigCache.contains(accountKey)) << "cache is missing account " << utils::HexFormat(accountKey);
 
-				auto& multisigEntry = m_multisigCache.get(accountKey);
+				const auto& multisigEntry = m_multisigCache.get(accountKey);
 				assertAccountsInSet(multisigAccountKeys, multisigEntry.multisigAccounts());
 			}
 
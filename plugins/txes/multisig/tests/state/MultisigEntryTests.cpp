@@ -105,6 +105,125 @@ namespace catapult { namespace state {
 		AssertMultisigAccounts(expectedMultisigAccounts, entry);
 	}
 
+	TEST(TEST_CLASS, CopySharesKeysUntilModified) {
+		// Arrange:
+		auto entry = MultisigEntry(test::GenerateRandomData<Key_Size>());
+		entry.cosignatories().insert(test::GenerateRandomData<Key_Size>());
+		entry.multisigAccounts().insert(test::GenerateRandomData<Key_Size>());
+
+		// Act:
+		const auto entryCopy = entry;
+
+		// Assert: the keys are shared
+		const auto& constEntry = entry;
+		EXPECT_EQ(&constEntry.cosignatories(), &entryCopy.cosignatories());
+		EXPECT_EQ(&constEntry.multisigAccounts(), &entryCopy.multisigAccounts());
+	}
+
+	TEST(TEST_CLASS, ModifyingCopyOnlyDetachesModifiedKeys) {
+		// Arrange:
+		auto entry = MultisigEntry(test::GenerateRandomData<Key_Size>());
+		auto cosignatoryKey = test::GenerateRandomData<Key_Size>();
+		entry.cosignatories().insert(cosignatoryKey);
+		entry.multisigAccounts().insert(test::GenerateRandomData<Key_Size>());
+		auto entryCopy = entry;
+
+		// Act:
+		entryCopy.cosignatories().erase(cosignatoryKey);
+
+		// Assert: only the cosignatories are detached
+		const auto& constEntry = entry;
+		const auto& constEntryCopy = entryCopy;
+		EXPECT_NE(&constEntry.cosignatories(), &constEntryCopy.cosignatories());
+		EXPECT_EQ(&constEntry.multisigAccounts(), &constEntryCopy.multisigAccounts());
+
+		AssertCosignatories({ cosignatoryKey }, entry);
+		AssertCosignatories({}, entryCopy);
+	}
+
+	namespace {
+		MultisigEntry CreateEntryWithKeys(size_t numCosignatories, size_t numMultisigAccounts) {
+			auto entry = MultisigEntry(test::GenerateRandomData<Key_Size>());
+			for (const auto& key : test::GenerateKeys(numCosignatories))
+				entry.cosignatories().insert(key);
+
+			for (const auto& key : test::GenerateKeys(numMultisigAccounts))
+				entry.multisigAccounts().insert(key);
+
+			return entry;
+		}
+
+		size_t CalculateKeyBytes(const utils::KeySet& keys) {
+			return keys.size() * Key_Size;
+		}
+
+		size_t CalculateCopiedKeyBytes(const MultisigEntry& originalEntry, const MultisigEntry& entryCopy) {
+			// key sets that are no longer shared with the original entry were copied
+			size_t numCopiedBytes = 0;
+			if (&originalEntry.cosignatories() != &entryCopy.cosignatories())
+				numCopiedBytes += CalculateKeyBytes(originalEntry.cosignatories());
+
+			if (&originalEntry.multisigAccounts() != &entryCopy.multisigAccounts())
+				numCopiedBytes += CalculateKeyBytes(originalEntry.multisigAccounts());
+
+			return numCopiedBytes;
+		}
+
+		template<typename TAction>
+		void AssertCopiedKeyBytes(size_t expectedNumCopiedKeys, TAction action) {
+			// Arrange: entry copies are made when an entry is first modified in a cache delta
+			const auto originalEntry = CreateEntryWithKeys(10, 100);
+			auto entryCopy = originalEntry;
+			auto numDeepCopyBytes = CalculateKeyBytes(originalEntry.cosignatories()) + CalculateKeyBytes(originalEntry.multisigAccounts());
+
+			// Act:
+			action(entryCopy);
+			auto numCopiedBytes = CalculateCopiedKeyBytes(originalEntry, entryCopy);
+
+			// Assert: a deep copy would always copy all keys
+			EXPECT_EQ(110u * Key_Size, numDeepCopyBytes);
+			EXPECT_EQ(expectedNumCopiedKeys * Key_Size, numCopiedBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, ReadingCopyDoesNotCopyKeys) {
+		// Assert:
+		AssertCopiedKeyBytes(0, [](const auto& entry) {
+			EXPECT_EQ(10u, entry.cosignatories().size());
+			EXPECT_EQ(100u, entry.multisigAccounts().size());
+		});
+	}
+
+	TEST(TEST_CLASS, ModifyingCopySettingsDoesNotCopyKeys) {
+		// Assert:
+		AssertCopiedKeyBytes(0, [](auto& entry) {
+			entry.setMinApproval(5);
+			entry.setMinRemoval(6);
+		});
+	}
+
+	TEST(TEST_CLASS, ModifyingCopyCosignatoriesOnlyCopiesCosignatoryKeys) {
+		// Assert:
+		AssertCopiedKeyBytes(10, [](auto& entry) {
+			entry.cosignatories().insert(test::GenerateRandomData<Key_Size>());
+		});
+	}
+
+	TEST(TEST_CLASS, ModifyingCopyMultisigAccountsOnlyCopiesMultisigAccountKeys) {
+		// Assert:
+		AssertCopiedKeyBytes(100, [](auto& entry) {
+			entry.multisigAccounts().insert(test::GenerateRandomData<Key_Size>());
+		});
+	}
+
+	TEST(TEST_CLASS, ModifyingCopyCosignatoriesAndMultisigAccountsCopiesAllKeys) {
+		// Assert:
+		AssertCopiedKeyBytes(110, [](auto& entry) {
+			entry.cosignatories().insert(test::GenerateRandomData<Key_Size>());
+			entry.multisigAccounts().insert(test::GenerateRandomData<Key_Size>());
+		});
+	}
+
 	TEST(TEST_CLASS, HasCosignatoryReturnsTrueIfKeyIsCosignatory) {
 		// Arrange:
 		auto key = test::GenerateRandomData<Key_Size>();
@@ -64,6 +64,14 @@ namespace catapult { namespace cache {
 
 				return transactionInfos;
 			}
+
+			model::TransactionInfo evict(const model::TransactionInfo& transactionInfo, const predicate<>& canEvict) override {
+				auto evictedTransactionInfo = modifier().evict(transactionInfo, canEvict);
+				if (evictedTransactionInfo)
+					remove(evictedTransactionInfo);
+
+				return evictedTransactionInfo;
+			}
 		};
 
 		using AggregateUtCache = BasicAggregateTransactionsCache<UtTraits, AggregateUtCacheModifier>;
@@ -24,13 +24,14 @@
 #include "catapult/deltaset/BaseSet.h"
 #include "catapult/deltaset/ConditionalContainer.h"
 #include "catapult/deltaset/OrderedSet.h"
+#include "catapult/utils/FlatHashMap.h"
 #include <unordered_map>
 
 namespace catapult { namespace cache {
 
 	namespace detail {
-		/// Defines cache types for an unordered map based cache.
-		template<typename TElementTraits, typename TDescriptor, typename TValueHasher>
+		/// Defines cache types for an unordered map based cache using \a TMemoryMap as the memory map.
+		template<typename TElementTraits, typename TDescriptor, typename TMemoryMap>
 		struct UnorderedMapAdapter {
 		private:
 			// TODO: this is a placeholder for a rdb column adapter
@@ -40,7 +41,7 @@ namespace catapult { namespace cache {
 				{}
 			};
 
-			using MemoryMapType = std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>;
+			using MemoryMapType = TMemoryMap;
 
 			struct Converter {
 				static constexpr auto ToKey = TDescriptor::GetKeyFromValue;
@@ -77,30 +78,44 @@ namespace catapult { namespace cache {
 	using MutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
 		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor,
-		TValueHasher>;
+		std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
 
 	/// Defines cache types for an unordered immutable map based cache.
 	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
 	using ImmutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor,
-		TValueHasher>;
+		std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
+
+	/// Defines cache types for a flat (open addressing) mutable map based cache.
+	/// \note This is preferable for large caches with fixed width keys.
+	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	using MutableFlatMapAdapter = detail::UnorderedMapAdapter<
+		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		utils::FlatHashMap<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
+
+	/// Defines cache types for a flat (open addressing) immutable map based cache.
+	/// \note This is preferable for large caches with fixed width keys.
+	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	using ImmutableFlatMapAdapter = detail::UnorderedMapAdapter<
+		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		utils::FlatHashMap<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
 
 	namespace detail {
-		/// Defines cache types for an ordered set based cache.
-		template<typename TElementTraits>
+		/// Defines cache types for an ordered set based cache using \a TMemorySet as the memory set.
+		template<typename TElementTraits, typename TMemorySet>
 		struct OrderedSetAdapter {
 		private:
-			using ElementType = typename std::remove_const<typename TElementTraits::ElementType>::type;
-
 			// TODO: this is a placeholder for a rdb column adapter
-			class StorageSetType : public deltaset::detail::OrderedSetType<TElementTraits> {
+			class StorageSetType : public TMemorySet {
 			public:
 				StorageSetType(CacheDatabase&, size_t)
 				{}
 			};
 
-			using MemorySetType = std::set<ElementType>;
+			using MemorySetType = TMemorySet;
 
 			// workaround for VS truncation
 			using SetStorageTraits = deltaset::SetStorageTraits<
@@ -128,10 +143,11 @@ namespace catapult { namespace cache {
 	}
 
 	/// Defines cache types for an ordered mutable set based cache.
-	template<typename TDescriptor>
-	using MutableOrderedSetAdapter = detail::OrderedSetAdapter<deltaset::MutableTypeTraits<typename TDescriptor::ValueType>>;
+	template<typename TDescriptor, typename TSet = std::set<typename TDescriptor::ValueType>>
+	using MutableOrderedSetAdapter = detail::OrderedSetAdapter<deltaset::MutableTypeTraits<typename TDescriptor::ValueType>, TSet>;
 
 	/// Defines cache types for an ordered immutable set based cache.
-	template<typename TDescriptor>
-	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>>;
+	/// \note \a TSet can be a custom set type that provides its own PruneBaseSet overload.
+	template<typename TDescriptor, typename TSet = std::set<typename TDescriptor::ValueType>>
+	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>, TSet>;
 }}
@@ -0,0 +1,106 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CachePatriciaTree.h"
+#include "catapult/crypto/Hashes.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// minimum number of nodes before unreachable nodes are pruned
+		constexpr size_t Min_Nodes_Before_Prune = 1024;
+
+		class HashingOutputStream : public io::OutputStream {
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_hashBuilder.update(buffer);
+			}
+
+			void flush() override
+			{}
+
+		public:
+			Hash256 hash() {
+				Hash256 hash;
+				m_hashBuilder.final(hash);
+				return hash;
+			}
+
+		private:
+			crypto::Sha3_256_Builder m_hashBuilder;
+		};
+	}
+
+	CachePatriciaTree::CachePatriciaTree()
+			: m_pTree(std::make_unique<tree::PatriciaTree<PassThroughEncoder, tree::MemoryDataSource>>(m_dataSource))
+			, m_numReachableNodes(0)
+	{}
+
+	Hash256 CachePatriciaTree::CalculateKeyBufferHash(const RawBuffer& keyBuffer) {
+		Hash256 keyHash;
+		crypto::Sha3_256(keyBuffer, keyHash);
+		return keyHash;
+	}
+
+	Hash256 CachePatriciaTree::CalculateValueHash(const consumer<io::OutputStream&>& save) {
+		HashingOutputStream output;
+		save(output);
+		return output.hash();
+	}
+
+	Hash256 CachePatriciaTree::root() const {
+		return m_pTree->root();
+	}
+
+	size_t CachePatriciaTree::numNodes() const {
+		return m_dataSource.size();
+	}
+
+	void CachePatriciaTree::set(const Hash256& keyHash, const Hash256& valueHash) {
+		m_pTree->set(keyHash, valueHash);
+	}
+
+	void CachePatriciaTree::unset(const Hash256& keyHash) {
+		m_pTree->unset(keyHash);
+	}
+
+	void CachePatriciaTree::setBatch(const std::vector<HashPair>& hashPairs) {
+		m_pTree->setBatch(hashPairs);
+	}
+
+	void CachePatriciaTree::unsetBatch(const std::vector<Hash256>& keyHashes) {
+		m_pTree->unsetBatch(keyHashes);
+	}
+
+	void CachePatriciaTree::compact() {
+		// every update leaves behind the nodes it replaced, so prune them once they outnumber the live nodes
+		// (this keeps the amortized cost of pruning proportional to the number of updates)
+		if (m_dataSource.size() < std::max(Min_Nodes_Before_Prune, 2 * m_numReachableNodes))
+			return;
+
+		m_numReachableNodes = m_dataSource.prune(root());
+	}
+
+	void CachePatriciaTree::clear() {
+		m_pTree = std::make_unique<tree::PatriciaTree<PassThroughEncoder, tree::MemoryDataSource>>(m_dataSource);
+		m_dataSource.prune(Hash256());
+		m_numReachableNodes = 0;
+	}
+}}
@@ -0,0 +1,122 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/io/Stream.h"
+#include "catapult/functions.h"
+
+namespace catapult { namespace cache {
+
+	/// A patricia tree that tracks the state of a cache.
+	/// \note Keys and values are hashed by the caller, so all paths in the tree have the same length.
+	class CachePatriciaTree {
+	private:
+		struct PassThroughEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+	public:
+		/// Pair of key hash and value hash.
+		using HashPair = std::pair<Hash256, Hash256>;
+
+	public:
+		/// Creates an empty tree.
+		CachePatriciaTree();
+
+	public:
+		/// Gets the root hash of the tree.
+		Hash256 root() const;
+
+		/// Gets the number of nodes held by the tree.
+		size_t numNodes() const;
+
+	public:
+		/// Calculates the key hash of \a key.
+		template<typename TKey>
+		static Hash256 CalculateKeyHash(const TKey& key) {
+			return CalculateKeyBufferHash({ reinterpret_cast<const uint8_t*>(&key), sizeof(TKey) });
+		}
+
+		/// Calculates the value hash of all data written by \a save.
+		static Hash256 CalculateValueHash(const consumer<io::OutputStream&>& save);
+
+		/// Calculates the key and value hashes of the cache \a element using \a TStorageTraits to serialize it.
+		template<typename TStorageTraits>
+		static HashPair CalculateElementHashes(const typename TStorageTraits::StorageType& element) {
+			return std::make_pair(CalculateKeyHash(element.first), CalculateValueHash([&element](auto& output) {
+				TStorageTraits::Save(element, output);
+			}));
+		}
+
+	public:
+		/// Sets the value of the cache \a element using \a TStorageTraits to serialize it.
+		template<typename TStorageTraits>
+		void setElement(const typename TStorageTraits::StorageType& element) {
+			auto hashPair = CalculateElementHashes<TStorageTraits>(element);
+			set(hashPair.first, hashPair.second);
+		}
+
+		/// Removes the cache element with \a key.
+		template<typename TKey>
+		void unsetElement(const TKey& key) {
+			unset(CalculateKeyHash(key));
+		}
+
+		/// Sets the value of the element with key hash \a keyHash to \a valueHash.
+		void set(const Hash256& keyHash, const Hash256& valueHash);
+
+		/// Removes the element with key hash \a keyHash.
+		void unset(const Hash256& keyHash);
+
+		/// Sets the values of all elements in \a hashPairs, which are composed of key hashes and value hashes.
+		/// \note This is more efficient than multiple calls to set because shared nodes are only updated once.
+		void setBatch(const std::vector<HashPair>& hashPairs);
+
+		/// Removes all elements with key hashes in \a keyHashes.
+		void unsetBatch(const std::vector<Hash256>& keyHashes);
+
+		/// Removes all nodes that are no longer reachable from the root when they outnumber the reachable nodes.
+		void compact();
+
+		/// Removes all elements.
+		void clear();
+
+	private:
+		static Hash256 CalculateKeyBufferHash(const RawBuffer& keyBuffer);
+
+	private:
+		tree::MemoryDataSource m_dataSource;
+		std::unique_ptr<tree::PatriciaTree<PassThroughEncoder, tree::MemoryDataSource>> m_pTree;
+		size_t m_numReachableNodes;
+	};
+}}
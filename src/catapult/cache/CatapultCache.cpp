@@ -23,8 +23,11 @@
 #include "CatapultCacheDetachedDelta.h"
 #include "ReadOnlyCatapultCache.h"
 #include "SubCachePluginAdapter.h"
+#include "catapult/crypto/Hashes.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace cache {
 
@@ -158,11 +161,63 @@ namespace catapult { namespace cache {
 
 			return resultViews;
 		}
+
+		std::vector<SubCachePlugin*> FindStateRootSubCaches(const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			std::vector<SubCachePlugin*> stateRootSubCaches;
+			for (const auto& pSubCache : subCaches) {
+				if (pSubCache && pSubCache->supportsStateRoot())
+					stateRootSubCaches.push_back(pSubCache.get());
+			}
+
+			return stateRootSubCaches;
+		}
+
+		std::unique_ptr<thread::IoServiceThreadPool> CreateStateRootPool(const std::vector<std::unique_ptr<SubCachePlugin>>& subCaches) {
+			// a pool is only needed when multiple subcache trees can be updated in parallel
+			auto numStateRootSubCaches = FindStateRootSubCaches(subCaches).size();
+			if (numStateRootSubCaches < 2)
+				return nullptr;
+
+			auto pPool = thread::CreateIoServiceThreadPool(numStateRootSubCaches, "state root");
+			pPool->start();
+			return pPool;
+		}
+
+		void UpdateStateRoots(const std::vector<SubCachePlugin*>& subCaches, thread::IoServiceThreadPool* pPool) {
+			if (!pPool) {
+				for (auto* pSubCache : subCaches)
+					pSubCache->updateStateRoot();
+
+				return;
+			}
+
+			// subcache trees are independent, so they can be updated in parallel
+			thread::ParallelForEachAndWait(pPool->service(), subCaches, [](auto* pSubCache, auto) {
+				pSubCache->updateStateRoot();
+			});
+		}
+
+		Hash256 CalculateStateRoot(const std::vector<SubCachePlugin*>& subCaches) {
+			if (subCaches.empty())
+				return Hash256();
+
+			crypto::Sha3_256_Builder stateRootBuilder;
+			for (const auto* pSubCache : subCaches) {
+				auto subCacheStateRoot = pSubCache->stateRoot();
+				stateRootBuilder.update(subCacheStateRoot);
+			}
+
+			Hash256 stateRoot;
+			stateRootBuilder.final(stateRoot);
+			return stateRoot;
+		}
 	}
 
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_subCaches(std::move(subCaches))
+			, m_stateRoot()
+			, m_pStateRootPool(CreateStateRootPool(m_subCaches))
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -198,6 +253,11 @@ namespace catapult { namespace cache {
 		// use the height writer lock to lock the entire cache during commit
 		auto cacheHeightModifier = m_pCacheHeight->modifier();
 
+		// state roots need to be updated before the pending changes are committed
+		auto stateRootSubCaches = FindStateRootSubCaches(m_subCaches);
+		UpdateStateRoots(stateRootSubCaches, m_pStateRootPool.get());
+		m_stateRoot = CalculateStateRoot(stateRootSubCaches);
+
 		for (const auto& pSubCache : m_subCaches) {
 			if (pSubCache)
 				pSubCache->commit();
@@ -207,6 +267,12 @@ namespace catapult { namespace cache {
 		cacheHeightModifier.set(height);
 	}
 
+	Hash256 CatapultCache::stateRoot() const {
+		// acquire a height reader lock to ensure the state root is consistent with the cache height
+		auto pCacheHeightView = m_pCacheHeight->view();
+		return m_stateRoot;
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
@@ -31,6 +31,7 @@ namespace catapult {
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockChainConfiguration; }
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -71,6 +72,10 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
 		void commit(Height height);
 
+		/// Gets the state root calculated from all subcaches that support state roots at the last commit.
+		/// \note This is a zero hash if no subcaches support state roots.
+		Hash256 stateRoot() const;
+
 	public:
 		/// Gets cache storages for all subcaches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -81,5 +86,7 @@ namespace catapult { namespace cache {
 	private:
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		Hash256 m_stateRoot;
+		std::unique_ptr<thread::IoServiceThreadPool> m_pStateRootPool; // pool used to update subcache state roots in parallel
 	};
 }}
@@ -29,14 +29,17 @@ namespace catapult { namespace cache {
 	class CatapultCacheBuilder {
 	public:
 		/// Adds \a pSubCache to the builder with the specified storage traits.
+		/// \note State root calculation is enabled for the subcache when \a enableStateRoot is \c true.
 		template<typename TStorageTraits, typename TCache>
-		void add(std::unique_ptr<TCache>&& pSubCache) {
+		void add(std::unique_ptr<TCache>&& pSubCache, bool enableStateRoot = false) {
 			auto id = static_cast<size_t>(TCache::Id);
 			m_subCaches.resize(std::max(m_subCaches.size(), id + 1));
 			if (m_subCaches[id])
 				CATAPULT_THROW_INVALID_ARGUMENT_1("subcache has already been registered with id", id);
 
-			m_subCaches[id] = std::make_unique<cache::SubCachePluginAdapter<TCache, TStorageTraits>>(std::move(pSubCache));
+			m_subCaches[id] = std::make_unique<cache::SubCachePluginAdapter<TCache, TStorageTraits>>(
+					std::move(pSubCache),
+					enableStateRoot);
 		}
 
 		/// Builds a catapult cache.
@@ -32,8 +32,14 @@ namespace catapult { namespace cache {
 
 		/// Creates options with custom \a maxResponseSize and \a maxCacheSize.
 		constexpr MemoryCacheOptions(uint64_t maxResponseSize, uint64_t maxCacheSize)
+				: MemoryCacheOptions(maxResponseSize, maxCacheSize, false)
+		{}
+
+		/// Creates options with custom \a maxResponseSize, \a maxCacheSize and fee prioritization (\a shouldPrioritizeByFee).
+		constexpr MemoryCacheOptions(uint64_t maxResponseSize, uint64_t maxCacheSize, bool shouldPrioritizeByFee)
 				: MaxResponseSize(maxResponseSize)
 				, MaxCacheSize(maxCacheSize)
+				, ShouldPrioritizeByFee(shouldPrioritizeByFee)
 		{}
 
 	public:
@@ -42,5 +48,9 @@ namespace catapult { namespace cache {
 
 		/// Maximum size of the cache.
 		uint64_t MaxCacheSize;
+
+		/// \c true if transactions should be prioritized by fee per byte.
+		/// \note This is only supported by the unconfirmed transactions cache.
+		bool ShouldPrioritizeByFee;
 	};
 }}
@@ -22,11 +22,20 @@
 #include "CacheSizeLogger.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/Cosignature.h"
-#include "catapult/state/TimestampedHash.h"
-#include <set>
+#include "catapult/utils/TimingWheel.h"
+#include <algorithm>
 
 namespace catapult { namespace cache {
 
+	namespace {
+		void XorCosignatureHash(const model::Cosignature& cosignature, Hash256& cosignaturesHash) {
+			Hash256 cosignatureHash;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&cosignature), sizeof(model::Cosignature) }, cosignatureHash);
+			for (auto i = 0u; i < Hash256_Size; ++i)
+				cosignaturesHash[i] ^= cosignatureHash[i];
+		}
+	}
+
 	class PtData {
 	public:
 		explicit PtData(const model::DetachedTransactionInfo& transactionInfo)
@@ -59,32 +68,29 @@ namespace catapult { namespace cache {
 			return { transaction().get(), &m_cosignatures };
 		}
 
-		state::TimestampedHash timestampedHash() const {
-			return state::TimestampedHash(transaction()->Deadline, entityHash());
+		Timestamp deadline() const {
+			return transaction()->Deadline;
 		}
 
 	public:
 		bool add(const Key& signer, const Signature& signature) {
-			if (weakCosignedTransactionInfo().hasCosigner(signer))
-				return false;
-
 			// insert cosignature into sorted vector
-			auto iter = m_cosignatures.begin();
-			while (m_cosignatures.end() != iter && iter->Signer < signer)
-				++iter;
+			auto iter = std::lower_bound(m_cosignatures.begin(), m_cosignatures.end(), signer, [](const auto& cosignature, const auto& key) {
+				return cosignature.Signer < key;
+			});
+			if (m_cosignatures.end() != iter && signer == iter->Signer)
+				return false;
 
-			m_cosignatures.insert(iter, { signer, signature });
+			iter = m_cosignatures.insert(iter, { signer, signature });
 
-			// recalculate the cosignatures hash
-			crypto::Sha3_256(
-					{ reinterpret_cast<const uint8_t*>(m_cosignatures.data()), m_cosignatures.size() * sizeof(model::Cosignature) },
-					m_cosignaturesHash);
+			// update the cosignatures hash incrementally
+			XorCosignatureHash(*iter, m_cosignaturesHash);
 			return true;
 		}
 
 	private:
 		model::DetachedTransactionInfo m_transactionInfo;
-		Hash256 m_cosignaturesHash;
+		Hash256 m_cosignaturesHash; // xor of the hashes of all cosignatures, so it is independent of the order of cosignatures
 		std::vector<model::Cosignature> m_cosignatures; // sorted by signer so that sets of cosignatures added in different order match
 	};
 
@@ -161,6 +167,8 @@ namespace catapult { namespace cache {
 	// region MemoryPtCacheModifier
 
 	namespace {
+		using DeadlineWheel = utils::TimingWheel<Hash256, utils::ArrayHasher<Hash256>>;
+
 		model::DetachedTransactionInfo ToTransactionInfo(const PtDataContainer::value_type& pair) {
 			return pair.second.transactionInfo();
 		}
@@ -170,11 +178,11 @@ namespace catapult { namespace cache {
 			explicit MemoryPtCacheModifier(
 					uint64_t maxCacheSize,
 					PtDataContainer& transactionDataContainer,
-					std::set<state::TimestampedHash>& timestampedHashes,
+					DeadlineWheel& deadlineWheel,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_transactionDataContainer(transactionDataContainer)
-					, m_timestampedHashes(timestampedHashes)
+					, m_deadlineWheel(deadlineWheel)
 					, m_readLock(std::move(readLock))
 					, m_writeLock(m_readLock.promoteToWriter())
 			{}
@@ -193,7 +201,7 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_transactionDataContainer.emplace(transactionInfo.EntityHash, PtData(transactionInfo));
-				m_timestampedHashes.emplace(transactionInfo.pEntity->Deadline, transactionInfo.EntityHash);
+				m_deadlineWheel.add(transactionInfo.EntityHash, transactionInfo.pEntity->Deadline);
 				LogSizes("partial transactions", m_transactionDataContainer.size(), m_maxCacheSize);
 				return true;
 			}
@@ -216,15 +224,12 @@ namespace catapult { namespace cache {
 			}
 
 			std::vector<model::DetachedTransactionInfo> prune(Timestamp timestamp) override {
+				// expired hashes are already removed from the wheel, so only the transaction data needs to be erased
 				std::vector<model::DetachedTransactionInfo> prunedInfos;
-				while (!m_timestampedHashes.empty()) {
-					auto timestampedHashesIter = m_timestampedHashes.cbegin();
-					if (timestampedHashesIter->Time > timestamp)
-						break;
-
-					auto iter = m_transactionDataContainer.find(timestampedHashesIter->Hash);
+				for (const auto& hash : m_deadlineWheel.advance(timestamp)) {
+					auto iter = m_transactionDataContainer.find(hash);
 					prunedInfos.push_back(ToTransactionInfo(*iter));
-					remove(iter);
+					m_transactionDataContainer.erase(iter);
 				}
 
 				return prunedInfos;
@@ -247,14 +252,14 @@ namespace catapult { namespace cache {
 
 		private:
 			void remove(PtDataContainer::iterator iter) {
-				m_timestampedHashes.erase(iter->second.timestampedHash());
+				m_deadlineWheel.remove(iter->first, iter->second.deadline());
 				m_transactionDataContainer.erase(iter);
 			}
 
 		private:
 			uint64_t m_maxCacheSize;
 			PtDataContainer& m_transactionDataContainer;
-			std::set<state::TimestampedHash>& m_timestampedHashes;
+			DeadlineWheel& m_deadlineWheel;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -266,7 +271,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryPtCache::Impl {
 		PtDataContainer TransactionDataContainer;
-		std::set<state::TimestampedHash> TimestampedHashes;
+		DeadlineWheel Deadlines;
 	};
 
 	MemoryPtCache::MemoryPtCache(const MemoryCacheOptions& options)
@@ -284,7 +289,7 @@ namespace catapult { namespace cache {
 		return PtCacheModifierProxy(std::make_unique<MemoryPtCacheModifier>(
 				m_options.MaxCacheSize,
 				m_pImpl->TransactionDataContainer,
-				m_pImpl->TimestampedHashes,
+				m_pImpl->Deadlines,
 				m_lock.acquireReader()));
 	}
 
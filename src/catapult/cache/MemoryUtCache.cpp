@@ -21,7 +21,10 @@
 #include "MemoryUtCache.h"
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
+#include "TransactionFeeIndex.h"
 #include "catapult/model/EntityInfo.h"
+#include "catapult/utils/VersionedSnapshot.h"
+#include <map>
 
 namespace catapult { namespace cache {
 
@@ -46,16 +49,82 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	namespace {
+		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
+
+		TransactionFeeIndex::Entry ToFeeIndexEntry(const model::TransactionInfo& transactionInfo, size_t id) {
+			const auto& transaction = *transactionInfo.pEntity;
+			return { id, transaction.Signer, transaction.Fee, transaction.Size };
+		}
+
+		template<typename TConsumer>
+		void ForEachTransactionInfo(const TransactionDataContainer& transactionDataContainer, TConsumer consumer) {
+			for (const auto& data : transactionDataContainer) {
+				if (!consumer(data))
+					return;
+			}
+		}
+
+		template<typename TConsumer>
+		void ForEachTransactionInfo(const MemoryUtCacheSnapshot::TransactionInfoChunks& chunks, TConsumer consumer) {
+			for (const auto& pChunk : chunks) {
+				for (const auto& transactionInfo : *pChunk) {
+					if (!consumer(transactionInfo))
+						return;
+				}
+			}
+		}
+
+		template<typename TTransactionInfos>
+		model::ShortHashRange CollectShortHashes(const TTransactionInfos& transactionInfos, size_t count) {
+			auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(count);
+			auto shortHashesIter = shortHashes.begin();
+			ForEachTransactionInfo(transactionInfos, [&shortHashesIter](const auto& transactionInfo) {
+				*shortHashesIter++ = utils::ToShortHash(transactionInfo.EntityHash);
+				return true;
+			});
+
+			return shortHashes;
+		}
+
+		template<typename TTransactionInfos>
+		UnknownTransactions CollectUnknownTransactions(
+				const TTransactionInfos& transactionInfos,
+				uint64_t maxResponseSize,
+				const utils::ShortHashesSet& knownShortHashes) {
+			uint64_t totalSize = 0;
+			UnknownTransactions transactions;
+			ForEachTransactionInfo(transactionInfos, [maxResponseSize, &knownShortHashes, &totalSize, &transactions](
+					const auto& transactionInfo) {
+				auto shortHash = utils::ToShortHash(transactionInfo.EntityHash);
+				if (knownShortHashes.cend() != knownShortHashes.find(shortHash))
+					return true;
+
+				auto pTransaction = transactionInfo.pEntity;
+				totalSize += pTransaction->Size;
+				if (totalSize > maxResponseSize)
+					return false;
+
+				transactions.push_back(pTransaction);
+				return true;
+			});
+
+			return transactions;
+		}
+	}
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
+			const TransactionFeeIndex* pFeeIndex,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_idLookup(idLookup)
+			, m_pFeeIndex(pFeeIndex)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -68,38 +137,146 @@ namespace catapult { namespace cache {
 	}
 
 	void MemoryUtCacheView::forEach(const TransactionInfoConsumer& consumer) const {
-		for (const auto& data : m_transactionDataContainer) {
-			if (!consumer(data))
-				return;
+		ForEachTransactionInfo(m_transactionDataContainer, consumer);
+	}
+
+	MemoryUtCacheView::TransactionInfoPointers MemoryUtCacheView::prioritizedTransactionInfos(size_t count) const {
+		TransactionInfoPointers transactionInfos;
+		if (!m_pFeeIndex) {
+			for (const auto& data : m_transactionDataContainer) {
+				if (count == transactionInfos.size())
+					break;
+
+				transactionInfos.push_back(&data);
+			}
+
+			return transactionInfos;
 		}
+
+		auto ids = m_pFeeIndex->select(count);
+		transactionInfos.reserve(ids.size());
+		for (auto id : ids)
+			transactionInfos.push_back(&*m_transactionDataContainer.find(TransactionData(id)));
+
+		return transactionInfos;
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
-		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
-		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
-			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
-
-		return shortHashes;
+		return CollectShortHashes(m_transactionDataContainer, m_transactionDataContainer.size());
 	}
 
 	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::unknownTransactions(const utils::ShortHashesSet& knownShortHashes) const {
-		uint64_t totalSize = 0;
-		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize)
-					break;
+		return CollectUnknownTransactions(m_transactionDataContainer, m_maxResponseSize, knownShortHashes);
+	}
 
-				transactions.push_back(pTransaction);
+	// endregion
+
+	// region MemoryUtCacheSnapshot
+
+	MemoryUtCacheSnapshot::MemoryUtCacheSnapshot(uint64_t maxResponseSize, TransactionInfoChunks&& chunks)
+			: m_maxResponseSize(maxResponseSize)
+			, m_chunks(std::move(chunks))
+			, m_size(0) {
+		for (const auto& pChunk : m_chunks)
+			m_size += pChunk->size();
+	}
+
+	size_t MemoryUtCacheSnapshot::size() const {
+		return m_size;
+	}
+
+	void MemoryUtCacheSnapshot::forEach(const TransactionInfoConsumer& consumer) const {
+		ForEachTransactionInfo(m_chunks, consumer);
+	}
+
+	model::ShortHashRange MemoryUtCacheSnapshot::shortHashes() const {
+		return CollectShortHashes(m_chunks, m_size);
+	}
+
+	MemoryUtCacheSnapshot::UnknownTransactions MemoryUtCacheSnapshot::unknownTransactions(
+			const utils::ShortHashesSet& knownShortHashes) const {
+		return CollectUnknownTransactions(m_chunks, m_maxResponseSize, knownShortHashes);
+	}
+
+	// endregion
+
+	// region SnapshotPublisher
+
+	namespace {
+		/// Publishes snapshots of a transaction data container.
+		/// \note Transactions are grouped into chunks by id, so only chunks containing changed transactions need to be copied
+		///        when a new snapshot is published.
+		class SnapshotPublisher {
+		private:
+			using TransactionInfoChunk = MemoryUtCacheSnapshot::TransactionInfoChunk;
+
+			static constexpr size_t Chunk_Size = 1024;
+
+		public:
+			explicit SnapshotPublisher(uint64_t maxResponseSize)
+					: m_maxResponseSize(maxResponseSize)
+					, m_hasChanges(false)
+					, m_snapshot(std::make_shared<MemoryUtCacheSnapshot>(maxResponseSize, MemoryUtCacheSnapshot::TransactionInfoChunks()))
+			{}
+
+		public:
+			std::shared_ptr<const MemoryUtCacheSnapshot> get() const {
+				return m_snapshot.pin();
+			}
+
+		public:
+			void markChanged(size_t id) {
+				m_changedChunkIds.insert(id / Chunk_Size);
+				m_hasChanges = true;
 			}
-		}
 
-		return transactions;
+			void markAllRemoved() {
+				m_chunks.clear();
+				m_changedChunkIds.clear();
+				m_hasChanges = true;
+			}
+
+			void publish(const TransactionDataContainer& transactionDataContainer) {
+				if (!m_hasChanges)
+					return;
+
+				for (auto chunkId : m_changedChunkIds)
+					updateChunk(transactionDataContainer, chunkId);
+
+				m_changedChunkIds.clear();
+				m_hasChanges = false;
+
+				MemoryUtCacheSnapshot::TransactionInfoChunks chunks;
+				chunks.reserve(m_chunks.size());
+				for (const auto& pair : m_chunks)
+					chunks.push_back(pair.second);
+
+				m_snapshot.publish(std::make_shared<const MemoryUtCacheSnapshot>(m_maxResponseSize, std::move(chunks)));
+			}
+
+		private:
+			void updateChunk(const TransactionDataContainer& transactionDataContainer, size_t chunkId) {
+				auto beginIter = transactionDataContainer.lower_bound(TransactionData(chunkId * Chunk_Size));
+				auto endIter = transactionDataContainer.lower_bound(TransactionData((chunkId + 1) * Chunk_Size));
+				if (beginIter == endIter) {
+					m_chunks.erase(chunkId);
+					return;
+				}
+
+				auto pChunk = std::make_shared<TransactionInfoChunk>();
+				for (auto iter = beginIter; endIter != iter; ++iter)
+					pChunk->push_back(iter->copy());
+
+				m_chunks[chunkId] = std::move(pChunk);
+			}
+
+		private:
+			uint64_t m_maxResponseSize;
+			std::map<size_t, std::shared_ptr<const TransactionInfoChunk>> m_chunks;
+			std::set<size_t> m_changedChunkIds;
+			bool m_hasChanges;
+			utils::VersionedSnapshot<MemoryUtCacheSnapshot> m_snapshot;
+		};
 	}
 
 	// endregion
@@ -118,16 +295,27 @@ namespace catapult { namespace cache {
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
 					AccountCounters& counters,
+					TimestampedHashFilter& hashFilter,
+					TransactionFeeIndex* pFeeIndex,
+					SnapshotPublisher& snapshotPublisher,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_idLookup(idLookup)
 					, m_counters(counters)
+					, m_hashFilter(hashFilter)
+					, m_pFeeIndex(pFeeIndex)
+					, m_snapshotPublisher(snapshotPublisher)
 					, m_readLock(std::move(readLock))
 					, m_writeLock(m_readLock.promoteToWriter())
 			{}
 
+			~MemoryUtCacheModifier() override {
+				// publish while the write lock is still held so that snapshots are published in order
+				m_snapshotPublisher.publish(m_transactionDataContainer);
+			}
+
 		public:
 			size_t size() const override {
 				return m_transactionDataContainer.size();
@@ -140,10 +328,8 @@ namespace catapult { namespace cache {
 				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
 					return false;
 
-				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
-
-				m_counters.increment(transactionInfo.pEntity->Signer);
+				m_hashFilter.insert(transactionInfo.pEntity->Deadline, transactionInfo.EntityHash);
+				insert(transactionInfo, ++m_idSequence);
 
 				LogSizes("unconfirmed transactions", m_transactionDataContainer.size(), m_maxCacheSize);
 				return true;
@@ -158,7 +344,10 @@ namespace catapult { namespace cache {
 				auto erasedInfo = dataIter->copy();
 
 				m_counters.decrement(dataIter->pEntity->Signer);
+				if (m_pFeeIndex)
+					m_pFeeIndex->remove(dataIter->Id);
 
+				m_snapshotPublisher.markChanged(dataIter->Id);
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -182,15 +371,57 @@ namespace catapult { namespace cache {
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
+				if (m_pFeeIndex)
+					m_pFeeIndex->clear();
+
+				m_snapshotPublisher.markAllRemoved();
 				return transactionInfosCopy;
 			}
 
+			model::TransactionInfo evict(const model::TransactionInfo& transactionInfo, const predicate<>& canEvict) override {
+				// only evict when prioritizing by fee, the cache is full and the new transaction is not a duplicate
+				if (!m_pFeeIndex || m_maxCacheSize > m_transactionDataContainer.size())
+					return model::TransactionInfo();
+
+				if (m_idLookup.cend() != m_idLookup.find(transactionInfo.EntityHash))
+					return model::TransactionInfo();
+
+				const auto* pLowestEntry = m_pFeeIndex->lowest();
+				if (!pLowestEntry || !TransactionFeeIndex::HasHigherFeePerByte(ToFeeIndexEntry(transactionInfo, 0), *pLowestEntry))
+					return model::TransactionInfo();
+
+				auto lowestId = pLowestEntry->Id;
+				auto lowestHash = m_transactionDataContainer.find(TransactionData(lowestId))->EntityHash;
+				auto evictedTransactionInfo = remove(lowestHash);
+				if (!canEvict()) {
+					// restore the transaction with its original id so that its position is unchanged
+					insert(evictedTransactionInfo, lowestId);
+					return model::TransactionInfo();
+				}
+
+				return evictedTransactionInfo;
+			}
+
+		private:
+			void insert(const model::TransactionInfo& transactionInfo, size_t id) {
+				m_idLookup.emplace(transactionInfo.EntityHash, id);
+				m_transactionDataContainer.emplace(transactionInfo, id);
+				if (m_pFeeIndex)
+					m_pFeeIndex->add(ToFeeIndexEntry(transactionInfo, id));
+
+				m_snapshotPublisher.markChanged(id);
+				m_counters.increment(transactionInfo.pEntity->Signer);
+			}
+
 		private:
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
+			TimestampedHashFilter& m_hashFilter;
+			TransactionFeeIndex* m_pFeeIndex;
+			SnapshotPublisher& m_snapshotPublisher;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -200,22 +431,54 @@ namespace catapult { namespace cache {
 
 	// region MemoryUtCache
 
+	namespace {
+		// windows must cover the maximum transaction lifetime in order for the filter to be effective
+		constexpr auto Hash_Filter_Window_Duration = utils::TimeSpan::FromHours(1);
+		constexpr size_t Hash_Filter_Num_Windows = 32;
+		constexpr size_t Hash_Filter_Num_Blocks_Per_Window = 4096;
+	}
+
 	struct MemoryUtCache::Impl {
+	public:
+		explicit Impl(uint64_t maxResponseSize)
+				: HashFilter(Hash_Filter_Window_Duration, Hash_Filter_Num_Windows, Hash_Filter_Num_Blocks_Per_Window)
+				, SnapshotPublisher(maxResponseSize)
+		{}
+
+	public:
 		cache::TransactionDataContainer TransactionDataContainer;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
+		TimestampedHashFilter HashFilter;
+		std::unique_ptr<TransactionFeeIndex> pFeeIndex;
+		cache::SnapshotPublisher SnapshotPublisher;
 	};
 
 	MemoryUtCache::MemoryUtCache(const MemoryCacheOptions& options)
 			: m_options(options)
 			, m_idSequence(0)
-			, m_pImpl(std::make_unique<Impl>())
-	{}
+			, m_pImpl(std::make_unique<Impl>(m_options.MaxResponseSize)) {
+		if (m_options.ShouldPrioritizeByFee)
+			m_pImpl->pFeeIndex = std::make_unique<TransactionFeeIndex>();
+	}
 
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->IdLookup,
+				m_pImpl->pFeeIndex.get(),
+				m_lock.acquireReader());
+	}
+
+	std::shared_ptr<const MemoryUtCacheSnapshot> MemoryUtCache::snapshot() const {
+		return m_pImpl->SnapshotPublisher.get();
+	}
+
+	const TimestampedHashFilter& MemoryUtCache::hashFilter() const {
+		return m_pImpl->HashFilter;
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -225,6 +488,9 @@ namespace catapult { namespace cache {
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
 				m_pImpl->Counters,
+				m_pImpl->HashFilter,
+				m_pImpl->pFeeIndex.get(),
+				m_pImpl->SnapshotPublisher,
 				m_lock.acquireReader()));
 	}
 
@@ -21,6 +21,7 @@
 #pragma once
 #include "MemoryCacheOptions.h"
 #include "MemoryCacheProxy.h"
+#include "TimestampedHashFilter.h"
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/Hashers.h"
@@ -28,7 +29,12 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		class TransactionFeeIndex;
+		struct TransactionData;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -40,16 +46,19 @@ namespace catapult { namespace cache {
 	class MemoryUtCacheView {
 	private:
 		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
+		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 		using IdLookup = std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>>;
 		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), an id lookup (\a idLookup) and an optional fee index (\a pFeeIndex)
+		/// with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
+				const TransactionFeeIndex* pFeeIndex,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -62,6 +71,10 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Gets up to \a count transaction infos with the highest priority ordered by insertion.
+		/// \note Without fee prioritization, the first \a count transaction infos are returned.
+		TransactionInfoPointers prioritizedTransactionInfos(size_t count) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -73,10 +86,47 @@ namespace catapult { namespace cache {
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
+		const TransactionFeeIndex* m_pFeeIndex;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
+	/// An immutable snapshot of the unconfirmed transactions cache.
+	/// \note A snapshot can be read without blocking (or being blocked by) modifications of the cache.
+	class MemoryUtCacheSnapshot {
+	public:
+		using TransactionInfoChunk = std::vector<model::TransactionInfo>;
+		using TransactionInfoChunks = std::vector<std::shared_ptr<const TransactionInfoChunk>>;
+
+	private:
+		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
+		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
+
+	public:
+		/// Creates a snapshot around a maximum response size (\a maxResponseSize) and transaction info \a chunks
+		/// ordered by insertion.
+		MemoryUtCacheSnapshot(uint64_t maxResponseSize, TransactionInfoChunks&& chunks);
+
+	public:
+		/// Returns the number of unconfirmed transactions in the snapshot.
+		size_t size() const;
+
+		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
+		void forEach(const TransactionInfoConsumer& consumer) const;
+
+		/// Gets a range of short hashes of all transactions in the snapshot.
+		model::ShortHashRange shortHashes() const;
+
+		/// Gets a vector of all transactions in the snapshot that do not have a short hash in \a knownShortHashes.
+		UnknownTransactions unknownTransactions(const utils::ShortHashesSet& knownShortHashes) const;
+
+	private:
+		uint64_t m_maxResponseSize;
+		TransactionInfoChunks m_chunks;
+		size_t m_size;
+	};
+
 	/// Cache for all unconfirmed transactions.
+	/// \note When fee prioritization is enabled, transactions are additionally indexed by fee per byte.
 	class MemoryUtCache : public UtCache {
 	public:
 		/// Creates an unconfirmed transactions cache around \a options.
@@ -89,6 +139,14 @@ namespace catapult { namespace cache {
 		/// Gets a read only view based on this cache.
 		MemoryUtCacheView view() const;
 
+		/// Gets the most recent snapshot of this cache.
+		/// \note The snapshot is updated whenever a modifier with changes is destroyed.
+		std::shared_ptr<const MemoryUtCacheSnapshot> snapshot() const;
+
+		/// Gets a lock-free filter of the hashes of all transactions added to this cache.
+		/// \note The filter is not updated when transactions are removed, so it can only be used to rule out hashes.
+		const TimestampedHashFilter& hashFilter() const;
+
 	public:
 		UtCacheModifierProxy modifier() override;
 
@@ -105,5 +163,11 @@ namespace catapult { namespace cache {
 	/// A delegating proxy around a MemoryUtCache.
 	class MemoryUtCacheProxy : public MemoryCacheProxy<MemoryUtCache, UtCache, UtCacheModifierProxy> {
 		using MemoryCacheProxy<MemoryUtCache, UtCache, UtCacheModifierProxy>::MemoryCacheProxy;
+
+	public:
+		/// Gets the most recent snapshot of the underlying cache.
+		auto snapshot() const {
+			return static_cast<const MemoryUtCache&>(*this).snapshot();
+		}
 	};
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/types.h"
 #include <memory>
 #include <string>
 
@@ -82,6 +83,17 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		virtual void commit() = 0;
 
+	public:
+		/// Returns \c true if this cache calculates a state root.
+		virtual bool supportsStateRoot() const = 0;
+
+		/// Gets the state root of this cache.
+		virtual Hash256 stateRoot() const = 0;
+
+		/// Updates the state root with all pending changes.
+		/// \note This must be called before commit.
+		virtual void updateStateRoot() = 0;
+
 	public:
 		/// Returns a const pointer to the underlying cache.
 		virtual const void* get() const = 0;
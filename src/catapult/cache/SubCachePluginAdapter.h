@@ -19,8 +19,10 @@
 **/
 
 #pragma once
+#include "CachePatriciaTree.h"
 #include "CacheStorageAdapter.h"
 #include "SubCachePlugin.h"
+#include "catapult/utils/Logging.h"
 #include <memory>
 #include <sstream>
 
@@ -31,10 +33,20 @@ namespace catapult { namespace cache {
 	class SubCachePluginAdapter : public SubCachePlugin {
 	public:
 		/// Creates an adapter around \a pCache.
-		explicit SubCachePluginAdapter(std::unique_ptr<TCache>&& pCache) : m_pCache(std::move(pCache)) {
+		explicit SubCachePluginAdapter(std::unique_ptr<TCache>&& pCache) : SubCachePluginAdapter(std::move(pCache), false)
+		{}
+
+		/// Creates an adapter around \a pCache that calculates a state root when \a enableStateRoot is \c true
+		/// and the cache delta exposes its pending changes.
+		SubCachePluginAdapter(std::unique_ptr<TCache>&& pCache, bool enableStateRoot)
+				: m_pCache(std::move(pCache))
+				, m_numTreeCommits(0) {
 			std::ostringstream out;
 			out << TCache::Name << " (id = " << TCache::Id << ")";
 			m_name = out.str();
+
+			if (enableStateRoot && SupportsDeltas())
+				m_pTree = std::make_unique<CachePatriciaTree>();
 		}
 
 	public:
@@ -60,6 +72,32 @@ namespace catapult { namespace cache {
 			m_pCache->commit();
 		}
 
+	public:
+		bool supportsStateRoot() const override {
+			return !!m_pTree;
+		}
+
+		Hash256 stateRoot() const override {
+			return m_pTree ? m_pTree->root() : Hash256();
+		}
+
+		void updateStateRoot() override {
+			if (!m_pTree)
+				return;
+
+			// the tree is only updated by commits made through this adapter, so rebuild it when the cache was modified directly
+			// (e.g. by a storage load)
+			auto numCommits = m_pCache->commitCount();
+			if (m_numTreeCommits != numCommits && !rebuildTree())
+				return;
+
+			m_pCache->visitDelta([&tree = *m_pTree](const auto& delta) {
+				UpdateTree(tree, delta, SupportsDeltasTag());
+			});
+			m_pTree->compact();
+			m_numTreeCommits = numCommits + 1;
+		}
+
 	public:
 		const void* get() const override {
 			return m_pCache.get();
@@ -77,6 +115,76 @@ namespace catapult { namespace cache {
 			return !!cache.createView()->tryMakeIterableView();
 		}
 
+	private:
+		template<typename TDelta, typename = void>
+		struct DeltaSupportsDeltas : std::false_type
+		{};
+
+		template<typename TDelta>
+		struct DeltaSupportsDeltas<TDelta, decltype(std::declval<const TDelta&>().deltas(), void())>
+				: std::true_type
+		{};
+
+		using SupportsDeltasTag = DeltaSupportsDeltas<typename TCache::CacheDeltaType>;
+
+		static constexpr bool SupportsDeltas() {
+			return SupportsDeltasTag::value;
+		}
+
+		template<typename TDelta>
+		static void UpdateTree(CachePatriciaTree& tree, const TDelta& delta, std::true_type) {
+			auto deltas = delta.deltas();
+			std::vector<Hash256> removedKeyHashes;
+			removedKeyHashes.reserve(deltas.Removed.size());
+			for (const auto& pair : deltas.Removed)
+				removedKeyHashes.push_back(CachePatriciaTree::CalculateKeyHash(pair.first));
+
+			tree.unsetBatch(removedKeyHashes);
+
+			std::vector<CachePatriciaTree::HashPair> hashPairs;
+			hashPairs.reserve(deltas.Added.size() + deltas.Copied.size());
+			AppendElementHashes(deltas.Added, hashPairs);
+			AppendElementHashes(deltas.Copied, hashPairs);
+			tree.setBatch(hashPairs);
+		}
+
+		template<typename TDelta>
+		static void UpdateTree(CachePatriciaTree&, const TDelta&, std::false_type)
+		{}
+
+		template<typename TIterableView>
+		static void FillTree(CachePatriciaTree& tree, const TIterableView& iterableView, std::true_type) {
+			std::vector<CachePatriciaTree::HashPair> hashPairs;
+			AppendElementHashes(iterableView, hashPairs);
+			tree.setBatch(hashPairs);
+		}
+
+		template<typename TIterableView>
+		static void FillTree(CachePatriciaTree&, const TIterableView&, std::false_type)
+		{}
+
+		template<typename TContainer>
+		static void AppendElementHashes(const TContainer& elements, std::vector<CachePatriciaTree::HashPair>& hashPairs) {
+			for (const auto& pair : elements)
+				hashPairs.push_back(CachePatriciaTree::CalculateElementHashes<TStorageTraits>(pair));
+		}
+
+		bool rebuildTree() {
+			m_pTree->clear();
+
+			auto view = m_pCache->createView();
+			auto pIterableView = view->tryMakeIterableView();
+			if (!pIterableView) {
+				CATAPULT_LOG(warning) << "disabling state root calculation for " << m_name << " because it is not iterable";
+				m_pTree.reset();
+				return false;
+			}
+
+			CATAPULT_LOG(info) << "rebuilding state root for " << m_name << " from " << view->size() << " elements";
+			FillTree(*m_pTree, *pIterableView, SupportsDeltasTag());
+			return true;
+		}
+
 	private:
 		template<typename TView>
 		class SubCacheViewAdapter : public SubCacheView {
@@ -121,5 +229,7 @@ namespace catapult { namespace cache {
 	private:
 		std::unique_ptr<TCache> m_pCache;
 		std::string m_name;
+		std::unique_ptr<CachePatriciaTree> m_pTree;
+		size_t m_numTreeCommits;
 	};
 }}
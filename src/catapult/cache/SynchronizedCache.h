@@ -243,6 +243,22 @@ namespace catapult { namespace cache {
 			return LockableCacheDelta<CacheDeltaType>(std::move(delta), m_commitCounter, m_lock);
 		}
 
+		/// Gets the number of committed deltas.
+		size_t commitCount() const {
+			auto readerLock = m_lock.acquireReader();
+			return m_commitCounter;
+		}
+
+		/// Passes the outstanding attached delta to \a action.
+		template<typename TAction>
+		void visitDelta(TAction action) const {
+			auto pDeltaPair = m_pWeakDeltaPair.lock();
+			if (!pDeltaPair)
+				CATAPULT_THROW_RUNTIME_ERROR("attempting to visit a cache without any outstanding attached deltas");
+
+			action(static_cast<const CacheDeltaType&>(pDeltaPair->CacheView));
+		}
+
 		/// Commits all pending changes to the underlying storage.
 		void commit() {
 			auto pDeltaPair = m_pWeakDeltaPair.lock();
@@ -0,0 +1,135 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TimestampedHashFilter.h"
+#include <limits>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Unused_Window_Id = std::numeric_limits<uint64_t>::max();
+	}
+
+	struct TimestampedHashFilter::Window {
+	public:
+		Window() : Id(Unused_Window_Id), pFilter(nullptr)
+		{}
+
+	public:
+		/// Identifier of the window currently stored in this slot.
+		std::atomic<uint64_t> Id;
+
+		/// Filter used for lookups (owned by pFilterOwner).
+		std::atomic<utils::BlockedBloomFilter*> pFilter;
+
+		/// Owner of the filter (only accessed by inserters).
+		std::unique_ptr<utils::BlockedBloomFilter> pFilterOwner;
+	};
+
+	TimestampedHashFilter::TimestampedHashFilter(
+			const utils::TimeSpan& windowDuration,
+			size_t numWindows,
+			size_t numBlocksPerWindow)
+			: m_windowMillis(windowDuration.millis())
+			, m_numBlocksPerWindow(numBlocksPerWindow)
+			, m_pWindows(std::make_unique<Window[]>(numWindows))
+			, m_numWindows(numWindows)
+			, m_numDefiniteMisses(0)
+			, m_numFalsePositives(0) {
+		if (0 == m_windowMillis || 0 == m_numWindows)
+			CATAPULT_THROW_INVALID_ARGUMENT_2("window duration and number of windows must be nonzero", windowDuration, numWindows);
+
+		// validate the number of blocks eagerly instead of when the first window is used
+		if (0 == numBlocksPerWindow || 0 != (numBlocksPerWindow & (numBlocksPerWindow - 1)))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("number of blocks must be a non-zero power of two", numBlocksPerWindow);
+	}
+
+	TimestampedHashFilter::~TimestampedHashFilter() = default;
+
+	size_t TimestampedHashFilter::numWindows() const {
+		return m_numWindows;
+	}
+
+	uint64_t TimestampedHashFilter::numDefiniteMisses() const {
+		return m_numDefiniteMisses;
+	}
+
+	uint64_t TimestampedHashFilter::numFalsePositives() const {
+		return m_numFalsePositives;
+	}
+
+	uint64_t TimestampedHashFilter::falsePositiveRate() const {
+		auto numFalsePositives = m_numFalsePositives.load();
+		auto numUnknownLookups = m_numDefiniteMisses.load() + numFalsePositives;
+		return 0 == numUnknownLookups ? 0 : numFalsePositives * 10'000 / numUnknownLookups;
+	}
+
+	void TimestampedHashFilter::insert(Timestamp timestamp, const Hash256& hash) {
+		std::lock_guard<std::mutex> guard(m_insertMutex);
+
+		auto id = windowId(timestamp);
+		auto& slot = window(id);
+		auto slotId = slot.Id.load(std::memory_order_relaxed);
+		if (Unused_Window_Id != slotId && slotId > id) {
+			// slot is occupied by a newer window, so lookups for this window will always pass the filter
+			return;
+		}
+
+		if (slotId != id) {
+			// invalidate the slot before clearing it so that concurrent lookups observing cleared bits fall back to "maybe"
+			slot.Id.store(Unused_Window_Id, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			if (slot.pFilterOwner) {
+				slot.pFilterOwner->clear();
+			} else {
+				slot.pFilterOwner = std::make_unique<utils::BlockedBloomFilter>(m_numBlocksPerWindow);
+				slot.pFilter.store(slot.pFilterOwner.get(), std::memory_order_release);
+			}
+
+			slot.Id.store(id, std::memory_order_release);
+		}
+
+		slot.pFilterOwner->insert(hash);
+	}
+
+	bool TimestampedHashFilter::mayContain(Timestamp timestamp, const Hash256& hash) const {
+		auto id = windowId(timestamp);
+		const auto& slot = window(id);
+		if (id != slot.Id.load(std::memory_order_acquire))
+			return true;
+
+		if (slot.pFilter.load(std::memory_order_acquire)->mayContain(hash))
+			return true;
+
+		// the slot might have been recycled while its bits were being read
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return id != slot.Id.load(std::memory_order_relaxed);
+	}
+
+	uint64_t TimestampedHashFilter::windowId(Timestamp timestamp) const {
+		// guarantee that the unused window id is never a valid window id
+		return std::min(timestamp.unwrap() / m_windowMillis, Unused_Window_Id - 1);
+	}
+
+	TimestampedHashFilter::Window& TimestampedHashFilter::window(uint64_t windowId) const {
+		return m_pWindows[windowId % m_numWindows];
+	}
+}}
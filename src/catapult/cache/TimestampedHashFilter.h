@@ -0,0 +1,99 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/BlockedBloomFilter.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/types.h"
+#include <memory>
+#include <mutex>
+
+namespace catapult { namespace cache {
+
+	/// Lock-free prefilter of timestamped hashes that is used to short-circuit lookups of hashes that are definitely unknown.
+	/// Hashes are grouped by timestamp into windows of fixed duration, each backed by its own bloom filter.
+	/// Filters are recycled round-robin as newer windows are encountered, so expired hashes never need to be removed.
+	/// \note The filter never reports false negatives for inserted hashes, even when a window has been recycled.
+	/// \note Lookups are lock-free; inserts are serialized by an internal mutex.
+	class TimestampedHashFilter : public utils::NonCopyable {
+	public:
+		/// Creates a filter with \a numWindows windows of \a windowDuration,
+		/// where each window is backed by a bloom filter with \a numBlocksPerWindow blocks.
+		/// \note Bloom filter memory is only allocated when a window is first used.
+		TimestampedHashFilter(const utils::TimeSpan& windowDuration, size_t numWindows, size_t numBlocksPerWindow);
+
+		/// Destroys the filter.
+		~TimestampedHashFilter();
+
+	public:
+		/// Gets the number of windows.
+		size_t numWindows() const;
+
+		/// Gets the number of lookups that were short-circuited because the hash was definitely unknown.
+		uint64_t numDefiniteMisses() const;
+
+		/// Gets the number of lookups that passed the filter but were not found by the exact lookup.
+		uint64_t numFalsePositives() const;
+
+		/// Gets the false positive rate (in basis points) of all lookups of unknown hashes.
+		uint64_t falsePositiveRate() const;
+
+	public:
+		/// Inserts \a hash with \a timestamp into the filter.
+		void insert(Timestamp timestamp, const Hash256& hash);
+
+		/// Returns \c false if \a hash with \a timestamp was definitely never inserted into the filter, \c true otherwise.
+		bool mayContain(Timestamp timestamp, const Hash256& hash) const;
+
+		/// Returns \c true if \a hash with \a timestamp is known, deferring to \a exactContains only when
+		/// the filter cannot rule the hash out.
+		/// \note Lookup statistics are only updated by this function.
+		template<typename TExactContains>
+		bool contains(Timestamp timestamp, const Hash256& hash, TExactContains exactContains) const {
+			if (!mayContain(timestamp, hash)) {
+				++m_numDefiniteMisses;
+				return false;
+			}
+
+			if (exactContains())
+				return true;
+
+			++m_numFalsePositives;
+			return false;
+		}
+
+	private:
+		struct Window;
+
+		uint64_t windowId(Timestamp timestamp) const;
+
+		Window& window(uint64_t windowId) const;
+
+	private:
+		uint64_t m_windowMillis;
+		size_t m_numBlocksPerWindow;
+		std::unique_ptr<Window[]> m_pWindows;
+		size_t m_numWindows;
+		std::mutex m_insertMutex;
+
+		mutable std::atomic<uint64_t> m_numDefiniteMisses;
+		mutable std::atomic<uint64_t> m_numFalsePositives;
+	};
+}}
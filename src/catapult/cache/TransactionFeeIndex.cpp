@@ -0,0 +1,161 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionFeeIndex.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <queue>
+
+namespace catapult { namespace cache {
+
+	bool TransactionFeeIndex::HasHigherFeePerByte(const Entry& lhs, const Entry& rhs) {
+		auto lhsSize = static_cast<uint64_t>(std::max<uint32_t>(1, lhs.Size));
+		auto rhsSize = static_cast<uint64_t>(std::max<uint32_t>(1, rhs.Size));
+		auto lhsQuotient = lhs.Fee.unwrap() / lhsSize;
+		auto rhsQuotient = rhs.Fee.unwrap() / rhsSize;
+		if (lhsQuotient != rhsQuotient)
+			return lhsQuotient > rhsQuotient;
+
+		// remainders are smaller than the (32-bit) sizes, so their cross products cannot overflow
+		return (lhs.Fee.unwrap() % lhsSize) * rhsSize > (rhs.Fee.unwrap() % rhsSize) * lhsSize;
+	}
+
+	bool TransactionFeeIndex::PriorityComparer::operator()(const Entry* pLhs, const Entry* pRhs) const {
+		if (HasHigherFeePerByte(*pLhs, *pRhs))
+			return true;
+
+		if (HasHigherFeePerByte(*pRhs, *pLhs))
+			return false;
+
+		return pLhs->Id < pRhs->Id;
+	}
+
+	size_t TransactionFeeIndex::size() const {
+		return m_entries.size();
+	}
+
+	const TransactionFeeIndex::Entry* TransactionFeeIndex::lowest() const {
+		return m_tails.empty() ? nullptr : *m_tails.crbegin();
+	}
+
+	std::vector<size_t> TransactionFeeIndex::select(size_t count) const {
+		// successors of selected transactions become eligible as soon as their predecessors are selected,
+		// so merge them with the heads in priority order
+		auto isLowerPriority = [](const auto* pLhs, const auto* pRhs) { return PriorityComparer()(pRhs, pLhs); };
+		std::priority_queue<const Entry*, std::vector<const Entry*>, decltype(isLowerPriority)> successors(isLowerPriority);
+
+		std::vector<size_t> ids;
+		auto headIter = m_heads.cbegin();
+		while (ids.size() < count) {
+			const Entry* pSelected;
+			if (m_heads.cend() != headIter && (successors.empty() || PriorityComparer()(*headIter, successors.top()))) {
+				pSelected = *headIter;
+				++headIter;
+			} else if (!successors.empty()) {
+				pSelected = successors.top();
+				successors.pop();
+			} else {
+				break;
+			}
+
+			ids.push_back(pSelected->Id);
+
+			const auto* pNext = next(*pSelected);
+			if (pNext)
+				successors.push(pNext);
+		}
+
+		std::sort(ids.begin(), ids.end());
+		return ids;
+	}
+
+	void TransactionFeeIndex::add(const Entry& entry) {
+		auto emplaceResult = m_entries.emplace(entry.Id, entry);
+		if (!emplaceResult.second)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("transaction is already indexed", entry.Id);
+
+		const auto& addedEntry = emplaceResult.first->second;
+		const auto* pPrevious = previous(addedEntry);
+		const auto* pNext = next(addedEntry);
+		m_signerIds.emplace(addedEntry.Signer, addedEntry.Id);
+
+		if (!pPrevious) {
+			if (pNext)
+				m_heads.erase(pNext);
+
+			m_heads.insert(&addedEntry);
+		}
+
+		if (!pNext) {
+			if (pPrevious)
+				m_tails.erase(pPrevious);
+
+			m_tails.insert(&addedEntry);
+		}
+	}
+
+	void TransactionFeeIndex::remove(size_t id) {
+		auto iter = m_entries.find(id);
+		if (m_entries.cend() == iter)
+			return;
+
+		const auto& entry = iter->second;
+		const auto* pPrevious = previous(entry);
+		const auto* pNext = next(entry);
+
+		if (!pPrevious) {
+			m_heads.erase(&entry);
+			if (pNext)
+				m_heads.insert(pNext);
+		}
+
+		if (!pNext) {
+			m_tails.erase(&entry);
+			if (pPrevious)
+				m_tails.insert(pPrevious);
+		}
+
+		m_signerIds.erase(SignerIdPair(entry.Signer, entry.Id));
+		m_entries.erase(iter);
+	}
+
+	void TransactionFeeIndex::clear() {
+		m_heads.clear();
+		m_tails.clear();
+		m_signerIds.clear();
+		m_entries.clear();
+	}
+
+	const TransactionFeeIndex::Entry* TransactionFeeIndex::next(const Entry& entry) const {
+		auto iter = m_signerIds.upper_bound(SignerIdPair(entry.Signer, entry.Id));
+		if (m_signerIds.cend() == iter || iter->first != entry.Signer)
+			return nullptr;
+
+		return &m_entries.find(iter->second)->second;
+	}
+
+	const TransactionFeeIndex::Entry* TransactionFeeIndex::previous(const Entry& entry) const {
+		auto iter = m_signerIds.lower_bound(SignerIdPair(entry.Signer, entry.Id));
+		if (m_signerIds.cbegin() == iter || (--iter)->first != entry.Signer)
+			return nullptr;
+
+		return &m_entries.find(iter->second)->second;
+	}
+}}
@@ -0,0 +1,94 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/types.h"
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Index of transactions by fee per byte.
+	/// \note Transactions with the same signer are never reordered relative to each other, so only the first (head)
+	///       transaction of a signer is eligible for selection and only the last (tail) transaction is eligible for eviction.
+	class TransactionFeeIndex : public utils::NonCopyable {
+	public:
+		/// Indexed transaction.
+		struct Entry {
+			/// Transaction id (defines the relative order of transactions).
+			size_t Id;
+
+			/// Transaction signer.
+			Key Signer;
+
+			/// Transaction fee.
+			Amount Fee;
+
+			/// Transaction size.
+			uint32_t Size;
+		};
+
+	public:
+		/// Returns \c true if \a lhs has a strictly higher fee per byte than \a rhs.
+		static bool HasHigherFeePerByte(const Entry& lhs, const Entry& rhs);
+
+	public:
+		/// Gets the number of indexed transactions.
+		size_t size() const;
+
+		/// Gets the transaction with the lowest priority that can be evicted or \c nullptr if the index is empty.
+		const Entry* lowest() const;
+
+		/// Selects the ids of up to \a count transactions with the highest fees per byte.
+		/// \note All transactions that precede a selected transaction and have the same signer are also selected.
+		/// \note The returned ids are sorted by id.
+		std::vector<size_t> select(size_t count) const;
+
+	public:
+		/// Adds \a entry to the index.
+		void add(const Entry& entry);
+
+		/// Removes the transaction with \a id from the index.
+		void remove(size_t id);
+
+		/// Removes all transactions from the index.
+		void clear();
+
+	private:
+		struct PriorityComparer {
+			bool operator()(const Entry* pLhs, const Entry* pRhs) const;
+		};
+
+		using SignerIdPair = std::pair<Key, size_t>;
+		using PrioritySet = std::set<const Entry*, PriorityComparer>;
+
+		const Entry* next(const Entry& entry) const;
+
+		const Entry* previous(const Entry& entry) const;
+
+	private:
+		std::unordered_map<size_t, Entry> m_entries;
+		std::set<SignerIdPair> m_signerIds;
+		PrioritySet m_heads;
+		PrioritySet m_tails;
+	};
+}}
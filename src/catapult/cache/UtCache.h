@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BasicTransactionsCache.h"
+#include "catapult/functions.h"
 #include <vector>
 
 namespace catapult { namespace cache {
@@ -32,6 +33,11 @@ namespace catapult { namespace cache {
 
 		/// Removes all transactions from the cache.
 		virtual std::vector<model::TransactionInfo> removeAll() = 0;
+
+		/// Removes the lowest priority transaction from a full cache if it has a lower priority than \a transactionInfo
+		/// and \a canEvict returns \c true when called after its removal.
+		/// Returns the removed transaction info or an empty transaction info if no transaction was removed.
+		virtual model::TransactionInfo evict(const model::TransactionInfo& transactionInfo, const predicate<>& canEvict) = 0;
 	};
 
 	/// A delegating proxy around a UtCacheModifier.
@@ -50,6 +56,12 @@ namespace catapult { namespace cache {
 		std::vector<model::TransactionInfo> removeAll() {
 			return modifier().removeAll();
 		}
+
+		/// Removes the lowest priority transaction from a full cache if it has a lower priority than \a transactionInfo
+		/// and \a canEvict returns \c true when called after its removal.
+		model::TransactionInfo evict(const model::TransactionInfo& transactionInfo, const predicate<>& canEvict) {
+			return modifier().evict(transactionInfo, canEvict);
+		}
 	};
 
 	/// An interface for caching unconfirmed transactions.
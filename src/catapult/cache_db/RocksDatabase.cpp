@@ -66,24 +66,82 @@ namespace catapult { namespace cache {
 		return { reinterpret_cast<const uint8_t*>(storage().data()), storage().size() };
 	}
 
-	RocksDatabase::RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames) : m_dbDir(dbDir) {
+	namespace {
+		RocksDatabaseSettings CreateDefaultSettings(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames) {
+			RocksDatabaseSettings settings(dbDir);
+			for (const auto& columnFamilyName : columnFamilyNames)
+				settings.Columns.push_back(RocksColumnSettings(columnFamilyName));
+
+			return settings;
+		}
+
+		rocksdb::DBOptions CreateDbOptions(const RocksDatabaseSettings& settings) {
+			rocksdb::DBOptions dbOptions;
+			dbOptions.create_if_missing = true;
+			dbOptions.create_missing_column_families = true;
+
+			if (0 != settings.MaxBackgroundJobs)
+				dbOptions.max_background_jobs = static_cast<int>(settings.MaxBackgroundJobs);
+
+			dbOptions.use_direct_reads = settings.ShouldUseDirectIo;
+			dbOptions.use_direct_io_for_flush_and_compaction = settings.ShouldUseDirectIo;
+			return dbOptions;
+		}
+
+		rocksdb::ColumnFamilyOptions CreateColumnFamilyOptions(
+				const RocksColumnSettings& columnSettings,
+				const std::shared_ptr<rocksdb::Cache>& pBlockCache) {
+			rocksdb::BlockBasedTableOptions tableOptions;
+			if (pBlockCache) {
+				tableOptions.block_cache = pBlockCache;
+
+				// keep index and filter blocks in the (bounded) block cache and pin the most frequently used ones
+				tableOptions.cache_index_and_filter_blocks = true;
+				tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+			}
+
+			if (0 != columnSettings.BloomFilterBitsPerKey)
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(static_cast<int>(columnSettings.BloomFilterBitsPerKey), false));
+
+			rocksdb::ColumnFamilyOptions columnOptions;
+			columnOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+			columnOptions.compression = columnSettings.ShouldEnableCompression ? rocksdb::kLZ4Compression : rocksdb::kNoCompression;
+
+			if (0 != columnSettings.KeySize)
+				columnOptions.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(columnSettings.KeySize));
+
+			if (0 != columnSettings.WriteBufferSize.bytes())
+				columnOptions.write_buffer_size = columnSettings.WriteBufferSize.bytes();
+
+			return columnOptions;
+		}
+	}
+
+	RocksDatabase::RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames)
+			: RocksDatabase(CreateDefaultSettings(dbDir, columnFamilyNames))
+	{}
+
+	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings) : m_dbDir(settings.DatabaseDirectory) {
 		boost::system::error_code ec;
-		boost::filesystem::create_directories(dbDir, ec);
+		boost::filesystem::create_directories(m_dbDir, ec);
 
-		rocksdb::DB* pDb;
-		rocksdb::Options dbOptions;
-		dbOptions.create_if_missing = true;
-		dbOptions.create_missing_column_families = true;
+		std::shared_ptr<rocksdb::Cache> pBlockCache;
+		if (0 != settings.BlockCacheSize.bytes())
+			pBlockCache = rocksdb::NewLRUCache(settings.BlockCacheSize.bytes());
 
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor("default", rocksdb::ColumnFamilyOptions()));
-		for (const auto& columnFamilyName : columnFamilyNames)
-			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, rocksdb::ColumnFamilyOptions()));
+		auto defaultColumnSettings = RocksColumnSettings(rocksdb::kDefaultColumnFamilyName);
+		columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(
+				defaultColumnSettings.Name,
+				CreateColumnFamilyOptions(defaultColumnSettings, pBlockCache)));
+		for (const auto& columnSettings : settings.Columns)
+			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnSettings.Name, CreateColumnFamilyOptions(columnSettings, pBlockCache)));
 
-		auto status = rocksdb::DB::Open(dbOptions, m_dbDir, columnFamilies, &m_handles, &pDb);
+		rocksdb::DB* pDb;
+		auto status = rocksdb::DB::Open(CreateDbOptions(settings), m_dbDir, columnFamilies, &m_handles, &pDb);
 		m_pDb.reset(pDb);
 		if (!status.ok())
-			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", dbDir, status.ToString());
+			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", m_dbDir, status.ToString());
 	}
 
 	RocksDatabase::~RocksDatabase() {
@@ -110,7 +168,9 @@ namespace catapult { namespace cache {
 	}
 
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
-		auto status = m_pDb->Put(rocksdb::WriteOptions(), m_handles[columnId], key, value);
+		auto status = m_pWriteBatch
+				? m_pWriteBatch->Put(m_handles[columnId], key, value)
+				: m_pDb->Put(rocksdb::WriteOptions(), m_handles[columnId], key, value);
 
 		if (!status.ok())
 			ThrowError("could not store value in db (column, key)", columnId, key);
@@ -119,9 +179,33 @@ namespace catapult { namespace cache {
 	void RocksDatabase::del(size_t columnId, const rocksdb::Slice& key) {
 		// note: using SingleDelete can result in undefined result if value has ever been overwritten
 		// that can't be guaranteed, so Delete is used instead
-		auto status = m_pDb->Delete(rocksdb::WriteOptions(), m_handles[columnId], key);
+		auto status = m_pWriteBatch
+				? m_pWriteBatch->Delete(m_handles[columnId], key)
+				: m_pDb->Delete(rocksdb::WriteOptions(), m_handles[columnId], key);
 
 		if (!status.ok())
 			ThrowError("could not remove value from db (column, key)", columnId, key);
 	}
+
+	bool RocksDatabase::isBatching() const {
+		return !!m_pWriteBatch;
+	}
+
+	void RocksDatabase::startBatch() {
+		if (m_pWriteBatch)
+			CATAPULT_THROW_RUNTIME_ERROR_1("write batch has already been started", m_dbDir);
+
+		m_pWriteBatch = std::make_unique<rocksdb::WriteBatch>();
+	}
+
+	void RocksDatabase::flushBatch() {
+		if (!m_pWriteBatch)
+			CATAPULT_THROW_RUNTIME_ERROR_1("write batch has not been started", m_dbDir);
+
+		// release the batch before writing so that a failed write does not leave the database in batching mode
+		auto pWriteBatch = std::move(m_pWriteBatch);
+		auto status = m_pDb->Write(rocksdb::WriteOptions(), pWriteBatch.get());
+		if (!status.ok())
+			CATAPULT_THROW_RUNTIME_ERROR_2("could not write batch to db", m_dbDir, status.ToString());
+	}
 }}
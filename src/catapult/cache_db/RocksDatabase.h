@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "RocksDatabaseSettings.h"
 #include "catapult/types.h"
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@ namespace rocksdb {
 	class DB;
 	class PinnableSlice;
 	class Slice;
+	class WriteBatch;
 }
 
 namespace catapult { namespace cache {
@@ -83,6 +85,9 @@ namespace catapult { namespace cache {
 		/// Creates database in \a dbDir with 'default' column and additional columns (\a columnFamilyNames).
 		RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames);
 
+		/// Creates database with 'default' column and additional columns as described by \a settings.
+		explicit RocksDatabase(const RocksDatabaseSettings& settings);
+
 		/// Destroys database.
 		~RocksDatabase();
 
@@ -96,9 +101,22 @@ namespace catapult { namespace cache {
 		/// Deletes \a key from \a columnId.
 		void del(size_t columnId, const rocksdb::Slice& key);
 
+	public:
+		/// Returns \c true if puts and deletes are currently staged in a write batch.
+		bool isBatching() const;
+
+		/// Starts staging all subsequent puts and deletes (across all columns) in a single write batch.
+		/// \note Staged changes are not visible to get until the batch is flushed.
+		void startBatch();
+
+		/// Atomically writes all staged changes to the database and stops staging.
+		/// \note A batch that is never flushed is discarded.
+		void flushBatch();
+
 	private:
 		std::string m_dbDir;
 		std::shared_ptr<rocksdb::DB> m_pDb;
 		std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
 	};
 }}
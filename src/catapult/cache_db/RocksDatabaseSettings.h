@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/FileSize.h"
+#include <string>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// RocksDb column settings.
+	struct RocksColumnSettings {
+	public:
+		/// Creates settings for a column with \a name.
+		explicit RocksColumnSettings(const std::string& name)
+				: Name(name)
+				, KeySize(0)
+				, BloomFilterBitsPerKey(0)
+				, ShouldEnableCompression(false)
+		{}
+
+	public:
+		/// Column name.
+		std::string Name;
+
+		/// Size of all (non-metadata) keys in the column or \c 0 if keys have variable sizes.
+		/// \note This is used as the prefix extractor length.
+		size_t KeySize;
+
+		/// Number of bloom filter bits per key or \c 0 if bloom filters should be disabled.
+		uint32_t BloomFilterBitsPerKey;
+
+		/// \c true if column data should be compressed.
+		bool ShouldEnableCompression;
+
+		/// Size of the column write buffer or \c 0 if the default size should be used.
+		utils::FileSize WriteBufferSize;
+	};
+
+	/// RocksDb database settings.
+	struct RocksDatabaseSettings {
+	public:
+		/// Creates settings for a database in \a databaseDirectory with default settings.
+		explicit RocksDatabaseSettings(const std::string& databaseDirectory)
+				: DatabaseDirectory(databaseDirectory)
+				, MaxBackgroundJobs(0)
+				, ShouldUseDirectIo(false)
+		{}
+
+	public:
+		/// Database directory.
+		std::string DatabaseDirectory;
+
+		/// Settings of all columns, excluding the 'default' column.
+		std::vector<RocksColumnSettings> Columns;
+
+		/// Size of the block cache shared by all columns or \c 0 if the default block cache should be used.
+		utils::FileSize BlockCacheSize;
+
+		/// Maximum number of concurrent background flushes and compactions or \c 0 if the default should be used.
+		uint32_t MaxBackgroundJobs;
+
+		/// \c true if reads, flushes and compactions should bypass the operating system page cache.
+		bool ShouldUseDirectIo;
+	};
+}}
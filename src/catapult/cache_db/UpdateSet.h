@@ -25,6 +25,7 @@
 namespace catapult { namespace cache {
 
 	/// Applies all changes in \a deltas to \a elements.
+	/// \note When the underlying database is batching, all changes (including the new size) are staged in its write batch.
 	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet>
 	void UpdateSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const deltaset::DeltaElements<TMemorySet>& deltas) {
 		auto size = elements.size();
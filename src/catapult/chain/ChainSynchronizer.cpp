@@ -22,6 +22,7 @@
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
 #include <queue>
@@ -217,6 +218,137 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// region parallel download
+
+		using RemoteChainApis = std::vector<std::shared_ptr<const api::RemoteChainApi>>;
+
+		struct BlockChunk {
+			Height StartHeight;
+			std::vector<Hash256> Hashes;
+		};
+
+		std::vector<BlockChunk> SplitIntoChunks(const model::HashRange& hashes, Height startHeight, size_t numPeers, uint32_t maxBlocks) {
+			// distribute the hashes evenly across all peers without exceeding the maximum number of blocks per request
+			auto chunkSize = std::min<size_t>(maxBlocks, (hashes.size() + numPeers - 1) / numPeers);
+			std::vector<BlockChunk> chunks;
+			auto height = startHeight;
+			for (const auto& hash : hashes) {
+				if (chunks.size() == numPeers && chunks.back().Hashes.size() == chunkSize)
+					break;
+
+				if (chunks.empty() || chunks.back().Hashes.size() == chunkSize)
+					chunks.push_back(BlockChunk{ height, {} });
+
+				chunks.back().Hashes.push_back(hash);
+				height = height + Height(1);
+			}
+
+			return chunks;
+		}
+
+		bool IsMatchingChunk(const model::BlockRange& range, const BlockChunk& chunk) {
+			if (range.size() != chunk.Hashes.size())
+				return false;
+
+			auto height = chunk.StartHeight;
+			auto hashIter = chunk.Hashes.cbegin();
+			for (const auto& block : range) {
+				if (height != block.Height || *hashIter != model::CalculateHash(block))
+					return false;
+
+				height = height + Height(1);
+				++hashIter;
+			}
+
+			return true;
+		}
+
+		NodeInteractionFuture AddChunks(
+				const api::RemoteChainApi& remoteChainApi,
+				std::vector<thread::future<model::BlockRange>>&& rangeFutures,
+				const std::vector<BlockChunk>& chunks,
+				const api::BlocksFromOptions& options,
+				UnprocessedElements& unprocessedElements) {
+			// ranges must be added in height order, so stop at the first chunk that was not delivered as expected
+			auto numAddedChunks = 0u;
+			for (; numAddedChunks < chunks.size(); ++numAddedChunks) {
+				const auto& chunk = chunks[numAddedChunks];
+				try {
+					auto range = rangeFutures[numAddedChunks].get();
+					if (!IsMatchingChunk(range, chunk)) {
+						CATAPULT_LOG(warning) << "peer returned blocks not matching reference hashes from height " << chunk.StartHeight;
+						break;
+					}
+
+					if (!unprocessedElements.add(std::move(range)))
+						return thread::make_ready_future(0 == numAddedChunks ? NodeInteractionResult::Neutral : NodeInteractionResult::Success);
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting blocks from height " << chunk.StartHeight << ": " << e.what();
+					break;
+				}
+			}
+
+			if (chunks.size() == numAddedChunks)
+				return thread::make_ready_future(NodeInteractionResult::Success);
+
+			// reassign the first undelivered chunk to the synchronized peer, which is the source of the reference hashes
+			CATAPULT_LOG(debug) << "pulling blocks from remote starting at height " << chunks[numAddedChunks].StartHeight;
+			auto future = ChainBlocksFrom(
+					CreateFutureSupplier(remoteChainApi, options),
+					chunks[numAddedChunks].StartHeight,
+					0,
+					std::make_shared<RangeAggregator>(),
+					unprocessedElements);
+			if (0 == numAddedChunks)
+				return future;
+
+			return future.then([](auto&& resultFuture) {
+				auto result = resultFuture.get();
+				return NodeInteractionResult::Failure == result ? result : NodeInteractionResult::Success;
+			});
+		}
+
+		NodeInteractionFuture ParallelChainBlocksFrom(
+				const api::RemoteChainApi& remoteChainApi,
+				const std::shared_ptr<RemoteChainApis>& pHelperApis,
+				Height height,
+				const api::BlocksFromOptions& options,
+				UnprocessedElements& unprocessedElements) {
+			// use the hashes of the synchronized peer as reference and download disjoint chunks from all peers concurrently
+			return thread::compose(
+					remoteChainApi.hashesFrom(height),
+					[&remoteChainApi, pHelperApis, height, options, &unprocessedElements](auto&& hashesFuture) {
+						try {
+							auto pChunks = std::make_shared<std::vector<BlockChunk>>(
+									SplitIntoChunks(hashesFuture.get(), height, 1 + pHelperApis->size(), options.NumBlocks));
+							if (pChunks->empty()) {
+								CATAPULT_LOG(info) << "peer returned 0 hashes";
+								return thread::make_ready_future(NodeInteractionResult::Neutral);
+							}
+
+							std::vector<thread::future<model::BlockRange>> rangeFutures;
+							for (auto i = 0u; i < pChunks->size(); ++i) {
+								const auto& chunk = (*pChunks)[i];
+								const auto& peerApi = 0 == i ? remoteChainApi : *(*pHelperApis)[i - 1];
+								auto chunkOptions = api::BlocksFromOptions(static_cast<uint32_t>(chunk.Hashes.size()), options.NumBytes);
+								rangeFutures.push_back(peerApi.blocksFrom(chunk.StartHeight, chunkOptions));
+							}
+
+							// pHelperApis is captured in order to keep the helper peers alive until all chunks are delivered
+							return thread::compose(
+									thread::when_all(std::move(rangeFutures)),
+									[&remoteChainApi, pHelperApis, pChunks, options, &unprocessedElements](auto&& rangesFuture) {
+										return AddChunks(remoteChainApi, rangesFuture.get(), *pChunks, options, unprocessedElements);
+									});
+						} catch (const catapult_runtime_error& e) {
+							CATAPULT_LOG(warning) << "exception thrown while requesting hashes: " << e.what();
+							return thread::make_ready_future(NodeInteractionResult::Failure);
+						}
+			});
+		}
+
+		// endregion
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -227,10 +359,13 @@ namespace catapult { namespace chain {
 			explicit DefaultChainSynchronizer(
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
-					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
+					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+					const RemoteChainApisSupplier& helperApisSupplier)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxRollbackBlocks, config.MaxChainBytesPerSyncAttempt)
+					, m_maxHelperPeers(config.MaxHelperPeers)
+					, m_helperApisSupplier(helperApisSupplier)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
 							3 * config.MaxChainBytesPerSyncAttempt))
@@ -290,6 +425,20 @@ namespace catapult { namespace chain {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
+
+				// when the remote chain extends the local chain, blocks can be downloaded from helper peers in parallel
+				if (0 == compareResult.ForkDepth && 0 != m_maxHelperPeers && m_helperApisSupplier) {
+					auto pHelperApis = std::make_shared<RemoteChainApis>(m_helperApisSupplier(m_maxHelperPeers));
+					if (!pHelperApis->empty()) {
+						return ParallelChainBlocksFrom(
+								remoteChainApi,
+								pHelperApis,
+								compareResult.CommonBlockHeight + Height(1),
+								m_blocksFromOptions,
+								*m_pUnprocessedElements);
+					}
+				}
+
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
 						compareResult.CommonBlockHeight + Height(1),
@@ -302,6 +451,8 @@ namespace catapult { namespace chain {
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
+			uint32_t m_maxHelperPeers;
+			RemoteChainApisSupplier m_helperApisSupplier;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
 		};
 	}
@@ -310,7 +461,15 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
-		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
+		return CreateChainSynchronizer(pLocalChainApi, config, blockRangeConsumer, RemoteChainApisSupplier());
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+			const RemoteChainApisSupplier& helperApisSupplier) {
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer, helperApisSupplier);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
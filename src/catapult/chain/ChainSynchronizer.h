@@ -22,6 +22,7 @@
 #include "RemoteNodeSynchronizer.h"
 #include "catapult/disruptor/DisruptorTypes.h"
 #include "catapult/model/RangeTypes.h"
+#include <vector>
 
 namespace catapult {
 	namespace api {
@@ -41,6 +42,9 @@ namespace catapult { namespace chain {
 			model::BlockRange&&,
 			const disruptor::ProcessingCompleteFunc&)>;
 
+	/// Function signature for supplying up to the specified number of remote chain apis.
+	using RemoteChainApisSupplier = std::function<std::vector<std::shared_ptr<const api::RemoteChainApi>> (size_t)>;
+
 	/// Configuration for customizing a chain synchronizer.
 	struct ChainSynchronizerConfiguration {
 		/// Maximum number of blocks per sync attempt.
@@ -51,6 +55,9 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Maximum number of additional peers that blocks are downloaded from in parallel.
+		uint32_t MaxHelperPeers;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
@@ -59,4 +66,14 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
+	/// a block range consumer (\a blockRangeConsumer) that downloads blocks in parallel from helper peers supplied by
+	/// \a helperApisSupplier.
+	/// \note Helper peers only deliver blocks with hashes matching the ones reported by the synchronized peer.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+			const RemoteChainApisSupplier& helperApisSupplier);
 }}
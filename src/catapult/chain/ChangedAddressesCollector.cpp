@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ChangedAddressesCollector.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/Notifications.h"
+
+namespace catapult { namespace chain {
+
+	ChangedAddressesCollector::ChangedAddressesCollector(model::NetworkIdentifier networkIdentifier)
+			: m_networkIdentifier(networkIdentifier)
+			, m_hasUntrackedChanges(false)
+	{}
+
+	const model::AddressSet& ChangedAddressesCollector::addresses() const {
+		return m_addresses;
+	}
+
+	bool ChangedAddressesCollector::hasUntrackedChanges() const {
+		return m_hasUntrackedChanges;
+	}
+
+	void ChangedAddressesCollector::notify(const model::Notification& notification) {
+		// only notifications that are observed can change state
+		if (!model::IsSet(notification.Type, model::NotificationChannel::Observer))
+			return;
+
+		// use if/else instead of switch to work around VS warning
+		if (model::Core_Register_Account_Address_Notification == notification.Type) {
+			addAccount(static_cast<const model::AccountAddressNotification&>(notification).Address);
+		} else if (model::Core_Register_Account_Public_Key_Notification == notification.Type) {
+			addAccount(static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey);
+		} else if (model::Core_Balance_Transfer_Notification == notification.Type) {
+			const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+			addAccount(transferNotification.Sender);
+			addAccount(transferNotification.Recipient);
+		} else if (model::Core_Transaction_Notification == notification.Type) {
+			// the transaction hash only affects the transaction itself, which is never revalidated
+			// (plugins can use this notification to release locked balances, but a credit never invalidates a transaction)
+			addAccount(static_cast<const model::TransactionNotification&>(notification).Signer);
+		} else {
+			// all other notifications (including block and plugin notifications) can change arbitrary state
+			m_hasUntrackedChanges = true;
+		}
+	}
+
+	void ChangedAddressesCollector::addAccount(const Key& publicKey) {
+		// accounts can be referenced by public key or address, so always track them by address
+		addAccount(model::PublicKeyToAddress(publicKey, m_networkIdentifier));
+	}
+
+	void ChangedAddressesCollector::addAccount(const Address& address) {
+		m_addresses.insert(address);
+	}
+}}
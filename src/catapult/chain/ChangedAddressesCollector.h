@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/model/NetworkInfo.h"
+#include "catapult/model/NotificationSubscriber.h"
+
+namespace catapult { namespace chain {
+
+	/// A notification subscriber that collects the addresses of all accounts changed by observable notifications.
+	/// \note Changes to state that is not keyed by account (e.g. namespaces, mosaics, multisig or locks) cannot be
+	///       collected as addresses and are only flagged.
+	class ChangedAddressesCollector : public model::NotificationSubscriber {
+	public:
+		/// Creates a collector for entities on the network identified by \a networkIdentifier.
+		explicit ChangedAddressesCollector(model::NetworkIdentifier networkIdentifier);
+
+	public:
+		/// Gets the addresses of all changed accounts.
+		const model::AddressSet& addresses() const;
+
+		/// Returns \c true if state that is not keyed by account is changed.
+		bool hasUntrackedChanges() const;
+
+	public:
+		void notify(const model::Notification& notification) override;
+
+	private:
+		void addAccount(const Key& publicKey);
+		void addAccount(const Address& address);
+
+	private:
+		model::NetworkIdentifier m_networkIdentifier;
+		model::AddressSet m_addresses;
+		bool m_hasUntrackedChanges;
+	};
+}}
@@ -33,6 +33,7 @@ namespace catapult { namespace chain {
 			, m_observer(observer)
 			, m_observerContext(observerContext)
 			, m_aggregateResult(validators::ValidationResult::Success)
+			, m_isValidationEnabled(true)
 			, m_isUndoEnabled(false)
 	{}
 
@@ -40,6 +41,10 @@ namespace catapult { namespace chain {
 		return m_aggregateResult;
 	}
 
+	void ProcessingNotificationSubscriber::disableValidation() {
+		m_isValidationEnabled = false;
+	}
+
 	void ProcessingNotificationSubscriber::enableUndo() {
 		m_isUndoEnabled = true;
 	}
@@ -79,7 +84,7 @@ namespace catapult { namespace chain {
 	}
 
 	void ProcessingNotificationSubscriber::validate(const model::Notification& notification) {
-		if (!IsSet(notification.Type, model::NotificationChannel::Validator))
+		if (!m_isValidationEnabled || !IsSet(notification.Type, model::NotificationChannel::Validator))
 			return;
 
 		auto result = m_validator.validate(notification, m_validatorContext);
@@ -20,12 +20,14 @@
 
 #include "UtUpdater.h"
 #include "ChainResults.h"
+#include "ChangedAddressesCollector.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
 #include "catapult/cache/UtCache.h"
 #include "catapult/utils/HexFormatter.h"
+#include <algorithm>
 
 namespace catapult { namespace chain {
 
@@ -39,6 +41,68 @@ namespace catapult { namespace chain {
 			cache::UtCacheModifierProxy& Modifier;
 			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
 		};
+
+		class ChangedAccountsTracker {
+		public:
+			explicit ChangedAccountsTracker(const model::AddressSet& changedAddresses)
+					: m_changedAddresses(changedAddresses)
+					, m_isComplete(true)
+			{}
+
+		public:
+			bool isAffected(const model::TransactionInfo& utInfo) const {
+				// conservatively treat transactions without extracted addresses as affected
+				if (!m_isComplete || !utInfo.OptionalExtractedAddresses)
+					return true;
+
+				const auto& addresses = *utInfo.OptionalExtractedAddresses;
+				return std::any_of(addresses.cbegin(), addresses.cend(), [this](const auto& address) {
+					return m_changedAddresses.cend() != m_changedAddresses.find(address);
+				});
+			}
+
+			void add(const model::TransactionInfo& utInfo) {
+				if (!utInfo.OptionalExtractedAddresses) {
+					addUntrackedChanges();
+					return;
+				}
+
+				const auto& addresses = *utInfo.OptionalExtractedAddresses;
+				m_changedAddresses.insert(addresses.cbegin(), addresses.cend());
+			}
+
+			void addUntrackedChanges() {
+				m_isComplete = false;
+			}
+
+		private:
+			model::AddressSet m_changedAddresses;
+			bool m_isComplete;
+		};
+
+		// forwards notifications to a subscriber and detects changes to state that is not keyed by account
+		class ChangeDetectingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			ChangeDetectingNotificationSubscriber(model::NotificationSubscriber& subscriber, model::NetworkIdentifier networkIdentifier)
+					: m_subscriber(subscriber)
+					, m_collector(networkIdentifier)
+			{}
+
+		public:
+			bool hasUntrackedChanges() const {
+				return m_collector.hasUntrackedChanges();
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_subscriber.notify(notification);
+				m_collector.notify(notification);
+			}
+
+		private:
+			model::NotificationSubscriber& m_subscriber;
+			ChangedAddressesCollector m_collector;
+		};
 	}
 
 	class UtUpdater::Impl final {
@@ -56,6 +120,7 @@ namespace catapult { namespace chain {
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_hasUnvalidatedTransactions(false)
 		{}
 
 	public:
@@ -67,6 +132,7 @@ namespace catapult { namespace chain {
 				// if there is no unconfirmed cache state, it means that a block update is forthcoming
 				// just add all to the cache and they will be validated later
 				addAll(modifier, utInfos);
+				m_hasUnvalidatedTransactions = true;
 				return;
 			}
 
@@ -74,7 +140,10 @@ namespace catapult { namespace chain {
 			apply(applyState, utInfos, TransactionSource::New);
 		}
 
-		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				ChangedAccountsTracker* pChangedAccountsTracker) {
 			if (!confirmedTransactionHashes.empty() || !utInfos.empty()) {
 				CATAPULT_LOG(debug)
 						<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
@@ -84,18 +153,29 @@ namespace catapult { namespace chain {
 			// 1. lock the catapult cache and rebase the unconfirmed catapult cache
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
+			// - transactions that were added without validation need to be validated irrespective of changed accounts
+			if (m_hasUnvalidatedTransactions) {
+				pChangedAccountsTracker = nullptr;
+				m_hasUnvalidatedTransactions = false;
+			}
+
 			// 2. lock and clear the UT cache
 			auto modifier = m_transactionsCache.modifier();
 			auto originalTransactionInfos = modifier.removeAll();
 
-			// 3. add back reverted txes
+			// 3. add back reverted txes (all accounts referenced by reverted txes are changed)
 			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
 			apply(applyState, utInfos, TransactionSource::Reverted);
+			if (pChangedAccountsTracker) {
+				for (const auto& utInfo : utInfos)
+					pChangedAccountsTracker->add(utInfo);
+			}
 
 			// 4. add back original txes that have not been confirmed
-			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
+			auto filter = [&confirmedTransactionHashes](const auto& info) {
 				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
-			});
+			};
+			apply(applyState, originalTransactionInfos, TransactionSource::Existing, filter, pChangedAccountsTracker);
 		}
 
 	private:
@@ -107,7 +187,8 @@ namespace catapult { namespace chain {
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
-				const predicate<const model::TransactionInfo&>& filter) {
+				const predicate<const model::TransactionInfo&>& filter,
+				ChangedAccountsTracker* pChangedAccountsTracker = nullptr) {
 			auto currentTime = m_timeSupplier();
 
 			auto readOnlyCache = applyState.UnconfirmedCatapultCache.toReadOnly();
@@ -128,20 +209,45 @@ namespace catapult { namespace chain {
 				if (!filter(utInfo))
 					continue;
 
-				if (throttle(utInfo, transactionSource, applyState, readOnlyCache)) {
+				// when changed accounts are tracked, dropping a transaction changes all accounts referenced by it
+				// because its (previously observed) changes are no longer applied
+				// (changes to state that is not keyed by account cannot be tracked, so all subsequent transactions are affected)
+				auto markChanged = [pChangedAccountsTracker, &utInfo](bool hasUntrackedChanges) {
+					if (!pChangedAccountsTracker)
+						return;
+
+					pChangedAccountsTracker->add(utInfo);
+					if (hasUntrackedChanges)
+						pChangedAccountsTracker->addUntrackedChanges();
+				};
+
+				if (throttle(utInfo, transactionSource, applyState, readOnlyCache) && !evict(utInfo, transactionSource, applyState, readOnlyCache)) {
 					CATAPULT_LOG(warning) << "dropping transaction " << utils::HexFormat(entityHash) << " due to throttle";
 					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+
+					// the changes of the dropped transaction are unknown because it was not executed
+					markChanged(true);
 					continue;
 				}
 
-				if (!applyState.Modifier.add(utInfo))
+				if (!applyState.Modifier.add(utInfo)) {
+					markChanged(false);
 					continue;
+				}
 
 				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
 				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
+				if (!requiresValidation(utInfo, currentTime, pChangedAccountsTracker)) {
+					// the transaction only depends on unchanged accounts and was valid before, so just reapply its changes
+					sub.disableValidation();
+					m_config.pNotificationPublisher->publish(model::WeakEntityInfo(entity, entityHash), sub);
+					continue;
+				}
+
 				sub.enableUndo();
 				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
-				m_config.pNotificationPublisher->publish(entityInfo, sub);
+				ChangeDetectingNotificationSubscriber changeDetectingSub(sub, m_config.Network.Identifier);
+				m_config.pNotificationPublisher->publish(entityInfo, changeDetectingSub);
 				if (!IsValidationResultSuccess(sub.result())) {
 					CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
 							<< "dropping transaction " << utils::HexFormat(entityHash) << ": " << sub.result();
@@ -152,11 +258,20 @@ namespace catapult { namespace chain {
 
 					sub.undo();
 					applyState.Modifier.remove(entityHash);
+					markChanged(changeDetectingSub.hasUntrackedChanges());
 					continue;
 				}
 			}
 		}
 
+		static bool requiresValidation(
+				const model::TransactionInfo& utInfo,
+				Timestamp currentTime,
+				const ChangedAccountsTracker* pChangedAccountsTracker) {
+			// expired transactions always need to be revalidated (and rejected)
+			return !pChangedAccountsTracker || pChangedAccountsTracker->isAffected(utInfo) || currentTime > utInfo.pEntity->Deadline;
+		}
+
 		bool throttle(
 				const model::TransactionInfo& utInfo,
 				TransactionSource transactionSource,
@@ -165,6 +280,30 @@ namespace catapult { namespace chain {
 			return m_throttle(utInfo, { transactionSource, m_detachedCatapultCache.height(), cache, applyState.Modifier });
 		}
 
+		bool evict(
+				const model::TransactionInfo& utInfo,
+				TransactionSource transactionSource,
+				const ApplyState& applyState,
+				cache::ReadOnlyCatapultCache& cache) {
+			// make room for a throttled transaction by evicting a lower priority transaction (only supported by some caches)
+			// but only if the throttle accepts the transaction once the evicted transaction is gone
+			auto evictedUtInfo = applyState.Modifier.evict(utInfo, [this, &utInfo, transactionSource, &applyState, &cache]() {
+				return !throttle(utInfo, transactionSource, applyState, cache);
+			});
+			if (!evictedUtInfo)
+				return false;
+
+			CATAPULT_LOG(debug)
+					<< "evicting transaction " << utils::HexFormat(evictedUtInfo.EntityHash)
+					<< " in favor of " << utils::HexFormat(utInfo.EntityHash);
+			m_failedTransactionSink(*evictedUtInfo.pEntity, evictedUtInfo.EntityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+
+			// the changes of the evicted transaction are not undone, so transactions observed after it
+			// (possibly depending on it) need to be validated again when the unconfirmed cache is rebased
+			m_hasUnvalidatedTransactions = true;
+			return true;
+		}
+
 		void addAll(cache::UtCacheModifierProxy& modifier, const std::vector<model::TransactionInfo>& utInfos) {
 			for (const auto& utInfo : utInfos)
 				modifier.add(utInfo);
@@ -177,6 +316,7 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		bool m_hasUnvalidatedTransactions;
 	};
 
 	UtUpdater::UtUpdater(
@@ -202,6 +342,14 @@ namespace catapult { namespace chain {
 	}
 
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
-		m_pImpl->update(confirmedTransactionHashes, utInfos);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, nullptr);
+	}
+
+	void UtUpdater::update(
+			const utils::HashPointerSet& confirmedTransactionHashes,
+			const std::vector<model::TransactionInfo>& utInfos,
+			const model::AddressSet& changedAddresses) {
+		ChangedAccountsTracker changedAccountsTracker(changedAddresses);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, &changedAccountsTracker);
 	}
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "ChainFunctions.h"
 #include "ExecutionConfiguration.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/ArraySet.h"
@@ -71,6 +72,8 @@ namespace catapult { namespace chain {
 		/// current time supplier (\a timeSupplier) and failed transaction sink (\a failedTransactionSink).
 		/// \a confirmedCatapultCache is the real (confirmed) catapult cache.
 		/// \a throttle allows throttling (rejection) of transactions.
+		/// \note A throttled transaction is accepted if \a transactionsCache evicts a lower priority transaction to make room for it
+		///       and \a throttle accepts it afterwards.
 		UtUpdater(
 				cache::UtCache& transactionsCache,
 				const cache::CatapultCache& confirmedCatapultCache,
@@ -90,6 +93,17 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Updates this cache by applying new transaction infos in \a utInfos and
+		/// removing transactions with hashes in \a confirmedTransactionHashes.
+		/// \a changedAddresses are the addresses of all accounts changed by the confirmed transactions and their blocks.
+		/// \note Existing transactions are only revalidated when they reference a changed account (or an account referenced
+		///       by a transaction that was not reapplied) or their deadlines have passed; other existing transactions are
+		///       reapplied without validation.
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::AddressSet& changedAddresses);
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
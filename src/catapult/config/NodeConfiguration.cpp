@@ -40,12 +40,17 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAllowAddressReuse);
 		LOAD_NODE_PROPERTY(ShouldUseSingleThreadPool);
 		LOAD_NODE_PROPERTY(ShouldUseCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(ShouldCalculateCacheStateRoots);
+		LOAD_NODE_PROPERTY(ShouldUseSegmentedBlockStorage);
+		LOAD_NODE_PROPERTY(BlockStorageCacheMaxSize);
+		LOAD_NODE_PROPERTY(StateCheckpointInterval);
 
 		LOAD_NODE_PROPERTY(ShouldEnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxHelperPeersPerSyncAttempt);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -54,6 +59,8 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(ShouldPrioritizeUnconfirmedTransactionsByFee);
+		LOAD_NODE_PROPERTY(UnconfirmedTransactionsFullRevalidationInterval);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -103,7 +110,7 @@ namespace catapult { namespace config {
 		auto extensionsPair = utils::ExtractSectionAsUnorderedSet(bag, "extensions");
 		config.Extensions = extensionsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 29 + 4 + 2 + 3 + extensionsPair.second);
+		utils::VerifyBagSizeLte(bag, 36 + 4 + 2 + 3 + extensionsPair.second);
 		return config;
 	}
 
@@ -47,6 +47,18 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
+		/// \c true if cache state roots should be calculated.
+		bool ShouldCalculateCacheStateRoots;
+
+		/// \c true if blocks should be stored in segment files instead of in one file per block.
+		bool ShouldUseSegmentedBlockStorage;
+
+		/// Maximum size of all blocks that are kept in memory by the block storage cache.
+		utils::FileSize BlockStorageCacheMaxSize;
+
+		/// Number of blocks between local node state checkpoints (\c 0 disables checkpoints).
+		uint32_t StateCheckpointInterval;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -59,6 +71,9 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of additional peers that blocks are downloaded from in parallel per sync attempt.
+		uint32_t MaxHelperPeersPerSyncAttempt;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -77,6 +92,13 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		uint32_t UnconfirmedTransactionsCacheMaxSize;
 
+		/// \c true if unconfirmed transactions should be harvested and evicted according to their fees per byte.
+		bool ShouldPrioritizeUnconfirmedTransactionsByFee;
+
+		/// Number of block commits after which all unconfirmed transactions are revalidated (\c 0 to always revalidate).
+		/// \note In between, only unconfirmed transactions referencing accounts changed by the committed blocks are revalidated.
+		uint32_t UnconfirmedTransactionsFullRevalidationInterval;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -26,18 +26,26 @@
 namespace catapult { namespace consumers {
 
 	namespace {
-		template<typename TTransactionElements>
-		void UpdateAddresses(TTransactionElements& elements, const model::NotificationPublisher& notificationPublisher) {
-			for (auto& element : elements) {
-				auto addresses = ExtractAddresses(element.Transaction, notificationPublisher);
-				element.OptionalExtractedAddresses = std::make_shared<decltype(addresses)>(std::move(addresses));
-			}
+		void UpdateAddresses(
+				const std::vector<model::TransactionElement*>& elements,
+				const model::NotificationPublisher& notificationPublisher,
+				const ParallelConsumerPolicy& parallelPolicy) {
+			parallelPolicy.process(elements, [&notificationPublisher](auto itBegin, auto itEnd) {
+				for (auto iter = itBegin; itEnd != iter; ++iter) {
+					auto& element = **iter;
+					auto addresses = ExtractAddresses(element.Transaction, notificationPublisher);
+					element.OptionalExtractedAddresses = std::make_shared<decltype(addresses)>(std::move(addresses));
+				}
+			});
 		}
 
 		class BlockAddressExtractionConsumer {
 		public:
-			explicit BlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher)
+			BlockAddressExtractionConsumer(
+					const model::NotificationPublisher& notificationPublisher,
+					const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy)
 					: m_notificationPublisher(notificationPublisher)
+					, m_pParallelPolicy(pParallelPolicy)
 			{}
 
 		public:
@@ -45,26 +53,41 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				for (auto& element : elements)
-					UpdateAddresses(element.Transactions, m_notificationPublisher);
+				std::vector<model::TransactionElement*> transactionElements;
+				for (auto& element : elements) {
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
+
+				UpdateAddresses(transactionElements, m_notificationPublisher, *m_pParallelPolicy);
 
 				return Continue();
 			}
 
 		private:
 			const model::NotificationPublisher& m_notificationPublisher;
+			std::shared_ptr<const ParallelConsumerPolicy> m_pParallelPolicy;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher) {
-		return BlockAddressExtractionConsumer(notificationPublisher);
+		return CreateBlockAddressExtractionConsumer(notificationPublisher, std::make_shared<ParallelConsumerPolicy>(nullptr, 1));
+	}
+
+	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(
+			const model::NotificationPublisher& notificationPublisher,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+		return BlockAddressExtractionConsumer(notificationPublisher, pParallelPolicy);
 	}
 
 	namespace {
 		class TransactionAddressExtractionConsumer {
 		public:
-			explicit TransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher)
+			TransactionAddressExtractionConsumer(
+					const model::NotificationPublisher& notificationPublisher,
+					const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy)
 					: m_notificationPublisher(notificationPublisher)
+					, m_pParallelPolicy(pParallelPolicy)
 			{}
 
 		public:
@@ -72,17 +95,28 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				UpdateAddresses(elements, m_notificationPublisher);
+				std::vector<model::TransactionElement*> transactionElements;
+				for (auto& element : elements)
+					transactionElements.push_back(&element);
+
+				UpdateAddresses(transactionElements, m_notificationPublisher, *m_pParallelPolicy);
 
 				return Continue();
 			}
 
 		private:
 			const model::NotificationPublisher& m_notificationPublisher;
+			std::shared_ptr<const ParallelConsumerPolicy> m_pParallelPolicy;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher) {
-		return TransactionAddressExtractionConsumer(notificationPublisher);
+		return CreateTransactionAddressExtractionConsumer(notificationPublisher, std::make_shared<ParallelConsumerPolicy>(nullptr, 1));
+	}
+
+	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(
+			const model::NotificationPublisher& notificationPublisher,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+		return TransactionAddressExtractionConsumer(notificationPublisher, pParallelPolicy);
 	}
 }}
@@ -25,6 +25,13 @@
 #include "catapult/chain/ChainResults.h"
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/model/NotificationBuffer.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <boost/asio/io_service.hpp>
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
 
 using namespace catapult::validators;
 
@@ -41,13 +48,175 @@ namespace catapult { namespace consumers {
 			return chain::IsChainLink(parentBlockInfo.entity(), parentBlockInfo.hash(), elements[0].Block);
 		}
 
-		class DefaultBlockChainProcessor {
+		// region NoOpPipeline
+
+		class NoOpPipeline {
+		public:
+			NoOpPipeline(const chain::BatchEntityProcessor& batchEntityProcessor, const BlockElements&)
+					: m_batchEntityProcessor(batchEntityProcessor)
+			{}
+
+		public:
+			const chain::BatchEntityProcessor& batchEntityProcessor() const {
+				return m_batchEntityProcessor;
+			}
+
+			void prepare(size_t)
+			{}
+
+		private:
+			const chain::BatchEntityProcessor& m_batchEntityProcessor;
+		};
+
+		// endregion
+
+		// region PrepublishingPipeline
+
+		// notifications published for a single block and all of its transactions
+		class PrepublishedBlock {
+		public:
+			explicit PrepublishedBlock(const model::BlockElement& element)
+					: m_entityInfos(ExtractEntityInfos(element))
+					, m_notificationBuffers(m_entityInfos.size()) {
+				for (auto i = 0u; i < m_entityInfos.size(); ++i)
+					m_entityIndexes.emplace(&m_entityInfos[i].entity(), i);
+			}
+
+		public:
+			const model::NotificationBuffer* tryFind(const model::VerifiableEntity& entity) const {
+				auto iter = m_entityIndexes.find(&entity);
+				return m_entityIndexes.cend() == iter ? nullptr : &m_notificationBuffers[iter->second];
+			}
+
+		public:
+			void publish(const model::NotificationPublisher& publisher, thread::IoServiceThreadPool& pool) {
+				m_future = thread::ParallelFor(pool.service(), m_entityInfos, pool.numWorkerThreads(), [this, &publisher](
+						const auto& entityInfo,
+						auto index) {
+					publisher.publish(entityInfo, m_notificationBuffers[index]);
+					return true;
+				});
+			}
+
+			void wait() {
+				if (m_future.valid())
+					m_future.get();
+			}
+
+		private:
+			model::WeakEntityInfos m_entityInfos;
+			std::vector<model::NotificationBuffer> m_notificationBuffers;
+			std::unordered_map<const model::VerifiableEntity*, size_t> m_entityIndexes;
+			thread::future<bool> m_future;
+		};
+
+		// notification publisher that replays the notifications of the block being executed, which were published ahead of time
+		class PrepublishingNotificationPublisher : public model::NotificationPublisher {
+		public:
+			explicit PrepublishingNotificationPublisher(const model::NotificationPublisher& publisher)
+					: m_publisher(publisher)
+					, m_pCurrentBlock(nullptr)
+			{}
+
+		public:
+			void setCurrentBlock(const PrepublishedBlock* pCurrentBlock) {
+				m_pCurrentBlock = pCurrentBlock;
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				const auto* pNotificationBuffer = m_pCurrentBlock ? m_pCurrentBlock->tryFind(entityInfo.entity()) : nullptr;
+				if (pNotificationBuffer)
+					pNotificationBuffer->replay(sub);
+				else
+					m_publisher.publish(entityInfo, sub);
+			}
+
+		private:
+			const model::NotificationPublisher& m_publisher;
+			const PrepublishedBlock* m_pCurrentBlock;
+		};
+
+		struct PrepublishingContext {
+		public:
+			PrepublishingContext(
+					const chain::ExecutionConfiguration& executionConfig,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool,
+					size_t numLookaheadBlocks)
+					: ExecutionConfig(executionConfig)
+					, pPool(pPool)
+					, NumLookaheadBlocks(numLookaheadBlocks)
+			{}
+
+		public:
+			chain::ExecutionConfiguration ExecutionConfig;
+			std::shared_ptr<thread::IoServiceThreadPool> pPool;
+			size_t NumLookaheadBlocks;
+		};
+
+		class PrepublishingPipeline {
+		public:
+			PrepublishingPipeline(const PrepublishingContext& context, const BlockElements& elements)
+					: m_context(context)
+					, m_elements(elements)
+					, m_pPublisher(std::make_shared<PrepublishingNotificationPublisher>(*m_context.ExecutionConfig.pNotificationPublisher))
+					, m_numScheduledBlocks(0) {
+				// route all publishing of the batch entity processor through the prepublishing publisher
+				auto executionConfig = m_context.ExecutionConfig;
+				executionConfig.pNotificationPublisher = m_pPublisher;
+				m_batchEntityProcessor = chain::CreateBatchEntityProcessor(executionConfig);
+			}
+
+			~PrepublishingPipeline() {
+				// wait for all outstanding publishing before releasing the notification buffers
+				for (auto& pBlock : m_pendingBlocks)
+					pBlock->wait();
+			}
+
+		public:
+			const chain::BatchEntityProcessor& batchEntityProcessor() const {
+				return m_batchEntityProcessor;
+			}
+
+			void prepare(size_t index) {
+				// retire the previously executed block (blocks are always prepared in order)
+				if (0 != index) {
+					m_pPublisher->setCurrentBlock(nullptr);
+					m_pendingBlocks.pop_front();
+				}
+
+				// keep publishing up to NumLookaheadBlocks ahead of the block being executed
+				const auto& publisher = *m_context.ExecutionConfig.pNotificationPublisher;
+				auto maxScheduledBlocks = std::min(m_elements.size(), index + 1 + m_context.NumLookaheadBlocks);
+				for (; m_numScheduledBlocks < maxScheduledBlocks; ++m_numScheduledBlocks) {
+					m_pendingBlocks.push_back(std::make_unique<PrepublishedBlock>(m_elements[m_numScheduledBlocks]));
+					m_pendingBlocks.back()->publish(publisher, *m_context.pPool);
+				}
+
+				auto& currentBlock = *m_pendingBlocks.front();
+				currentBlock.wait();
+				m_pPublisher->setCurrentBlock(&currentBlock);
+			}
+
+		private:
+			const PrepublishingContext& m_context;
+			const BlockElements& m_elements;
+			std::shared_ptr<PrepublishingNotificationPublisher> m_pPublisher;
+			chain::BatchEntityProcessor m_batchEntityProcessor;
+			size_t m_numScheduledBlocks;
+			std::deque<std::unique_ptr<PrepublishedBlock>> m_pendingBlocks;
+		};
+
+		// endregion
+
+		// region BlockChainProcessorT
+
+		template<typename TPipeline, typename TPipelineContext>
+		class BlockChainProcessorT {
 		public:
-			DefaultBlockChainProcessor(
-					const BlockHitPredicateFactory& blockHitPredicateFactory,
-					const chain::BatchEntityProcessor& batchEntityProcessor)
+			BlockChainProcessorT(const BlockHitPredicateFactory& blockHitPredicateFactory, const TPipelineContext& pipelineContext)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
-					, m_batchEntityProcessor(batchEntityProcessor)
+					, m_pipelineContext(pipelineContext)
 			{}
 
 		public:
@@ -64,9 +233,13 @@ namespace catapult { namespace consumers {
 				auto readOnlyCache = state.Cache.toReadOnly();
 				auto blockHitPredicate = m_blockHitPredicateFactory(readOnlyCache);
 
+				TPipeline pipeline(m_pipelineContext, elements);
+				const auto& batchEntityProcessor = pipeline.batchEntityProcessor();
+
 				const auto* pParent = &parentBlockInfo.entity();
 				const auto* pParentGenerationHash = &parentBlockInfo.generationHash();
-				for (auto& element : elements) {
+				for (auto i = 0u; i < elements.size(); ++i) {
+					auto& element = elements[i];
 					const auto& block = element.Block;
 					element.GenerationHash = model::CalculateGenerationHash(*pParentGenerationHash, block.Signer);
 					if (!blockHitPredicate(*pParent, block, element.GenerationHash)) {
@@ -74,7 +247,8 @@ namespace catapult { namespace consumers {
 						return chain::Failure_Chain_Block_Not_Hit;
 					}
 
-					auto result = m_batchEntityProcessor(block.Height, block.Timestamp, ExtractEntityInfos(element), state);
+					pipeline.prepare(i);
+					auto result = batchEntityProcessor(block.Height, block.Timestamp, ExtractEntityInfos(element), state);
 					if (!IsValidationResultSuccess(result)) {
 						CATAPULT_LOG(warning) << "batch processing of block " << block.Height << " failed with " << result;
 						return result;
@@ -89,13 +263,25 @@ namespace catapult { namespace consumers {
 
 		private:
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
-			chain::BatchEntityProcessor m_batchEntityProcessor;
+			TPipelineContext m_pipelineContext;
 		};
+
+		// endregion
 	}
 
 	BlockChainProcessor CreateBlockChainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor) {
-		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor);
+		using ProcessorType = BlockChainProcessorT<NoOpPipeline, chain::BatchEntityProcessor>;
+		return ProcessorType(blockHitPredicateFactory, batchEntityProcessor);
+	}
+
+	BlockChainProcessor CreatePipelinedBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::ExecutionConfiguration& executionConfig,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool,
+			size_t numLookaheadBlocks) {
+		using ProcessorType = BlockChainProcessorT<PrepublishingPipeline, PrepublishingContext>;
+		return ProcessorType(blockHitPredicateFactory, PrepublishingContext(executionConfig, pPool, numLookaheadBlocks));
 	}
 }}
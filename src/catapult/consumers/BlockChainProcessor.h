@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace cache { class ReadOnlyCatapultCache; }
 	namespace chain { struct ObserverState; }
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace consumers {
@@ -72,4 +73,14 @@ namespace catapult { namespace consumers {
 	BlockChainProcessor CreateBlockChainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor);
+
+	/// Creates a pipelined block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory)
+	/// and execution configuration (\a executionConfig).
+	/// While a block is being executed, the notifications of up to \a numLookaheadBlocks upcoming blocks are published on \a pPool.
+	/// \note The results are identical to the results of a processor created by CreateBlockChainProcessor.
+	BlockChainProcessor CreatePipelinedBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::ExecutionConfiguration& executionConfig,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool,
+			size_t numLookaheadBlocks);
 }}
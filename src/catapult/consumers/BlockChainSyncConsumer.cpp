@@ -23,9 +23,12 @@
 #include "InputUtils.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/chain/BlockScorer.h"
+#include "catapult/chain/ChangedAddressesCollector.h"
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/model/NotificationPublisher.h"
 #include "catapult/utils/Casting.h"
 
 namespace catapult { namespace consumers {
@@ -37,6 +40,32 @@ namespace catapult { namespace consumers {
 			return disruptor::CompletionStatus::Aborted == result.CompletionStatus;
 		}
 
+		std::unique_ptr<model::AddressSet> ExtractChangedAddresses(
+				const BlockElements& elements,
+				const model::NotificationPublisher& notificationPublisher) {
+			// collect the harvesters and all accounts changed by transactions
+			// (accounts changed by block observers, e.g. due to expirations, are not included)
+			auto pAddresses = std::make_unique<model::AddressSet>();
+			for (const auto& element : elements) {
+				pAddresses->insert(model::PublicKeyToAddress(element.Block.Signer, element.Block.Network()));
+
+				chain::ChangedAddressesCollector collector(element.Block.Network());
+				for (const auto& transactionElement : element.Transactions) {
+					auto entityInfo = model::WeakEntityInfo(transactionElement.Transaction, transactionElement.EntityHash);
+					notificationPublisher.publish(entityInfo, collector);
+				}
+
+				// changed accounts are unknown when transactions change state that is not keyed by account
+				// (e.g. namespaces, mosaics, multisig or locks)
+				if (collector.hasUntrackedChanges())
+					return nullptr;
+
+				pAddresses->insert(collector.addresses().cbegin(), collector.addresses().cend());
+			}
+
+			return pAddresses;
+		}
+
 		struct UnwindResult {
 		public:
 			model::ChainScore Score;
@@ -118,11 +147,13 @@ namespace catapult { namespace consumers {
 					state::CatapultState& state,
 					io::BlockStorageCache& storage,
 					uint32_t maxRollbackBlocks,
+					const std::shared_ptr<const model::NotificationPublisher>& pNotificationPublisher,
 					const BlockChainSyncHandlers& handlers)
 					: m_cache(cache)
 					, m_state(state)
 					, m_storage(storage)
 					, m_maxRollbackBlocks(maxRollbackBlocks)
+					, m_pNotificationPublisher(pNotificationPublisher)
 					, m_handlers(handlers)
 			{}
 
@@ -245,6 +276,7 @@ namespace catapult { namespace consumers {
 
 			void commitAll(const BlockElements& elements, SyncState& syncState) const {
 				auto newHeight = elements.back().Block.Height;
+				auto hasUnwoundBlocks = m_storage.view().chainHeight() != syncState.commonBlockHeight();
 
 				// 1. save the peer chain into storage
 				commitToStorage(syncState.commonBlockHeight(), elements);
@@ -260,7 +292,13 @@ namespace catapult { namespace consumers {
 				auto revertedTransactionInfos = CollectRevertedTransactionInfos(
 						peerTransactionHashes,
 						syncState.detachRemovedTransactionInfos());
-				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos });
+
+				// - changed accounts are only tracked when the peer chain was appended to the local chain
+				std::unique_ptr<model::AddressSet> pChangedAddresses;
+				if (!hasUnwoundBlocks)
+					pChangedAddresses = ExtractChangedAddresses(elements, *m_pNotificationPublisher);
+
+				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos, pChangedAddresses.get() });
 			}
 
 			void commitToStorage(Height commonBlockHeight, const BlockElements& elements) const {
@@ -274,6 +312,7 @@ namespace catapult { namespace consumers {
 			state::CatapultState& m_state;
 			io::BlockStorageCache& m_storage;
 			uint32_t m_maxRollbackBlocks;
+			std::shared_ptr<const model::NotificationPublisher> m_pNotificationPublisher;
 			BlockChainSyncHandlers m_handlers;
 		};
 	}
@@ -283,7 +322,8 @@ namespace catapult { namespace consumers {
 			state::CatapultState& state,
 			io::BlockStorageCache& storage,
 			uint32_t maxRollbackBlocks,
+			const std::shared_ptr<const model::NotificationPublisher>& pNotificationPublisher,
 			const BlockChainSyncHandlers& handlers) {
-		return BlockChainSyncConsumer(cache, state, storage, maxRollbackBlocks, handlers);
+		return BlockChainSyncConsumer(cache, state, storage, maxRollbackBlocks, pNotificationPublisher, handlers);
 	}
 }}
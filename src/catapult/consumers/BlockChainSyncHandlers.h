@@ -21,6 +21,7 @@
 #pragma once
 #include "BlockChainProcessor.h"
 #include "StateChangeInfo.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/utils/ArraySet.h"
 
 namespace catapult {
@@ -37,8 +38,18 @@ namespace catapult { namespace consumers {
 		TransactionsChangeInfo(
 				const utils::HashPointerSet& addedTransactionHashes,
 				const std::vector<model::TransactionInfo>& revertedTransactionInfos)
+				: TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos, nullptr)
+		{}
+
+		/// Creates a new transactions change info around \a addedTransactionHashes, \a revertedTransactionInfos
+		/// and \a pChangedAddresses.
+		TransactionsChangeInfo(
+				const utils::HashPointerSet& addedTransactionHashes,
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const model::AddressSet* pChangedAddresses)
 				: AddedTransactionHashes(addedTransactionHashes)
 				, RevertedTransactionInfos(revertedTransactionInfos)
+				, pChangedAddresses(pChangedAddresses)
 		{}
 
 	public:
@@ -47,6 +58,9 @@ namespace catapult { namespace consumers {
 
 		/// Infos of the transactions that were reverted (previously confirmed).
 		const std::vector<model::TransactionInfo>& RevertedTransactionInfos;
+
+		/// Addresses of all accounts that were changed by the added blocks (\c nullptr if unknown).
+		const model::AddressSet* pChangedAddresses;
 	};
 
 	/// Handlers used by the block chain sync consumer.
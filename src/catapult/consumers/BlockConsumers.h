@@ -23,6 +23,7 @@
 #include "BlockChainSyncHandlers.h"
 #include "HashCheckOptions.h"
 #include "InputUtils.h"
+#include "ParallelConsumerPolicy.h"
 #include "catapult/chain/ChainFunctions.h"
 #include "catapult/disruptor/DisruptorConsumer.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
@@ -30,7 +31,10 @@
 namespace catapult {
 	namespace chain { struct CatapultState; }
 	namespace io { class BlockStorageCache; }
-	namespace model { class TransactionRegistry; }
+	namespace model {
+		class NotificationPublisher;
+		class TransactionRegistry;
+	}
 	namespace utils { class TimeSpan; }
 }
 
@@ -39,6 +43,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
+	/// Transaction hashing is split across workers according to \a pParallelPolicy.
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	disruptor::ConstBlockConsumer CreateBlockHashCheckConsumer(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
@@ -46,6 +56,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
 	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher);
 
+	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
+	/// Address extraction is split across workers according to \a pParallelPolicy.
+	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(
+			const model::NotificationPublisher& notificationPublisher,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy);
+
 	/// Creates a consumer that checks a block chain for internal integrity.
 	/// A valid chain must have no more than \a maxChainSize blocks and end no more than \a maxBlockFutureTime past the current time
 	/// supplied by \a timeSupplier.
@@ -68,6 +84,7 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
 	/// state (in \a cache and \a state) and blocks (in \a storage).
 	/// \a maxRollbackBlocks The maximum number of blocks that can be rolled back.
+	/// \a pNotificationPublisher is used to determine the accounts changed by synced transactions.
 	/// \a handlers are used to customize the sync process.
 	/// \note This consumer is non-const because it updates the element generation hashes.
 	disruptor::DisruptorConsumer CreateBlockChainSyncConsumer(
@@ -75,6 +92,7 @@ namespace catapult { namespace consumers {
 			state::CatapultState& state,
 			io::BlockStorageCache& storage,
 			uint32_t maxRollbackBlocks,
+			const std::shared_ptr<const model::NotificationPublisher>& pNotificationPublisher,
 			const BlockChainSyncHandlers& handlers);
 
 	/// Prototype for a function that is called with a new block.
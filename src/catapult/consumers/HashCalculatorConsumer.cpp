@@ -28,10 +28,22 @@
 namespace catapult { namespace consumers {
 
 	namespace {
+		void UpdateHashes(
+				const model::TransactionRegistry& transactionRegistry,
+				const ParallelConsumerPolicy& parallelPolicy,
+				const std::vector<model::TransactionElement*>& transactionElements) {
+			parallelPolicy.process(transactionElements, [&transactionRegistry](auto itBegin, auto itEnd) {
+				model::UpdateHashes(transactionRegistry, std::vector<model::TransactionElement*>(itBegin, itEnd));
+			});
+		}
+
 		class BlockHashCalculatorConsumer {
 		public:
-			explicit BlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry)
+			BlockHashCalculatorConsumer(
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy)
 					: m_transactionRegistry(transactionRegistry)
+					, m_pParallelPolicy(pParallelPolicy)
 			{}
 
 		public:
@@ -39,17 +51,24 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// hash the transactions of all blocks together so that the work can be split across the most workers
+				std::vector<model::TransactionElement*> transactionElements;
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
 
+				UpdateHashes(m_transactionRegistry, *m_pParallelPolicy, transactionElements);
+
+				for (auto& element : elements) {
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size());
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -64,18 +83,28 @@ namespace catapult { namespace consumers {
 
 		private:
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<const ParallelConsumerPolicy> m_pParallelPolicy;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(transactionRegistry);
+		return CreateBlockHashCalculatorConsumer(transactionRegistry, std::make_shared<ParallelConsumerPolicy>(nullptr, 1));
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+		return BlockHashCalculatorConsumer(transactionRegistry, pParallelPolicy);
 	}
 
 	namespace {
 		class TransactionHashCalculatorConsumer {
 		public:
-			explicit TransactionHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry)
+			TransactionHashCalculatorConsumer(
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy)
 					: m_transactionRegistry(transactionRegistry)
+					, m_pParallelPolicy(pParallelPolicy)
 			{}
 
 		public:
@@ -83,18 +112,28 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				std::vector<model::TransactionElement*> transactionElements;
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, element);
+					transactionElements.push_back(&element);
+
+				UpdateHashes(m_transactionRegistry, *m_pParallelPolicy, transactionElements);
 
 				return Continue();
 			}
 
 		private:
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<const ParallelConsumerPolicy> m_pParallelPolicy;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry) {
-		return TransactionHashCalculatorConsumer(transactionRegistry);
+		return CreateTransactionHashCalculatorConsumer(transactionRegistry, std::make_shared<ParallelConsumerPolicy>(nullptr, 1));
+	}
+
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy) {
+		return TransactionHashCalculatorConsumer(transactionRegistry, pParallelPolicy);
 	}
 }}
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ParallelConsumerPolicy.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <boost/asio/io_service.hpp>
+#include <algorithm>
+#include <chrono>
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		class StopwatchGuard {
+		public:
+			explicit StopwatchGuard(std::atomic<uint64_t>& totalMicros)
+					: m_totalMicros(totalMicros)
+					, m_startTime(std::chrono::steady_clock::now())
+			{}
+
+			~StopwatchGuard() {
+				auto elapsedTime = std::chrono::steady_clock::now() - m_startTime;
+				m_totalMicros += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count());
+			}
+
+		private:
+			std::atomic<uint64_t>& m_totalMicros;
+			std::chrono::steady_clock::time_point m_startTime;
+		};
+	}
+
+	ParallelConsumerPolicy::ParallelConsumerPolicy(const std::shared_ptr<thread::IoServiceThreadPool>& pPool, size_t minPartitionSize)
+			: m_pPool(pPool)
+			, m_minPartitionSize(std::max<size_t>(1, minPartitionSize))
+			, m_workMicros(0)
+			, m_elapsedMicros(0)
+	{}
+
+	uint64_t ParallelConsumerPolicy::workMicros() const {
+		return m_workMicros;
+	}
+
+	uint64_t ParallelConsumerPolicy::elapsedMicros() const {
+		return m_elapsedMicros;
+	}
+
+	uint64_t ParallelConsumerPolicy::speedupPercentage() const {
+		auto elapsedMicros = m_elapsedMicros.load();
+		return 0 == elapsedMicros ? 0 : m_workMicros * 100 / elapsedMicros;
+	}
+
+	void ParallelConsumerPolicy::process(const TransactionElementPointers& elements, const PartitionProcessor& processor) const {
+		if (elements.empty())
+			return;
+
+		StopwatchGuard elapsedGuard(m_elapsedMicros);
+		auto numPartitions = m_pPool
+				? std::min<size_t>(m_pPool->numWorkerThreads(), elements.size() / m_minPartitionSize)
+				: 1;
+
+		// avoid the overhead of dispatching to the pool when there is not enough work to split
+		if (numPartitions <= 1) {
+			StopwatchGuard workGuard(m_workMicros);
+			processor(elements.cbegin(), elements.cend());
+			return;
+		}
+
+		auto& workMicros = m_workMicros;
+		thread::ParallelForPartition(m_pPool->service(), elements, numPartitions, [&processor, &workMicros](
+				auto itBegin,
+				auto itEnd,
+				auto,
+				auto) {
+			StopwatchGuard workGuard(workMicros);
+			processor(itBegin, itEnd);
+		}).get();
+	}
+}}
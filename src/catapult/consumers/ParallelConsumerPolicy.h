@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+namespace catapult {
+	namespace model { struct TransactionElement; }
+	namespace thread { class IoServiceThreadPool; }
+}
+
+namespace catapult { namespace consumers {
+
+	/// A policy for splitting the data parallel work of a consumer stage across a shared worker pool.
+	class ParallelConsumerPolicy {
+	public:
+		/// Transaction elements processed by a data parallel consumer stage.
+		using TransactionElementPointers = std::vector<model::TransactionElement*>;
+
+		/// Processes the transaction elements in the range [\a begin, \a end).
+		using PartitionProcessor = std::function<void (
+				TransactionElementPointers::const_iterator begin,
+				TransactionElementPointers::const_iterator end)>;
+
+	public:
+		/// Creates a policy around \a pPool that splits work into partitions of at least \a minPartitionSize elements.
+		/// \note When \a pPool is \c nullptr, all work is processed on the calling thread.
+		ParallelConsumerPolicy(const std::shared_ptr<thread::IoServiceThreadPool>& pPool, size_t minPartitionSize);
+
+	public:
+		/// Gets the total time (in microseconds) spent processing partitions summed across all workers.
+		uint64_t workMicros() const;
+
+		/// Gets the total time (in microseconds) that consumers waited for all partitions to be processed.
+		uint64_t elapsedMicros() const;
+
+		/// Gets the parallel speedup (ratio of work time to elapsed time) as a percentage.
+		uint64_t speedupPercentage() const;
+
+	public:
+		/// Splits \a elements into partitions, calls \a processor for each partition and blocks until all partitions are processed.
+		void process(const TransactionElementPointers& elements, const PartitionProcessor& processor) const;
+
+	private:
+		std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+		size_t m_minPartitionSize;
+		mutable std::atomic<uint64_t> m_workMicros;
+		mutable std::atomic<uint64_t> m_elapsedMicros;
+	};
+}}
@@ -21,6 +21,7 @@
 #pragma once
 #include "HashCheckOptions.h"
 #include "InputUtils.h"
+#include "ParallelConsumerPolicy.h"
 #include "catapult/chain/ChainFunctions.h"
 #include "catapult/disruptor/DisruptorConsumer.h"
 #include "catapult/model/EntityInfo.h"
@@ -33,6 +34,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
+	/// Transaction hashing is split across workers according to \a pParallelPolicy.
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	/// \a knownHashPredicate returns \c true for known hashes.
@@ -44,6 +51,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
 	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher);
 
+	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
+	/// Address extraction is split across workers according to \a pParallelPolicy.
+	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(
+			const model::NotificationPublisher& notificationPublisher,
+			const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy);
+
 	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
 	/// (\a pValidationPolicy) and calls \a failedTransactionSink for each failure.
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
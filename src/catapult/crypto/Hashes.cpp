@@ -20,6 +20,7 @@
 
 #include "Hashes.h"
 #include "KeccakHash.h"
+#include "Sha3Lanes.h"
 #include "catapult/utils/Casting.h"
 
 #ifdef __clang__
@@ -55,6 +56,26 @@ namespace catapult { namespace crypto {
 		sha3.final(hash);
 	}
 
+	void Sha3_256_Multi(const RawBuffer* pBuffers, Hash256* pHashes, size_t count) noexcept {
+		Sha3_256_Multi(pBuffers, 1, pHashes, count);
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pBuffers, size_t numBuffersPerHash, Hash256* pHashes, size_t count) noexcept {
+		size_t i = 0;
+		if (IsSha3LanesSupported()) {
+			for (; i + Sha3_Num_Lanes <= count; i += Sha3_Num_Lanes)
+				Sha3_256_Lanes(pBuffers + i * numBuffersPerHash, numBuffersPerHash, pHashes + i);
+		}
+
+		for (; i < count; ++i) {
+			Sha3_256_Builder sha3;
+			for (auto j = 0u; j < numBuffersPerHash; ++j)
+				sha3.update(pBuffers[i * numBuffersPerHash + j]);
+
+			sha3.final(pHashes[i]);
+		}
+	}
+
 	namespace {
 		auto CastToKeccakHashInstance(uint8_t* pHashContext) noexcept {
 			return reinterpret_cast<Keccak_HashInstance*>(pHashContext);
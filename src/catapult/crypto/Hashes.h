@@ -32,6 +32,15 @@ namespace catapult { namespace crypto {
 	/// Calculates the 512-bit SHA3 hash of \a dataBuffer into \a hash.
 	void Sha3_512(const RawBuffer& dataBuffer, Hash512& hash) noexcept;
 
+	/// Calculates the 256-bit SHA3 hashes of \a count buffers pointed to by \a pBuffers into \a pHashes.
+	/// \note Independent hashes are calculated in parallel lanes when supported by the processor.
+	void Sha3_256_Multi(const RawBuffer* pBuffers, Hash256* pHashes, size_t count) noexcept;
+
+	/// Calculates \a count 256-bit SHA3 hashes into \a pHashes, where each hash is calculated over the concatenation of
+	/// \a numBuffersPerHash consecutive buffers pointed to by \a pBuffers.
+	/// \note Independent hashes are calculated in parallel lanes when supported by the processor.
+	void Sha3_256_Multi(const RawBuffer* pBuffers, size_t numBuffersPerHash, Hash256* pHashes, size_t count) noexcept;
+
 	/// Wraps 256-bit sha3 into an object.
 	class alignas(32) Sha3_256_Builder {
 	public:
@@ -21,6 +21,7 @@
 #include "MerkleHashBuilder.h"
 #include "Hashes.h"
 #include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
@@ -41,23 +42,27 @@ namespace catapult { namespace crypto {
 				if (1 == numRemainingHashes % 2)
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256_Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
+				// hash all pairs of the current level at once
+				auto numPairs = numRemainingHashes / 2;
+				std::vector<RawBuffer> buffers;
+				buffers.reserve(numPairs);
+				for (auto i = 0u; i < numPairs; ++i)
+					buffers.push_back({ hashes[2 * i].data(), 2 * Hash256_Size });
 
+				std::vector<Hash256> levelHashes(numPairs);
+				Sha3_256_Multi(buffers.data(), levelHashes.data(), numPairs);
+				std::copy(levelHashes.cbegin(), levelHashes.cend(), hashes.begin());
+
+				if (1 == numRemainingHashes % 2) {
 					// if there is an odd number of hashes, duplicate the last one
 					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
+					builder.update(hashes[numRemainingHashes - 1]);
+					builder.update(hashes[numRemainingHashes - 1]);
+					builder.final(hashes[numPairs]);
 					++numRemainingHashes;
 				}
 
+				hashConsumer(hashes.data(), numRemainingHashes / 2);
 				numRemainingHashes /= 2;
 			}
 
@@ -0,0 +1,279 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "Sha3Lanes.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CATAPULT_SHA3_LANES_AVX2
+#include <immintrin.h>
+#endif
+
+namespace catapult { namespace crypto {
+
+#ifdef CATAPULT_SHA3_LANES_AVX2
+
+	namespace {
+		constexpr size_t Num_State_Words = 25;
+		constexpr size_t Sha3_256_Rate = 136;
+		constexpr size_t Num_Rate_Words = Sha3_256_Rate / sizeof(uint64_t);
+
+#ifdef SIGNATURE_SCHEME_NIS1
+		constexpr uint8_t Padding_Suffix = 0x01; // original keccak padding
+#else
+		constexpr uint8_t Padding_Suffix = 0x06; // sha3 padding
+#endif
+
+		constexpr uint64_t Round_Constants[] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		template<int Offset>
+		__attribute__((target("avx2")))
+		inline __m256i RotateLeft(__m256i value) {
+			return _mm256_or_si256(_mm256_slli_epi64(value, Offset), _mm256_srli_epi64(value, 64 - Offset));
+		}
+
+		__attribute__((target("avx2")))
+		inline __m256i Xor5(__m256i a, __m256i b, __m256i c, __m256i d, __m256i e) {
+			return _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(c, d)), e);
+		}
+
+		__attribute__((target("avx2")))
+		inline void ApplyTheta(__m256i* column, __m256i d) {
+			column[0] = _mm256_xor_si256(column[0], d);
+			column[5] = _mm256_xor_si256(column[5], d);
+			column[10] = _mm256_xor_si256(column[10], d);
+			column[15] = _mm256_xor_si256(column[15], d);
+			column[20] = _mm256_xor_si256(column[20], d);
+		}
+
+		__attribute__((target("avx2")))
+		inline void ApplyChi(__m256i* row, const __m256i* b) {
+			row[0] = _mm256_xor_si256(b[0], _mm256_andnot_si256(b[1], b[2]));
+			row[1] = _mm256_xor_si256(b[1], _mm256_andnot_si256(b[2], b[3]));
+			row[2] = _mm256_xor_si256(b[2], _mm256_andnot_si256(b[3], b[4]));
+			row[3] = _mm256_xor_si256(b[3], _mm256_andnot_si256(b[4], b[0]));
+			row[4] = _mm256_xor_si256(b[4], _mm256_andnot_si256(b[0], b[1]));
+		}
+
+		__attribute__((target("avx2")))
+		void KeccakF1600(__m256i* state) {
+			__m256i c[5];
+			__m256i b[Num_State_Words];
+			for (auto round = 0u; round < 24; ++round) {
+				// theta
+				c[0] = Xor5(state[0], state[5], state[10], state[15], state[20]);
+				c[1] = Xor5(state[1], state[6], state[11], state[16], state[21]);
+				c[2] = Xor5(state[2], state[7], state[12], state[17], state[22]);
+				c[3] = Xor5(state[3], state[8], state[13], state[18], state[23]);
+				c[4] = Xor5(state[4], state[9], state[14], state[19], state[24]);
+
+				ApplyTheta(state + 0, _mm256_xor_si256(c[4], RotateLeft<1>(c[1])));
+				ApplyTheta(state + 1, _mm256_xor_si256(c[0], RotateLeft<1>(c[2])));
+				ApplyTheta(state + 2, _mm256_xor_si256(c[1], RotateLeft<1>(c[3])));
+				ApplyTheta(state + 3, _mm256_xor_si256(c[2], RotateLeft<1>(c[4])));
+				ApplyTheta(state + 4, _mm256_xor_si256(c[3], RotateLeft<1>(c[0])));
+
+				// rho and pi
+				b[0] = state[0];
+				b[1] = RotateLeft<44>(state[6]);
+				b[2] = RotateLeft<43>(state[12]);
+				b[3] = RotateLeft<21>(state[18]);
+				b[4] = RotateLeft<14>(state[24]);
+				b[5] = RotateLeft<28>(state[3]);
+				b[6] = RotateLeft<20>(state[9]);
+				b[7] = RotateLeft<3>(state[10]);
+				b[8] = RotateLeft<45>(state[16]);
+				b[9] = RotateLeft<61>(state[22]);
+				b[10] = RotateLeft<1>(state[1]);
+				b[11] = RotateLeft<6>(state[7]);
+				b[12] = RotateLeft<25>(state[13]);
+				b[13] = RotateLeft<8>(state[19]);
+				b[14] = RotateLeft<18>(state[20]);
+				b[15] = RotateLeft<27>(state[4]);
+				b[16] = RotateLeft<36>(state[5]);
+				b[17] = RotateLeft<10>(state[11]);
+				b[18] = RotateLeft<15>(state[17]);
+				b[19] = RotateLeft<56>(state[23]);
+				b[20] = RotateLeft<62>(state[2]);
+				b[21] = RotateLeft<55>(state[8]);
+				b[22] = RotateLeft<39>(state[14]);
+				b[23] = RotateLeft<41>(state[15]);
+				b[24] = RotateLeft<2>(state[21]);
+
+				// chi
+				ApplyChi(state + 0, b + 0);
+				ApplyChi(state + 5, b + 5);
+				ApplyChi(state + 10, b + 10);
+				ApplyChi(state + 15, b + 15);
+				ApplyChi(state + 20, b + 20);
+
+				// iota
+				state[0] = _mm256_xor_si256(state[0], _mm256_set1_epi64x(static_cast<int64_t>(Round_Constants[round])));
+			}
+		}
+
+		// provides padded rate-sized blocks of the concatenation of multiple buffers
+		class PaddedBlockReader {
+		public:
+			PaddedBlockReader() : PaddedBlockReader(nullptr, 0)
+			{}
+
+			PaddedBlockReader(const RawBuffer* pBuffers, size_t numBuffers)
+					: m_pBuffers(pBuffers)
+					, m_numBuffers(numBuffers)
+					, m_bufferIndex(0)
+					, m_bufferOffset(0)
+					, m_dataSize(0)
+					, m_numRemainingBlocks(0) {
+				for (auto i = 0u; i < m_numBuffers; ++i)
+					m_dataSize += m_pBuffers[i].Size;
+
+				// padding always requires at least one byte
+				m_numRemainingBlocks = m_dataSize / Sha3_256_Rate + 1;
+			}
+
+		public:
+			size_t numRemainingBlocks() const {
+				return m_numRemainingBlocks;
+			}
+
+			void next(uint8_t* pBlock) {
+				if (0 == m_numRemainingBlocks) {
+					std::memset(pBlock, 0, Sha3_256_Rate);
+					return;
+				}
+
+				auto numCopiedBytes = copy(pBlock);
+				std::memset(pBlock + numCopiedBytes, 0, Sha3_256_Rate - numCopiedBytes);
+				if (1 == m_numRemainingBlocks) {
+					pBlock[numCopiedBytes] ^= Padding_Suffix;
+					pBlock[Sha3_256_Rate - 1] ^= 0x80;
+				}
+
+				--m_numRemainingBlocks;
+			}
+
+		private:
+			size_t copy(uint8_t* pBlock) {
+				size_t numCopiedBytes = 0;
+				while (numCopiedBytes < Sha3_256_Rate && m_bufferIndex < m_numBuffers) {
+					const auto& buffer = m_pBuffers[m_bufferIndex];
+					auto count = std::min(Sha3_256_Rate - numCopiedBytes, buffer.Size - m_bufferOffset);
+					if (0 != count)
+						std::memcpy(pBlock + numCopiedBytes, buffer.pData + m_bufferOffset, count);
+
+					numCopiedBytes += count;
+					m_bufferOffset += count;
+					if (m_bufferOffset == buffer.Size) {
+						++m_bufferIndex;
+						m_bufferOffset = 0;
+					}
+				}
+
+				return numCopiedBytes;
+			}
+
+		private:
+			const RawBuffer* m_pBuffers;
+			size_t m_numBuffers;
+			size_t m_bufferIndex;
+			size_t m_bufferOffset;
+			size_t m_dataSize;
+			size_t m_numRemainingBlocks;
+		};
+
+		__attribute__((target("avx2")))
+		void Sha3_256_LanesAvx2(const RawBuffer* pBuffers, size_t numBuffersPerHash, Hash256* pHashes) {
+			PaddedBlockReader readers[Sha3_Num_Lanes];
+			size_t maxNumBlocks = 0;
+			for (auto lane = 0u; lane < Sha3_Num_Lanes; ++lane) {
+				readers[lane] = PaddedBlockReader(pBuffers + lane * numBuffersPerHash, numBuffersPerHash);
+				maxNumBlocks = std::max(maxNumBlocks, readers[lane].numRemainingBlocks());
+			}
+
+			__m256i state[Num_State_Words];
+			for (auto& word : state)
+				word = _mm256_setzero_si256();
+
+			Hash256 hashes[Sha3_Num_Lanes];
+			uint64_t blocks[Sha3_Num_Lanes][Num_Rate_Words];
+			for (auto i = 0u; i < maxNumBlocks; ++i) {
+				bool isLastBlock[Sha3_Num_Lanes];
+				for (auto lane = 0u; lane < Sha3_Num_Lanes; ++lane) {
+					isLastBlock[lane] = 1 == readers[lane].numRemainingBlocks();
+					readers[lane].next(reinterpret_cast<uint8_t*>(blocks[lane]));
+				}
+
+				for (auto j = 0u; j < Num_Rate_Words; ++j) {
+					auto words = _mm256_set_epi64x(
+							static_cast<int64_t>(blocks[3][j]),
+							static_cast<int64_t>(blocks[2][j]),
+							static_cast<int64_t>(blocks[1][j]),
+							static_cast<int64_t>(blocks[0][j]));
+					state[j] = _mm256_xor_si256(state[j], words);
+				}
+
+				KeccakF1600(state);
+
+				uint64_t lanes[Hash256_Size / sizeof(uint64_t)][Sha3_Num_Lanes];
+				for (auto j = 0u; j < Hash256_Size / sizeof(uint64_t); ++j)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes[j]), state[j]);
+
+				for (auto lane = 0u; lane < Sha3_Num_Lanes; ++lane) {
+					if (!isLastBlock[lane])
+						continue;
+
+					for (auto j = 0u; j < Hash256_Size / sizeof(uint64_t); ++j)
+						std::memcpy(hashes[lane].data() + j * sizeof(uint64_t), &lanes[j][lane], sizeof(uint64_t));
+				}
+			}
+
+			std::copy(hashes, hashes + Sha3_Num_Lanes, pHashes);
+		}
+	}
+
+	bool IsSha3LanesSupported() noexcept {
+		static const bool Is_Supported = __builtin_cpu_supports("avx2");
+		return Is_Supported;
+	}
+
+	void Sha3_256_Lanes(const RawBuffer* pBuffers, size_t numBuffersPerHash, Hash256* pHashes) noexcept {
+		Sha3_256_LanesAvx2(pBuffers, numBuffersPerHash, pHashes);
+	}
+
+#else
+
+	bool IsSha3LanesSupported() noexcept {
+		return false;
+	}
+
+	void Sha3_256_Lanes(const RawBuffer*, size_t, Hash256*) noexcept {
+	}
+
+#endif
+}}
@@ -0,0 +1,36 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace crypto {
+
+	/// Number of independent hashes calculated by a single call to Sha3_256_Lanes.
+	constexpr size_t Sha3_Num_Lanes = 4;
+
+	/// Returns \c true if the processor supports calculating hashes in parallel lanes.
+	bool IsSha3LanesSupported() noexcept;
+
+	/// Calculates Sha3_Num_Lanes 256-bit SHA3 hashes in parallel lanes into \a pHashes.
+	/// Each hash is calculated over \a numBuffersPerHash consecutive buffers pointed to by \a pBuffers.
+	/// \note This function must only be called when IsSha3LanesSupported returns \c true.
+	void Sha3_256_Lanes(const RawBuffer* pBuffers, size_t numBuffersPerHash, Hash256* pHashes) noexcept;
+}}
@@ -22,6 +22,7 @@
 #include "CryptoUtils.h"
 #include "Hashes.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
 #include <cstring>
 #include <ref10/crypto_verify_32.h>
 
@@ -131,41 +132,141 @@ namespace catapult { namespace crypto {
 		return Verify(publicKey, { dataBuffer }, signature);
 	}
 
-	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature) {
-		const uint8_t *RESTRICT encodedR = signature.data();
-		const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
-
-		// reject if not canonical
-		if (!IsCanonicalS(encodedS))
-			return false;
-
-		// reject zero public key, which is known weak key
-		const Key Zero_Key{};
-		if (Zero_Key == publicKey)
-			return false;
-
-		// h = H(encodedR || public || data)
-		Hash512 h;
-		Sha3_512_Builder sha3_h;
-		sha3_h.update({ { encodedR, Encoded_Size }, publicKey });
-		sha3_h.update(buffersList);
-		sha3_h.final(h);
+	namespace {
+		// calculates R = encodedS * B - h * A in projective coordinates or returns false if \a signature can be rejected early
+		bool CalculateProjectiveR(
+				const Key& publicKey,
+				std::initializer_list<const RawBuffer> buffersList,
+				const Signature& signature,
+				ge_p2& R) {
+			const uint8_t *RESTRICT encodedR = signature.data();
+			const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+
+			// reject if not canonical
+			if (!IsCanonicalS(encodedS))
+				return false;
+
+			// reject zero public key, which is known weak key
+			const Key Zero_Key{};
+			if (Zero_Key == publicKey)
+				return false;
+
+			// h = H(encodedR || public || data)
+			Hash512 h;
+			Sha3_512_Builder sha3_h;
+			sha3_h.update({ { encodedR, Encoded_Size }, publicKey });
+			sha3_h.update(buffersList);
+			sha3_h.final(h);
+
+			// h = h mod group order
+			sc_reduce(h.data());
+
+			// A = -pub
+			ge_p3 A;
+			if (0 != ge_frombytes_negate_vartime(&A, publicKey.data()))
+				return false;
+
+			// R = encodedS * B - h * A
+			ge_double_scalarmult_vartime(&R, h.data(), &A, encodedS);
+			return true;
+		}
 
-		// h = h mod group order
-		sc_reduce(h.data());
+		// encodes \a R using the precomputed inverse of its Z coordinate (\a recip) and compares it to the R part of \a signature
+		bool IsEncodedREqual(const ge_p2& R, const fe& recip, const Signature& signature) {
+			fe x;
+			fe y;
+			fe_mul(x, R.X, recip);
+			fe_mul(y, R.Y, recip);
+
+			unsigned char checkr[Encoded_Size];
+			fe_tobytes(checkr, y);
+			checkr[31] ^= static_cast<unsigned char>(fe_isnegative(x) << 7);
+			return 0 == crypto_verify_32(checkr, signature.data());
+		}
 
-		// A = -pub
-		ge_p3 A;
-		if (0 != ge_frombytes_negate_vartime(&A, publicKey.data()))
-			return false;
+		// number of signatures sharing a single field inversion
+		constexpr size_t Verify_Multi_Batch_Size = 64;
+
+		// verifies up to Verify_Multi_Batch_Size signatures and passes each (index, result) pair to \a consumer
+		// (all projective R points are normalized with a single field inversion using Montgomery's trick)
+		template<typename TConsumer>
+		void VerifyBatch(const SignatureInput* pSignatureInputs, size_t count, TConsumer consumer) {
+			ge_p2 points[Verify_Multi_Batch_Size];
+			fe products[Verify_Multi_Batch_Size];
+			size_t indexes[Verify_Multi_Batch_Size];
+
+			size_t numCandidates = 0;
+			for (size_t i = 0; i < count; ++i) {
+				const auto& input = pSignatureInputs[i];
+				if (!CalculateProjectiveR(input.PublicKey, { input.DataBuffer }, input.Signature, points[numCandidates])) {
+					consumer(i, false);
+					continue;
+				}
+
+				// products[k] = Z[0] * ... * Z[k]
+				if (0 == numCandidates)
+					fe_copy(products[0], points[0].Z);
+				else
+					fe_mul(products[numCandidates], products[numCandidates - 1], points[numCandidates].Z);
+
+				indexes[numCandidates++] = i;
+			}
+
+			if (0 == numCandidates)
+				return;
+
+			// inverse = 1 / (Z[0] * ... * Z[numCandidates - 1])
+			fe inverse;
+			fe_invert(inverse, products[numCandidates - 1]);
+
+			for (auto k = numCandidates - 1; k > 0; --k) {
+				// recip = 1 / Z[k], inverse = 1 / (Z[0] * ... * Z[k - 1])
+				fe recip;
+				fe_mul(recip, inverse, products[k - 1]);
+				fe_mul(inverse, inverse, points[k].Z);
+
+				consumer(indexes[k], IsEncodedREqual(points[k], recip, pSignatureInputs[indexes[k]].Signature));
+			}
+
+			consumer(indexes[0], IsEncodedREqual(points[0], inverse, pSignatureInputs[indexes[0]].Signature));
+		}
+	}
 
-		// R = encodedS * B - h * A
+	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature) {
 		ge_p2 R;
-		ge_double_scalarmult_vartime(&R, h.data(), &A, encodedS);
+		if (!CalculateProjectiveR(publicKey, buffersList, signature, R))
+			return false;
 
 		// Compare calculated R to given R.
 		unsigned char checkr[Encoded_Size];
 		ge_tobytes(checkr, &R);
-		return 0 == crypto_verify_32(checkr, encodedR);
+		return 0 == crypto_verify_32(checkr, signature.data());
+	}
+
+	std::vector<bool> VerifyMulti(const SignatureInput* pSignatureInputs, size_t count) {
+		std::vector<bool> results(count, false);
+		for (size_t offset = 0; offset < count; offset += Verify_Multi_Batch_Size) {
+			auto batchSize = std::min(Verify_Multi_Batch_Size, count - offset);
+			VerifyBatch(pSignatureInputs + offset, batchSize, [offset, &results](auto index, auto result) {
+				results[offset + index] = result;
+			});
+		}
+
+		return results;
+	}
+
+	bool VerifyMultiShortCircuit(const SignatureInput* pSignatureInputs, size_t count) {
+		for (size_t offset = 0; offset < count; offset += Verify_Multi_Batch_Size) {
+			auto areAllValid = true;
+			auto batchSize = std::min(Verify_Multi_Batch_Size, count - offset);
+			VerifyBatch(pSignatureInputs + offset, batchSize, [&areAllValid](auto, auto result) {
+				areAllValid = areAllValid && result;
+			});
+
+			if (!areAllValid)
+				return false;
+		}
+
+		return true;
 	}
 }}
@@ -39,4 +39,35 @@ namespace catapult { namespace crypto {
 	/// Verifies that \a signature of data in \a buffersList is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature);
+
+	/// Input into a multi signature verification.
+	struct SignatureInput {
+	public:
+		/// Creates an input around \a publicKey, \a dataBuffer and \a signature.
+		SignatureInput(const Key& publicKey, const RawBuffer& dataBuffer, const Signature& signature)
+				: PublicKey(publicKey)
+				, DataBuffer(dataBuffer)
+				, Signature(signature)
+		{}
+
+	public:
+		/// Public key of the signer.
+		const Key& PublicKey;
+
+		/// Signed data.
+		RawBuffer DataBuffer;
+
+		/// Signature of the data.
+		const catapult::Signature& Signature;
+	};
+
+	/// Verifies all \a count signatures pointed to by \a pSignatureInputs.
+	/// Returns the verification result of each input.
+	/// \note Each result is identical to the result of calling Verify with the corresponding input.
+	std::vector<bool> VerifyMulti(const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies all \a count signatures pointed to by \a pSignatureInputs.
+	/// Returns \c true if all signatures are valid.
+	/// \note Verification stops after the first batch containing an invalid signature.
+	bool VerifyMultiShortCircuit(const SignatureInput* pSignatureInputs, size_t count);
 }}
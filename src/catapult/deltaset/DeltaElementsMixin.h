@@ -75,6 +75,11 @@ namespace catapult { namespace deltaset {
 			return CollectAllPointers(m_setDelta.deltas().Removed);
 		}
 
+		/// Gets all added, modified and removed elements.
+		auto deltas() const {
+			return m_setDelta.deltas();
+		}
+
 	private:
 		template<typename TSource>
 		static PointerContainer CollectAllPointers(const TSource& source) {
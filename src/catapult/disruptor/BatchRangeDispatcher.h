@@ -20,9 +20,10 @@
 
 #pragma once
 #include "ConsumerDispatcher.h"
+#include "catapult/utils/BoundedMpmcQueue.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/Hashers.h"
-#include "catapult/utils/SpinLock.h"
+#include "catapult/utils/Logging.h"
 #include <unordered_map>
 #include <vector>
 
@@ -53,26 +54,40 @@ namespace catapult { namespace disruptor {
 
 		using GroupedRangesMap = std::unordered_map<RangeGroupKey, std::vector<EntityRange>, RangeGroupKeyHasher>;
 
+		struct QueuedRange {
+			TAnnotatedEntityRange Range;
+			InputSource Source;
+		};
+
+	public:
+		/// Default maximum number of ranges that can be queued between dispatches.
+		static constexpr size_t Default_Queue_Capacity = 16 * 1024;
+
 	public:
-		/// Creates a batch range dispatcher around \a dispatcher.
-		explicit BatchRangeDispatcher(ConsumerDispatcher& dispatcher) : m_dispatcher(dispatcher)
+		/// Creates a batch range dispatcher around \a dispatcher that can queue up to \a queueCapacity ranges.
+		explicit BatchRangeDispatcher(ConsumerDispatcher& dispatcher, size_t queueCapacity = Default_Queue_Capacity)
+				: m_dispatcher(dispatcher)
+				, m_queue(queueCapacity)
 		{}
 
 	public:
 		/// Queues processing of \a range from \a source.
-		void queue(TAnnotatedEntityRange&& range, InputSource source) {
-			utils::SpinLockGuard guard(m_lock);
-			m_rangesMap[{ range.SourcePublicKey, source }].push_back(std::move(range.Range));
+		/// \note This function is lock-free and returns \c false if \a range was dropped because the queue is full.
+		bool queue(TAnnotatedEntityRange&& range, InputSource source) {
+			if (m_queue.tryPush(QueuedRange{ std::move(range), source }))
+				return true;
+
+			CATAPULT_LOG(warning) << "dropping range from " << source << " because batch dispatcher queue is full";
+			return false;
 		}
 
 		/// Dispatches all queued elements to the underlying dispatcher.
 		void dispatch() {
+			// group ranges outside of the queue so that producers are never blocked by a dispatch
 			GroupedRangesMap rangesMap;
-
-			{
-				utils::SpinLockGuard guard(m_lock);
-				rangesMap = std::move(m_rangesMap);
-			}
+			QueuedRange queuedRange;
+			while (m_queue.tryPop(queuedRange))
+				rangesMap[{ queuedRange.Range.SourcePublicKey, queuedRange.Source }].push_back(std::move(queuedRange.Range.Range));
 
 			for (auto& pair : rangesMap) {
 				auto mergedRange = EntityRange::MergeRanges(std::move(pair.second));
@@ -83,13 +98,11 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Returns \c true if no ranges are currently queued.
 		bool empty() const {
-			utils::SpinLockGuard guard(m_lock);
-			return m_rangesMap.empty();
+			return m_queue.empty();
 		}
 
 	private:
 		ConsumerDispatcher& m_dispatcher;
-		GroupedRangesMap m_rangesMap;
-		mutable utils::SpinLock m_lock;
+		utils::BoundedMpmcQueue<QueuedRange> m_queue;
 	};
 }}
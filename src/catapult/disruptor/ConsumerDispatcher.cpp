@@ -58,11 +58,14 @@ namespace catapult { namespace disruptor {
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowIfFull)
+			, m_numSpinIterations(options.NumSpinIterations)
+			, m_numYieldIterations(options.NumYieldIterations)
 			, m_keepRunning(true)
 			, m_barriers(consumers.size() + 1)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
-			, m_numActiveElements(0) {
+			, m_numActiveElements(0)
+			, m_consumerIdleMicros(consumers.size()) {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
@@ -72,7 +75,7 @@ namespace catapult { namespace disruptor {
 					try {
 						auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 						if (!pDisruptorElement) {
-							std::this_thread::sleep_for(std::chrono::milliseconds(10));
+							pThis->waitForNext(consumerEntry);
 							continue;
 						}
 
@@ -101,6 +104,11 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+
+		// wake up all blocked consumers so that they can observe the shutdown
+		for (auto i = 0u; i < m_barriers.size(); ++i)
+			m_barriers[i].notifyAll();
+
 		m_threads.join_all();
 	}
 
@@ -120,6 +128,14 @@ namespace catapult { namespace disruptor {
 		return m_numActiveElements.load();
 	}
 
+	std::vector<std::chrono::microseconds> ConsumerDispatcher::consumerIdleTimes() const {
+		std::vector<std::chrono::microseconds> idleTimes;
+		for (const auto& idleMicros : m_consumerIdleMicros)
+			idleTimes.emplace_back(idleMicros.load());
+
+		return idleTimes;
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -149,6 +165,30 @@ namespace catapult { namespace disruptor {
 		element.markProcessingComplete();
 	}
 
+	void ConsumerDispatcher::waitForNext(const ConsumerEntry& consumerEntry) {
+		// wait strategy: busy spin, then yield, then block until the consumer barrier is advanced
+		auto startTime = std::chrono::steady_clock::now();
+		auto& barrier = m_barriers[consumerEntry.level()];
+		auto isWaitComplete = [this, &barrier, &consumerEntry]() {
+			return barrier.position() != consumerEntry.position() || !m_keepRunning;
+		};
+
+		auto isComplete = false;
+		for (auto i = 0u; i < m_numSpinIterations && !isComplete; ++i)
+			isComplete = isWaitComplete();
+
+		for (auto i = 0u; i < m_numYieldIterations && !isComplete; ++i) {
+			std::this_thread::yield();
+			isComplete = isWaitComplete();
+		}
+
+		if (!isComplete)
+			barrier.wait(isWaitComplete);
+
+		auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+		m_consumerIdleMicros[consumerEntry.level()] += static_cast<uint64_t>(idleTime.count());
+	}
+
 	bool ConsumerDispatcher::canProcessNextElement() const {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
 		auto maxPosition = m_barriers[0].position();
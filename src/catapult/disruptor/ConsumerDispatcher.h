@@ -26,6 +26,7 @@
 #include "catapult/utils/NamedObject.h"
 #include <boost/thread.hpp>
 #include <atomic>
+#include <chrono>
 
 namespace catapult { namespace disruptor { class ConsumerEntry; } }
 
@@ -70,11 +71,16 @@ namespace catapult { namespace disruptor {
 		/// Returns the number of elements currently in the disruptor.
 		size_t numActiveElements() const;
 
+		/// Returns the cumulative time each consumer (indexed by level) spent waiting for elements.
+		std::vector<std::chrono::microseconds> consumerIdleTimes() const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
 		void advance(ConsumerEntry& consumerEntry);
 
+		void waitForNext(const ConsumerEntry& consumerEntry);
+
 		bool canProcessNextElement() const;
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
@@ -82,12 +88,15 @@ namespace catapult { namespace disruptor {
 	private:
 		size_t m_elementTraceInterval;
 		bool m_shouldThrowIfFull;
+		size_t m_numSpinIterations;
+		size_t m_numYieldIterations;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
+		std::vector<std::atomic<uint64_t>> m_consumerIdleMicros;
 
 		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
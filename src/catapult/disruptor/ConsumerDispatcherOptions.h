@@ -32,6 +32,8 @@ namespace catapult { namespace disruptor {
 				, DisruptorSize(disruptorSize)
 				, ElementTraceInterval(1)
 				, ShouldThrowIfFull(true)
+				, NumSpinIterations(1000)
+				, NumYieldIterations(100)
 		{}
 
 	public:
@@ -46,5 +48,11 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw if full, \c false if it should return an error.
 		bool ShouldThrowIfFull;
+
+		/// Number of times a consumer without pending elements busy spins before yielding.
+		size_t NumSpinIterations;
+
+		/// Number of times a consumer without pending elements yields before blocking.
+		size_t NumYieldIterations;
 	};
 }}
@@ -23,6 +23,8 @@
 #include "catapult/utils/Logging.h"
 #include "catapult/preprocessor.h"
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -36,11 +38,34 @@ namespace catapult { namespace disruptor {
 		DisruptorBarrier(size_t level, PositionType position)
 				: m_level(level)
 				, m_position(position)
+				, m_numWaiters(0)
 		{}
 
-		/// Advances the barrier.
+		/// Advances the barrier and wakes up all consumers blocked on it.
 		CATAPULT_INLINE void advance() {
 			++m_position;
+			if (0 != m_numWaiters)
+				notifyAll();
+		}
+
+		/// Wakes up all consumers blocked on the barrier.
+		void notifyAll() {
+			// acquire the mutex to prevent a consumer from missing the notification between checking its predicate and blocking
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+			}
+
+			m_condition.notify_all();
+		}
+
+		/// Blocks the calling consumer until \a predicate returns \c true.
+		/// \note \a predicate is rechecked every time the barrier is advanced or notified.
+		template<typename TPredicate>
+		void wait(TPredicate predicate) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			++m_numWaiters;
+			m_condition.wait(lock, predicate);
+			--m_numWaiters;
 		}
 
 		/// Returns level of the barrier.
@@ -56,5 +81,8 @@ namespace catapult { namespace disruptor {
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+		std::atomic<size_t> m_numWaiters;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
 	};
 }}
@@ -49,6 +49,14 @@ namespace catapult { namespace extensions {
 		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM ACT", [](const auto& dispatcher) {
 			return dispatcher.numActiveElements();
 		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " IDLE MS", [](const auto& dispatcher) {
+			// sum of the idle times of all consumers
+			std::chrono::microseconds totalIdleTime(0);
+			for (const auto& idleTime : dispatcher.consumerIdleTimes())
+				totalIdleTime += idleTime;
+
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(totalIdleTime).count());
+		});
 	}
 
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
@@ -30,6 +30,7 @@ namespace catapult { namespace extensions {
 			plugins::StorageConfiguration storageConfig;
 			storageConfig.PreferCacheDatabase = config.Node.ShouldUseCacheDatabaseStorage;
 			storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
+			storageConfig.ShouldCalculateStateRoots = config.Node.ShouldCalculateCacheStateRoots;
 			return storageConfig;
 		}
 	}
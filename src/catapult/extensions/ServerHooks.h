@@ -185,7 +185,8 @@ namespace catapult { namespace extensions {
 		/// Gets the known hash predicate augmented with a check in \a utCache.
 		KnownHashPredicate knownHashPredicate(const cache::MemoryUtCache& utCache) const {
 			return [&utCache, knownHashPredicates = m_knownHashPredicates](auto timestamp, const auto& hash) {
-				if (utCache.view().contains(hash))
+				const auto& hashFilter = utCache.hashFilter();
+				if (hashFilter.contains(timestamp, hash, [&utCache, &hash]() { return utCache.view().contains(hash); }))
 					return true;
 
 				for (const auto& knownHashPredicate : knownHashPredicates) {
@@ -26,6 +26,9 @@
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include <unordered_map>
 
 namespace catapult { namespace handlers {
 
@@ -161,8 +164,37 @@ namespace catapult { namespace handlers {
 			return std::min(config.MaxResponseBytes, info.pRequest->NumResponseBytes);
 		}
 
-		auto CreatePullBlocksHandler(const io::BlockStorageCache& storage, const PullBlocksHandlerConfiguration& config) {
-			return [&storage, config](const auto& packet, auto& context) {
+		class ClientRangeTracker {
+		private:
+			// bounds the memory used for tracking clients (all clients are forgotten when the bound is reached)
+			static constexpr size_t Max_Tracked_Clients = 1000;
+
+		public:
+			/// Records that the client identified by \a key was sent the blocks in the range [\a height, \a endHeight)
+			/// and returns \c true if that range directly follows the range previously sent to the same client.
+			bool update(const Key& key, Height height, Height endHeight) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_endHeights.size() >= Max_Tracked_Clients && m_endHeights.cend() == m_endHeights.find(key))
+					m_endHeights.clear();
+
+				// note that request heights are never zero, so a new client can never continue a previous range
+				auto& lastEndHeight = m_endHeights[key];
+				auto isContinuation = height == lastEndHeight;
+				lastEndHeight = endHeight;
+				return isContinuation;
+			}
+
+		private:
+			std::unordered_map<Key, Height, utils::ArrayHasher<Key>> m_endHeights;
+			utils::SpinLock m_lock;
+		};
+
+		auto CreatePullBlocksHandler(
+				const io::BlockStorageCache& storage,
+				const PullBlocksHandlerConfiguration& config,
+				const BlocksPrefetcher& prefetcher) {
+			auto pRangeTracker = std::make_shared<ClientRangeTracker>();
+			return [&storage, config, prefetcher, pRangeTracker](const auto& packet, auto& context) {
 				using RequestType = api::PullBlocksRequest;
 				auto storageView = storage.view();
 				auto info = ProcessHeightRequest<RequestType>(storageView, packet, context, false);
@@ -186,6 +218,11 @@ namespace catapult { namespace handlers {
 
 				auto payload = ionet::PacketPayloadFactory::FromEntities(RequestType::Packet_Type, blocks);
 				context.response(std::move(payload));
+
+				// a syncing client requests consecutive ranges of blocks, so read ahead the range that it will most likely request next
+				auto endHeight = info.pRequest->Height + Height(blocks.size());
+				if (pRangeTracker->update(context.key(), info.pRequest->Height, endHeight) && endHeight <= info.ChainHeight)
+					prefetcher(endHeight, static_cast<uint32_t>(blocks.size()));
 			};
 		}
 	}
@@ -193,7 +230,8 @@ namespace catapult { namespace handlers {
 	void RegisterPullBlocksHandler(
 			ionet::ServerPacketHandlers& handlers,
 			const io::BlockStorageCache& storage,
-			const PullBlocksHandlerConfiguration& config) {
-		handlers.registerHandler(ionet::PacketType::Pull_Blocks, CreatePullBlocksHandler(storage, config));
+			const PullBlocksHandlerConfiguration& config,
+			const BlocksPrefetcher& prefetcher) {
+		handlers.registerHandler(ionet::PacketType::Pull_Blocks, CreatePullBlocksHandler(storage, config, prefetcher));
 	}
 }}
@@ -57,10 +57,16 @@ namespace catapult { namespace handlers {
 		uint32_t MaxResponseBytes;
 	};
 
+	/// Prototype for a function that reads ahead a number of blocks starting at a height.
+	using BlocksPrefetcher = consumer<Height, uint32_t>;
+
 	/// Registers a pull blocks handler in \a handlers that responds with blocks from \a storage according to behavior
 	/// specified in \a config.
+	/// \note When a request continues the range returned by the previous request of the same client,
+	///       \a prefetcher is passed the range following the returned blocks.
 	void RegisterPullBlocksHandler(
 			ionet::ServerPacketHandlers& handlers,
 			const io::BlockStorageCache& storage,
-			const PullBlocksHandlerConfiguration& config);
+			const PullBlocksHandlerConfiguration& config,
+			const BlocksPrefetcher& prefetcher);
 }}
@@ -21,6 +21,9 @@
 #include "BlockStorageCache.h"
 #include "catapult/model/Elements.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <map>
 
 namespace catapult { namespace io {
 
@@ -64,10 +67,16 @@ namespace catapult { namespace io {
 	}
 
 	/// Cached data holder.
+	/// \note Block elements are kept in least recently used order and are evicted when their total size exceeds the maximum size.
 	struct CachedData {
 	public:
-		CachedData() = default;
+		explicit CachedData(size_t maxCacheSize)
+				: m_maxCacheSize(maxCacheSize)
+				, m_cacheSize(0)
+				, m_statistics()
+		{}
 
+	public:
 		/// Returns cached height.
 		Height getHeight() const {
 			return m_chainHeight;
@@ -75,48 +84,103 @@ namespace catapult { namespace io {
 
 		/// Returns \c true if cache contains element at \a height.
 		bool contains(Height height) const {
-			return m_pBlockElement && height == m_pBlockElement->Block.Height;
+			utils::SpinLockGuard guard(m_lock);
+			return m_entries.cend() != m_entries.find(height);
 		}
 
-		/// Returns cached block element.
-		std::shared_ptr<const model::BlockElement> getBlockElement(Height) const {
-			return m_pBlockElement;
+		/// Returns cached block element at \a height or \c nullptr if it is not cached.
+		std::shared_ptr<const model::BlockElement> find(Height height) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entries.find(height);
+			if (m_entries.cend() == iter) {
+				++m_statistics.NumMisses;
+				return nullptr;
+			}
+
+			++m_statistics.NumHits;
+			m_usageOrder.splice(m_usageOrder.end(), m_usageOrder, iter->second.UsageIter);
+			return iter->second.pBlockElement;
 		}
 
-		/// Returns cached block.
-		std::shared_ptr<const model::Block> getBlock(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		/// Returns cache statistics.
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return m_statistics;
 		}
 
-		/// Updates cache with block element (\a blockElement).
-		void update(const model::BlockElement& blockElement) {
-			// note: update receives elements during loadBlock, but also saveBlock. We get them from BlockChainSyncConsumer,
-			// and it gets them from disruptor... in order NOT to copy here we'd need to take ownership of those.
-			// Currently we can't/shouldn't do it, as there's "new block" consumer afterwards and possibly ProcessingCompleteFunc.
-			m_pBlockElement = Copy(blockElement);
+		/// Adds block element (\a pBlockElement) to the cache.
+		void add(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			auto height = pBlockElement->Block.Height;
+			auto size = GetCachedSize(*pBlockElement);
+
+			utils::SpinLockGuard guard(m_lock);
+			remove(m_entries.find(height));
+			if (size > m_maxCacheSize)
+				return;
+
+			while (m_cacheSize + size > m_maxCacheSize) {
+				auto lruIter = m_entries.find(m_usageOrder.front());
+				m_statistics.NumEvictedBytes += lruIter->second.Size;
+				remove(lruIter);
+			}
+
+			auto usageIter = m_usageOrder.insert(m_usageOrder.end(), height);
+			m_entries.emplace(height, Entry{ pBlockElement, size, usageIter });
+			m_cacheSize += size;
 		}
 
 		/// Updates cached height to \a height.
 		void update(Height height) {
 			m_chainHeight = height;
 
-			if (m_pBlockElement && height < m_pBlockElement->Block.Height)
-				m_pBlockElement.reset();
+			utils::SpinLockGuard guard(m_lock);
+			while (!m_entries.empty() && height < m_entries.crbegin()->first)
+				remove(std::prev(m_entries.end()));
+		}
+
+	private:
+		struct Entry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			size_t Size;
+			std::list<Height>::iterator UsageIter;
+		};
+
+		using EntryMap = std::map<Height, Entry>;
+
+	private:
+		static size_t GetCachedSize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement);
+		}
+
+		void remove(EntryMap::iterator iter) {
+			if (m_entries.end() == iter)
+				return;
+
+			m_cacheSize -= iter->second.Size;
+			m_usageOrder.erase(iter->second.UsageIter);
+			m_entries.erase(iter);
 		}
 
 	private:
 		// note: the reason to have them separated is drop blocks, which
-		// updates the height, but we don't want to touch cached block(s).
+		// updates the height, but we don't want to touch cached block(s) at or below it.
 		Height m_chainHeight;
-		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+		size_t m_maxCacheSize;
+		size_t m_cacheSize;
+		EntryMap m_entries;
+		std::list<Height> m_usageOrder; // least recently used heights are first
+		BlockStorageCacheStatistics m_statistics;
+		mutable utils::SpinLock m_lock;
 	};
 
 	BlockStorageCache::~BlockStorageCache() = default;
 
 	// This ctor takes r-value, to move the storage (that's not a move ctor).
-	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage)
+	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, size_t maxCacheSize)
 			: m_pStorage(std::move(pStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize)) {
 		m_pCachedData->update(m_pStorage->chainHeight());
 	}
 
@@ -127,29 +191,35 @@ namespace catapult { namespace io {
 	}
 
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
-		if (height > chainHeight())
-			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
-
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlock(height);
-
-		return m_storage.loadBlock(height);
+		return BlockElementAsSharedBlock(loadBlockElement(height));
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlockElement(height);
+		auto pBlockElement = m_cachedData.find(height);
+		if (pBlockElement)
+			return pBlockElement;
 
-		return m_storage.loadBlockElement(height);
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.add(pBlockElement);
+		return pBlockElement;
 	}
 
 	model::HashRange BlockStorageView::loadHashesFrom(Height height, size_t maxHashes) const {
 		return m_storage.loadHashesFrom(height, maxHashes);
 	}
 
+	void BlockStorageView::prefetch(Height height, size_t numBlocks) const {
+		auto endHeight = std::min(height + Height(numBlocks), chainHeight() + Height(1));
+		for (auto currentHeight = std::max(height, Height(1)); currentHeight < endHeight; currentHeight = currentHeight + Height(1)) {
+			// blocks that are already cached are not touched so that prefetching does not distort the usage order
+			if (!m_cachedData.contains(currentHeight))
+				m_cachedData.add(m_storage.loadBlockElement(currentHeight));
+		}
+	}
+
 	// endregion
 
 	// region BlockStorageModifier
@@ -159,7 +229,9 @@ namespace catapult { namespace io {
 			if (blockElement.Block.Height > cachedData.getHeight())
 				cachedData.update(blockElement.Block.Height);
 
-			cachedData.update(blockElement);
+			// note: saved elements are owned by the caller (e.g. they are still used by subsequent consumers),
+			// so they need to be copied before they can be cached
+			cachedData.add(Copy(blockElement));
 		}
 	}
 
@@ -172,10 +244,10 @@ namespace catapult { namespace io {
 		if (blockElements.empty())
 			return;
 
-		for (const auto& blockElement : blockElements)
+		for (const auto& blockElement : blockElements) {
 			m_storage.saveBlock(blockElement);
-
-		CacheBlockElement(m_cachedData, blockElements.back());
+			CacheBlockElement(m_cachedData, blockElement);
+		}
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -195,5 +267,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
@@ -33,7 +33,7 @@ namespace catapult { namespace io {
 		explicit BlockStorageView(
 				const BlockStorage& storage,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-				const CachedData& cachedData)
+				CachedData& cachedData)
 				: m_storage(storage)
 				, m_readLock(std::move(readLock))
 				, m_cachedData(cachedData)
@@ -52,10 +52,14 @@ namespace catapult { namespace io {
 		/// Returns a range of at most \a maxHashes hashes starting at \a height.
 		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const;
 
+		/// Loads at most \a numBlocks blocks starting at \a height into the cache without returning them.
+		/// \note Blocks above the chain height are ignored.
+		void prefetch(Height height, size_t numBlocks) const;
+
 	private:
 		const BlockStorage& m_storage;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
-		const CachedData& m_cachedData;
+		CachedData& m_cachedData;
 	};
 
 	/// A write only view on top of block storage.
@@ -89,12 +93,28 @@ namespace catapult { namespace io {
 		CachedData& m_cachedData;
 	};
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of block loads served from memory.
+		uint64_t NumHits;
+
+		/// Number of block loads served from the underlying storage.
+		uint64_t NumMisses;
+
+		/// Total size of all blocks that were evicted from memory in order to make room for other blocks.
+		uint64_t NumEvictedBytes;
+	};
+
 	/// A cache around a BlockStorage.
-	/// \note Currently this "cache" only provides synchronization.
+	/// \note The most recently used blocks are kept in memory until their total size exceeds the maximum cache size.
 	class BlockStorageCache {
 	public:
-		/// Creates a new cache around \a pStorage.
-		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage);
+		/// Default maximum (approximate) size of all cached blocks.
+		static constexpr size_t Default_Max_Cache_Size = 100 * 1024 * 1024;
+
+	public:
+		/// Creates a new cache around \a pStorage that keeps at most \a maxCacheSize bytes of blocks in memory.
+		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, size_t maxCacheSize = Default_Max_Cache_Size);
 
 		/// Destroys the cache.
 		~BlockStorageCache();
@@ -106,6 +126,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
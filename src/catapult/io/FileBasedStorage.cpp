@@ -22,9 +22,11 @@
 #include "PodIoUtils.h"
 #include "RawFile.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Logging.h"
 #include "catapult/utils/MemoryUtils.h"
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
+#include <cstring>
 #include <inttypes.h>
 
 using catapult::model::Block;
@@ -35,6 +37,7 @@ namespace catapult { namespace io {
 	namespace {
 		static constexpr uint64_t Unset_Directory_Id = std::numeric_limits<uint64_t>::max();
 		static constexpr uint32_t Files_Per_Directory = 65536u;
+		static constexpr uint32_t Max_Unflushed_Journal_Writes = 100u;
 		static constexpr auto Block_File_Extension = ".dat";
 		static constexpr auto Index_File = "index.dat";
 
@@ -81,10 +84,10 @@ namespace catapult { namespace io {
 			return boost::filesystem::exists(journalPath) && boost::filesystem::is_regular_file(journalPath);
 		}
 
-		auto OpenJournalFile(const std::string& baseDirectory, OpenMode mode = OpenMode::Read_Only) {
+		auto OpenJournalFile(const std::string& baseDirectory, OpenMode mode = OpenMode::Read_Only, LockMode lockMode = LockMode::File) {
 			boost::filesystem::path journalPath = baseDirectory;
 			journalPath /= Index_File;
-			return std::make_unique<RawFile>(journalPath.generic_string().c_str(), mode);
+			return std::make_unique<RawFile>(journalPath.generic_string().c_str(), mode, lockMode);
 		}
 
 		// note: DeleteBlockFile returns false when attempting to delete nonexistent file.
@@ -140,6 +143,8 @@ namespace catapult { namespace io {
 	void FileBasedStorage::HashFile::save(Height height, const Hash256& hash) {
 		auto currentId = height.unwrap() / Files_Per_Directory;
 		if (m_cachedDirectoryId != currentId) {
+			// make sure all hashes of the previous directory are flushed before its hash file is closed
+			flush();
 			m_pCachedHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Append);
 			m_cachedDirectoryId = currentId;
 		}
@@ -148,24 +153,89 @@ namespace catapult { namespace io {
 		m_pCachedHashFile->write(hash);
 	}
 
+	void FileBasedStorage::HashFile::flush() {
+		if (m_pCachedHashFile)
+			m_pCachedHashFile->flush();
+	}
+
+	namespace {
+		Height ReadHeight(const std::string& baseDirectory) {
+			if (!HasJournal(baseDirectory))
+				return Height(1);
+
+			auto pJournalFile = OpenJournalFile(baseDirectory);
+			return Read<Height>(*pJournalFile);
+		}
+	}
+
+	FileBasedStorage::Journal::Journal(const std::string& dataDirectory)
+			: m_dataDirectory(dataDirectory)
+			, m_height(ReadHeight(m_dataDirectory))
+	{}
+
+	Height FileBasedStorage::Journal::height() const {
+		return m_height;
+	}
+
+	void FileBasedStorage::Journal::save(Height height) {
+		// keep the journal open and overwrite the height in place
+		if (!m_pJournalFile)
+			m_pJournalFile = OpenJournalFile(m_dataDirectory, OpenMode::Read_Append, LockMode::None);
+
+		m_pJournalFile->seek(0);
+		Write(*m_pJournalFile, height);
+		m_height = height;
+	}
+
+	void FileBasedStorage::Journal::flush() {
+		if (m_pJournalFile)
+			m_pJournalFile->flush();
+	}
+
 	FileBasedStorage::FileBasedStorage(const std::string& dataDirectory)
 			: m_dataDirectory(dataDirectory)
 			, m_hashFile(m_dataDirectory)
+			, m_journal(m_dataDirectory)
+			, m_numUnflushedWrites(0)
+			, m_areHashesLoaded(false)
 	{}
 
-	namespace {
-		void SetHeight(const std::string& baseDirectory, Height height) {
-			auto pJournalFile = OpenJournalFile(baseDirectory, OpenMode::Read_Write);
-			Write(*pJournalFile, height);
+	FileBasedStorage::~FileBasedStorage() {
+		if (0 == m_numUnflushedWrites)
+			return;
+
+		try {
+			m_hashFile.flush();
+			m_journal.flush();
+		} catch (...) {
+			CATAPULT_LOG(error) << "failed to flush block storage journal in " << m_dataDirectory;
 		}
 	}
 
-	Height FileBasedStorage::chainHeight() const {
-		if (!HasJournal(m_dataDirectory))
-			return Height(1);
+	const std::vector<Hash256>& FileBasedStorage::hashes() const {
+		std::lock_guard<std::mutex> guard(m_hashesMutex);
+		if (!m_areHashesLoaded) {
+			auto hashRange = m_hashFile.loadHashesFrom(Height(1), m_journal.height().unwrap());
+			m_hashes.assign(hashRange.cbegin(), hashRange.cend());
+			m_areHashesLoaded = true;
+		}
+
+		return m_hashes;
+	}
+
+	void FileBasedStorage::setHeight(Height height, bool shouldFlush) {
+		m_journal.save(height);
+		if (!shouldFlush && ++m_numUnflushedWrites < Max_Unflushed_Journal_Writes)
+			return;
 
-		auto pJournalFile = OpenJournalFile(m_dataDirectory);
-		return Read<Height>(*pJournalFile);
+		// flush hashes before height so that a flushed height never refers to unflushed hashes
+		m_hashFile.flush();
+		m_journal.flush();
+		m_numUnflushedWrites = 0;
+	}
+
+	Height FileBasedStorage::chainHeight() const {
+		return m_journal.height();
 	}
 
 	namespace {
@@ -240,7 +310,11 @@ namespace catapult { namespace io {
 
 		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
 		auto numHashes = std::min(maxHashes, numAvailableHashes);
-		return m_hashFile.loadHashesFrom(height, numHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+		std::memcpy(pData, hashes()[static_cast<size_t>(height.unwrap() - 1)].data(), numHashes * Hash256_Size);
+		return range;
 	}
 
 	void FileBasedStorage::saveBlock(const model::BlockElement& blockElement) {
@@ -250,6 +324,9 @@ namespace catapult { namespace io {
 		if (height != currentHeight + Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
 
+		// load all hashes before saving the block so that they are in sync with the journal
+		hashes();
+
 		{
 			auto pBlockFile = OpenBlockFile(m_dataDirectory, height, OpenMode::Read_Write);
 			pBlockFile->write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
@@ -270,13 +347,24 @@ namespace catapult { namespace io {
 		}
 
 		m_hashFile.save(height, blockElement.EntityHash);
-
-		if (height > currentHeight)
-			SetHeight(m_dataDirectory, height);
+		m_hashes.push_back(blockElement.EntityHash);
+		setHeight(height, false);
 	}
 
 	void FileBasedStorage::dropBlocksAfter(Height height) {
-		SetHeight(m_dataDirectory, height);
+		{
+			std::lock_guard<std::mutex> guard(m_hashesMutex);
+			if (m_areHashesLoaded && height.unwrap() <= m_hashes.size()) {
+				m_hashes.resize(static_cast<size_t>(height.unwrap()));
+			} else {
+				// hashes of blocks after the current chain height are reloaded from disk on next use
+				m_hashes.clear();
+				m_areHashesLoaded = false;
+			}
+		}
+
+		// rollbacks are flushed immediately
+		setHeight(height, true);
 	}
 
 	void FileBasedStorage::pruneBlocksBefore(Height pruneHeight) {
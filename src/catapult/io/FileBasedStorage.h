@@ -21,16 +21,23 @@
 #pragma once
 #include "BlockStorage.h"
 #include "RawFile.h"
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace catapult { namespace io {
 
 	/// File-based block storage.
+	/// \note The chain height and the hashes of all blocks are resident in memory, so chainHeight and loadHashesFrom
+	///       do not access the filesystem once the hashes have been loaded.
 	class FileBasedStorage final : public PrunableBlockStorage {
 	public:
 		/// Creates a file-based storage, where blocks will be stored inside \a dataDirectory.
 		explicit FileBasedStorage(const std::string& dataDirectory);
 
+		/// Destroys the storage and flushes all pending journal writes.
+		~FileBasedStorage() override;
+
 	public:
 		Height chainHeight() const override;
 
@@ -53,6 +60,7 @@ namespace catapult { namespace io {
 
 			model::HashRange loadHashesFrom(Height height, size_t numHashes) const;
 			void save(Height height, const Hash256& hash);
+			void flush();
 
 		private:
 			const std::string& m_dataDirectory;
@@ -62,7 +70,32 @@ namespace catapult { namespace io {
 			std::unique_ptr<RawFile> m_pCachedHashFile;
 		};
 
+		class Journal final {
+		public:
+			explicit Journal(const std::string& dataDirectory);
+
+			Height height() const;
+			void save(Height height);
+			void flush();
+
+		private:
+			const std::string& m_dataDirectory;
+			Height m_height;
+			std::unique_ptr<RawFile> m_pJournalFile;
+		};
+
+		const std::vector<Hash256>& hashes() const;
+
+		void setHeight(Height height, bool shouldFlush);
+
 		std::string m_dataDirectory;
 		HashFile m_hashFile;
+		Journal m_journal;
+		uint32_t m_numUnflushedWrites;
+
+		// hashes of all blocks (the hash of the block at height H is at index H - 1), loaded on first use
+		mutable std::vector<Hash256> m_hashes;
+		mutable bool m_areHashesLoaded;
+		mutable std::mutex m_hashesMutex;
 	};
 }}
@@ -46,6 +46,7 @@ namespace catapult { namespace io {
 		static const char* Error_Write = "couldn't write to file";
 		static const char* Error_Read = "couldn't read from file";
 		static const char* Error_Seek = "couldn't seek in file";
+		static const char* Error_Flush = "couldn't flush file";
 		static const char* Error_Desc = "invalid file descriptor";
 
 #ifdef _MSC_VER
@@ -64,6 +65,7 @@ namespace catapult { namespace io {
 		constexpr auto read = ::_read;
 		constexpr auto lseek = ::_lseeki64;
 		constexpr auto fstat = ::_fstati64;
+		constexpr auto fsync = ::_commit;
 		using StatStruct = struct ::_stat64;
 
 		template<typename TSize>
@@ -153,6 +155,10 @@ namespace catapult { namespace io {
 			return offset == r;
 		}
 
+		bool nemFlush(int fd) {
+			return 0 == fsync(fd);
+		}
+
 		bool nemFileSize(int fd, uint64_t& fileSize) {
 			StatStruct st;
 			fileSize = 0;
@@ -233,6 +239,11 @@ namespace catapult { namespace io {
 		m_fileSize = std::max(m_fileSize, m_position);
 	}
 
+	void RawFile::flush() {
+		if (!nemFlush(m_fd.raw()))
+			CATAPULT_THROW_AND_LOG_RAW_FILE_ERROR(Error_Flush);
+	}
+
 	void RawFile::read(const MutableRawBuffer& dataBuffer) {
 		if (dataBuffer.Size != nemRead(m_fd.raw(), dataBuffer))
 			CATAPULT_THROW_AND_LOG_RAW_FILE_ERROR(Error_Read);
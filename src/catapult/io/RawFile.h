@@ -63,6 +63,10 @@ namespace catapult { namespace io {
 		/// If proper amount of data could not be written catapult_file_io_error exception will be thrown.
 		void write(const RawBuffer& dataBuffer);
 
+		/// Flushes all written data to the storage device.
+		/// Throws catapult_file_io_error exception if data could not be flushed.
+		void flush();
+
 		/// Seeks to given absolute position.
 		/// Throws catapult_file_io_error exception if seek has failed.
 		void seek(uint64_t position);
@@ -0,0 +1,421 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "SegmentedFileStorage.h"
+#include "PodIoUtils.h"
+#include "RawFile.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+#include <inttypes.h>
+#include <map>
+#include <mutex>
+
+using catapult::model::Block;
+using catapult::model::BlockElement;
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr uint64_t Unset_Segment_Id = std::numeric_limits<uint64_t>::max();
+		static constexpr size_t Max_Mapped_Segments = 16;
+		static constexpr auto Height_File = "height.dat";
+		static constexpr auto Data_File_Extension = ".blocks";
+		static constexpr auto Index_File_Extension = ".index";
+
+#pragma pack(push, 1)
+
+		// entry of a segment index file (one per block)
+		struct IndexEntry {
+			uint64_t Offset;
+			uint64_t Size;
+			Hash256 EntityHash;
+		};
+
+#pragma pack(pop)
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+		std::string GetSegmentPath(const std::string& baseDirectory, uint64_t segmentId, const char* extension) {
+			char filename[32];
+			SPRINTF(filename, "%05" PRIu64, segmentId);
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			path += extension;
+			return path.generic_string();
+		}
+
+		std::string GetHeightPath(const std::string& baseDirectory) {
+			boost::filesystem::path path = baseDirectory;
+			path /= Height_File;
+			return path.generic_string();
+		}
+
+		Height ReadChainHeight(const std::string& baseDirectory) {
+			auto heightPath = GetHeightPath(baseDirectory);
+			if (!boost::filesystem::exists(heightPath))
+				return Height(0);
+
+			RawFile heightFile(heightPath, OpenMode::Read_Only);
+			return Read<Height>(heightFile);
+		}
+
+		// segment zero contains the blocks with heights [1, blocksPerSegment]
+		struct SegmentPosition {
+			uint64_t SegmentId;
+			uint64_t Position;
+		};
+
+		SegmentPosition GetSegmentPosition(Height height, uint32_t blocksPerSegment) {
+			auto index = height.unwrap() - 1;
+			return { index / blocksPerSegment, index % blocksPerSegment };
+		}
+
+		void WriteChainHeight(const std::string& baseDirectory, Height height) {
+			RawFile heightFile(GetHeightPath(baseDirectory), OpenMode::Read_Write);
+			Write(heightFile, height);
+		}
+
+		class MappedFile {
+		public:
+			explicit MappedFile(const std::string& path)
+					: m_mapping(path.c_str(), boost::interprocess::read_only)
+					, m_region(m_mapping, boost::interprocess::read_only)
+			{}
+
+		public:
+			const uint8_t* data() const {
+				return static_cast<const uint8_t*>(m_region.get_address());
+			}
+
+			uint64_t size() const {
+				return m_region.get_size();
+			}
+
+		private:
+			boost::interprocess::file_mapping m_mapping;
+			boost::interprocess::mapped_region m_region;
+		};
+	}
+
+	// region SegmentWriter
+
+	class SegmentedFileStorage::SegmentWriter {
+	public:
+		SegmentWriter(const std::string& dataDirectory, uint32_t blocksPerSegment)
+				: m_dataDirectory(dataDirectory)
+				, m_blocksPerSegment(blocksPerSegment)
+				, m_segmentId(Unset_Segment_Id)
+		{}
+
+	public:
+		void append(const BlockElement& blockElement) {
+			auto segmentPosition = GetSegmentPosition(blockElement.Block.Height, m_blocksPerSegment);
+			auto position = segmentPosition.Position;
+			if (m_segmentId != segmentPosition.SegmentId)
+				open(segmentPosition.SegmentId);
+
+			// blocks within a segment are stored contiguously, so the block is written right after its predecessor
+			// (any data following it was written before the chain was rolled back and is overwritten)
+			IndexEntry entry;
+			entry.Offset = 0 == position ? 0 : nextOffset(position);
+			entry.EntityHash = blockElement.EntityHash;
+
+			m_pDataFile->seek(entry.Offset);
+			m_pDataFile->write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
+			m_pDataFile->write(blockElement.EntityHash);
+			m_pDataFile->write(blockElement.GenerationHash);
+
+			auto transactionsCount = static_cast<uint32_t>(blockElement.Transactions.size());
+			Write32(*m_pDataFile, transactionsCount);
+			std::vector<Hash256> hashes(2 * transactionsCount);
+			auto iter = hashes.begin();
+			for (const auto& transactionElement : blockElement.Transactions) {
+				*iter++ = transactionElement.EntityHash;
+				*iter++ = transactionElement.MerkleComponentHash;
+			}
+
+			m_pDataFile->write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+			entry.Size = m_pDataFile->position() - entry.Offset;
+
+			// the index entry is written last so that it never points to incomplete data
+			m_pIndexFile->seek(position * sizeof(IndexEntry));
+			m_pIndexFile->write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(IndexEntry) });
+		}
+
+	private:
+		void open(uint64_t segmentId) {
+			// files are not locked because they are mapped for reading while they are open
+			m_pDataFile.reset();
+			m_pIndexFile.reset();
+			m_pDataFile = std::make_unique<RawFile>(
+					GetSegmentPath(m_dataDirectory, segmentId, Data_File_Extension),
+					OpenMode::Read_Append,
+					LockMode::None);
+			m_pIndexFile = std::make_unique<RawFile>(
+					GetSegmentPath(m_dataDirectory, segmentId, Index_File_Extension),
+					OpenMode::Read_Append,
+					LockMode::None);
+			m_segmentId = segmentId;
+		}
+
+		uint64_t nextOffset(uint64_t position) {
+			IndexEntry previousEntry;
+			m_pIndexFile->seek((position - 1) * sizeof(IndexEntry));
+			m_pIndexFile->read({ reinterpret_cast<uint8_t*>(&previousEntry), sizeof(IndexEntry) });
+			return previousEntry.Offset + previousEntry.Size;
+		}
+
+	private:
+		const std::string& m_dataDirectory;
+		uint32_t m_blocksPerSegment;
+		uint64_t m_segmentId;
+		std::unique_ptr<RawFile> m_pDataFile;
+		std::unique_ptr<RawFile> m_pIndexFile;
+	};
+
+	// endregion
+
+	// region MappedFileCache
+
+	class SegmentedFileStorage::MappedFileCache {
+	public:
+		MappedFileCache(const std::string& dataDirectory, const char* extension)
+				: m_dataDirectory(dataDirectory)
+				, m_extension(extension)
+		{}
+
+	public:
+		/// Gets a mapping of the file of segment \a segmentId that spans at least \a minSize bytes
+		/// or \c nullptr if the file does not exist or is too small.
+		std::shared_ptr<const MappedFile> get(uint64_t segmentId, uint64_t minSize) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_files.find(segmentId);
+			if (m_files.cend() != iter && iter->second->size() >= minSize)
+				return iter->second;
+
+			// the file might have grown since it was mapped, so check its current size
+			auto path = GetSegmentPath(m_dataDirectory, segmentId, m_extension);
+			boost::system::error_code ec;
+			auto fileSize = boost::filesystem::file_size(path, ec);
+			if (ec || 0 == fileSize || fileSize < minSize)
+				return nullptr;
+
+			// older segments are accessed less frequently, so evict the oldest mapped segment
+			if (m_files.cend() == iter && m_files.size() >= Max_Mapped_Segments)
+				m_files.erase(m_files.cbegin());
+
+			auto pFile = std::make_shared<const MappedFile>(path);
+			m_files[segmentId] = pFile;
+			return pFile;
+		}
+
+		/// Unmaps the file of segment \a segmentId.
+		void remove(uint64_t segmentId) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_files.erase(segmentId);
+		}
+
+	private:
+		const std::string& m_dataDirectory;
+		const char* m_extension;
+		std::map<uint64_t, std::shared_ptr<const MappedFile>> m_files;
+		std::mutex m_mutex;
+	};
+
+	// endregion
+
+	SegmentedFileStorage::SegmentedFileStorage(const std::string& dataDirectory, uint32_t blocksPerSegment)
+			: m_dataDirectory(dataDirectory)
+			, m_blocksPerSegment(blocksPerSegment) {
+		if (0 == m_blocksPerSegment)
+			CATAPULT_THROW_INVALID_ARGUMENT("blocks per segment must be nonzero");
+
+		if (!boost::filesystem::exists(m_dataDirectory))
+			boost::filesystem::create_directories(m_dataDirectory);
+
+		m_chainHeight = ReadChainHeight(m_dataDirectory);
+		m_pWriter = std::make_unique<SegmentWriter>(m_dataDirectory, m_blocksPerSegment);
+		m_pIndexFiles = std::make_unique<MappedFileCache>(m_dataDirectory, Index_File_Extension);
+		m_pDataFiles = std::make_unique<MappedFileCache>(m_dataDirectory, Data_File_Extension);
+	}
+
+	SegmentedFileStorage::~SegmentedFileStorage() = default;
+
+	Height SegmentedFileStorage::chainHeight() const {
+		return m_chainHeight;
+	}
+
+	std::shared_ptr<const uint8_t> SegmentedFileStorage::mapBlockRecord(Height height) const {
+		if (Height(0) == height)
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot load block at height zero");
+
+		if (height > m_chainHeight)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		auto segmentPosition = GetSegmentPosition(height, m_blocksPerSegment);
+		auto position = segmentPosition.Position;
+		auto pIndexFile = m_pIndexFiles->get(segmentPosition.SegmentId, (position + 1) * sizeof(IndexEntry));
+		if (!pIndexFile)
+			CATAPULT_THROW_RUNTIME_ERROR_1("block index is missing for block at height", height);
+
+		IndexEntry entry;
+		std::memcpy(static_cast<void*>(&entry), pIndexFile->data() + position * sizeof(IndexEntry), sizeof(IndexEntry));
+
+		auto pDataFile = m_pDataFiles->get(segmentPosition.SegmentId, entry.Offset + entry.Size);
+		if (!pDataFile)
+			CATAPULT_THROW_RUNTIME_ERROR_1("block data is missing (pruned) for block at height", height);
+
+		// the returned pointer keeps the mapping alive
+		return std::shared_ptr<const uint8_t>(pDataFile, pDataFile->data() + entry.Offset);
+	}
+
+	std::shared_ptr<const model::Block> SegmentedFileStorage::loadBlock(Height height) const {
+		auto pRecord = mapBlockRecord(height);
+		const auto& block = reinterpret_cast<const Block&>(*pRecord);
+
+		auto pBlock = utils::MakeSharedWithSize<Block>(block.Size);
+		std::memcpy(static_cast<void*>(pBlock.get()), &block, block.Size);
+		return pBlock;
+	}
+
+	std::shared_ptr<const model::BlockElement> SegmentedFileStorage::loadBlockElement(Height height) const {
+		auto pRecord = mapBlockRecord(height);
+		const auto* pRecordData = pRecord.get();
+		auto size = reinterpret_cast<const Block&>(*pRecordData).Size;
+
+		// allocate memory for both the element and the block in one shot (Block data is appended)
+		auto pData = utils::MakeUniqueWithSize<uint8_t>(sizeof(BlockElement) + size);
+
+		// copy the block data
+		auto pBlockData = pData.get() + sizeof(BlockElement);
+		std::memcpy(pBlockData, pRecordData, size);
+		pRecordData += size;
+
+		// create the block element and transfer ownership from pData to pBlockElement
+		auto pBlockElementRaw = new (pData.get()) BlockElement(*reinterpret_cast<Block*>(pBlockData));
+		auto pBlockElement = std::shared_ptr<BlockElement>(pBlockElementRaw);
+		pData.release();
+
+		// copy metadata
+		std::memcpy(pBlockElement->EntityHash.data(), pRecordData, Hash256_Size);
+		pRecordData += Hash256_Size;
+		std::memcpy(pBlockElement->GenerationHash.data(), pRecordData, Hash256_Size);
+		pRecordData += Hash256_Size;
+
+		// copy transaction hashes
+		uint32_t numTransactions;
+		std::memcpy(&numTransactions, pRecordData, sizeof(uint32_t));
+		pRecordData += sizeof(uint32_t);
+
+		pBlockElement->Transactions.reserve(numTransactions);
+		for (const auto& transaction : pBlockElement->Block.Transactions()) {
+			pBlockElement->Transactions.push_back(model::TransactionElement(transaction));
+			auto& transactionElement = pBlockElement->Transactions.back();
+			std::memcpy(transactionElement.EntityHash.data(), pRecordData, Hash256_Size);
+			std::memcpy(transactionElement.MerkleComponentHash.data(), pRecordData + Hash256_Size, Hash256_Size);
+			pRecordData += 2 * Hash256_Size;
+		}
+
+		return pBlockElement;
+	}
+
+	model::HashRange SegmentedFileStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (Height(0) == height || m_chainHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((m_chainHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+		while (numHashes) {
+			auto segmentPosition = GetSegmentPosition(height, m_blocksPerSegment);
+			auto position = segmentPosition.Position;
+			auto count = std::min<size_t>(numHashes, m_blocksPerSegment - position);
+
+			auto pIndexFile = m_pIndexFiles->get(segmentPosition.SegmentId, (position + count) * sizeof(IndexEntry));
+			if (!pIndexFile)
+				CATAPULT_THROW_RUNTIME_ERROR_1("block index is missing for block at height", height);
+
+			const auto* pEntryData = pIndexFile->data() + position * sizeof(IndexEntry);
+			for (auto i = 0u; i < count; ++i) {
+				std::memcpy(pData, pEntryData + offsetof(IndexEntry, EntityHash), Hash256_Size);
+				pData += Hash256_Size;
+				pEntryData += sizeof(IndexEntry);
+			}
+
+			numHashes -= count;
+			height = height + Height(count);
+		}
+
+		return range;
+	}
+
+	void SegmentedFileStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		if (height != m_chainHeight + Height(1))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
+
+		m_pWriter->append(blockElement);
+		WriteChainHeight(m_dataDirectory, height);
+		m_chainHeight = height;
+	}
+
+	void SegmentedFileStorage::dropBlocksAfter(Height height) {
+		WriteChainHeight(m_dataDirectory, height);
+		m_chainHeight = height;
+	}
+
+	void SegmentedFileStorage::pruneBlocksBefore(Height pruneHeight) {
+		if (pruneHeight > m_chainHeight)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("prune requested with height", pruneHeight);
+
+		if (Height(0) == pruneHeight)
+			return;
+
+		// only segments preceding the segment containing pruneHeight are dropped
+		// (segment zero contains the nemesis block and is never pruned)
+		for (auto segmentId = GetSegmentPosition(pruneHeight, m_blocksPerSegment).SegmentId; segmentId > 1; --segmentId) {
+			m_pDataFiles->remove(segmentId - 1);
+			if (!boost::filesystem::remove(GetSegmentPath(m_dataDirectory, segmentId - 1, Data_File_Extension)))
+				break;
+		}
+	}
+
+	size_t ConvertToSegmentedStorage(const BlockStorage& source, SegmentedFileStorage& destination) {
+		auto sourceHeight = source.chainHeight();
+		size_t numBlocks = 0;
+		for (auto height = destination.chainHeight() + Height(1); height <= sourceHeight; height = height + Height(1)) {
+			destination.saveBlock(*source.loadBlockElement(height));
+			++numBlocks;
+		}
+
+		CATAPULT_LOG(info) << "converted " << numBlocks << " blocks to segmented storage (chain height " << sourceHeight << ")";
+		return numBlocks;
+	}
+}}
@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "BlockStorage.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// File-based block storage that appends blocks to segment files.
+	/// \note Each segment consists of a data file containing the blocks and an index file containing the offsets and hashes
+	///       of the blocks. Blocks are read from memory-mapped segment data files.
+	class SegmentedFileStorage final : public PrunableBlockStorage {
+	public:
+		/// Default number of blocks stored in a single segment.
+		static constexpr uint32_t Default_Blocks_Per_Segment = 4096;
+
+	public:
+		/// Creates a segmented storage, where blocks will be stored inside \a dataDirectory in segments of \a blocksPerSegment blocks.
+		/// \note \a blocksPerSegment must be the same whenever the same \a dataDirectory is opened.
+		explicit SegmentedFileStorage(const std::string& dataDirectory, uint32_t blocksPerSegment = Default_Blocks_Per_Segment);
+
+		/// Destroys the storage.
+		~SegmentedFileStorage() override;
+
+	public:
+		Height chainHeight() const override;
+
+	public:
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+	public:
+		/// Drops all blocks before \a height.
+		/// \note Only data files of segments that do not contain any block at or after \a height are deleted.
+		///       The segment containing the nemesis block and all hashes are always kept.
+		void pruneBlocksBefore(Height height) override;
+
+	private:
+		std::shared_ptr<const uint8_t> mapBlockRecord(Height height) const;
+
+	private:
+		class SegmentWriter;
+		class MappedFileCache;
+
+		std::string m_dataDirectory;
+		uint32_t m_blocksPerSegment;
+		Height m_chainHeight;
+		std::unique_ptr<SegmentWriter> m_pWriter;
+		std::unique_ptr<MappedFileCache> m_pIndexFiles;
+		std::unique_ptr<MappedFileCache> m_pDataFiles;
+	};
+
+	/// Copies all blocks from \a source that are not yet contained in \a destination into \a destination.
+	/// Returns the number of copied blocks.
+	/// \note This can be used to convert an existing file-based storage into a segmented storage.
+	size_t ConvertToSegmentedStorage(const BlockStorage& source, SegmentedFileStorage& destination);
+}}
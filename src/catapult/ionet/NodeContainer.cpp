@@ -43,31 +43,28 @@ namespace catapult { namespace ionet {
 
 	// region NodeContainerView
 
-	NodeContainerView::NodeContainerView(
-			const NodeDataContainer& nodeDataContainer,
-			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
-			: m_nodeDataContainer(nodeDataContainer)
-			, m_readLock(std::move(readLock))
+	NodeContainerView::NodeContainerView(const std::shared_ptr<const NodeDataContainer>& pNodeDataContainer)
+			: m_pNodeDataContainer(pNodeDataContainer)
 	{}
 
 	size_t NodeContainerView::size() const {
-		return m_nodeDataContainer.size();
+		return m_pNodeDataContainer->size();
 	}
 
 	bool NodeContainerView::contains(const Key& identityKey) const {
-		return m_nodeDataContainer.cend() != m_nodeDataContainer.find(identityKey);
+		return m_pNodeDataContainer->cend() != m_pNodeDataContainer->find(identityKey);
 	}
 
 	const NodeInfo& NodeContainerView::getNodeInfo(const Key& identityKey) const {
-		auto iter = m_nodeDataContainer.find(identityKey);
-		if (m_nodeDataContainer.cend() == iter)
+		auto iter = m_pNodeDataContainer->find(identityKey);
+		if (m_pNodeDataContainer->cend() == iter)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot get node info for unknown node", utils::HexFormat(identityKey));
 
 		return iter->second.Info;
 	}
 
 	void NodeContainerView::forEach(const consumer<const Node&, const NodeInfo&>& consumer) const {
-		for (const auto& pair : m_nodeDataContainer)
+		for (const auto& pair : *m_pNodeDataContainer)
 			consumer(pair.second.Node, pair.second.Info);
 	}
 
@@ -78,13 +75,30 @@ namespace catapult { namespace ionet {
 	NodeContainerModifier::NodeContainerModifier(
 			NodeDataContainer& nodeDataContainer,
 			ServiceRolesMap& serviceRolesMap,
+			utils::VersionedSnapshot<NodeDataContainer>& snapshot,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_nodeDataContainer(nodeDataContainer)
 			, m_serviceRolesMap(serviceRolesMap)
+			, m_pSnapshot(&snapshot)
 			, m_readLock(std::move(readLock))
 			, m_writeLock(m_readLock.promoteToWriter())
 	{}
 
+	NodeContainerModifier::NodeContainerModifier(NodeContainerModifier&& rhs)
+			: m_nodeDataContainer(rhs.m_nodeDataContainer)
+			, m_serviceRolesMap(rhs.m_serviceRolesMap)
+			, m_pSnapshot(rhs.m_pSnapshot)
+			, m_readLock(std::move(rhs.m_readLock))
+			, m_writeLock(std::move(rhs.m_writeLock)) {
+		rhs.m_pSnapshot = nullptr;
+	}
+
+	NodeContainerModifier::~NodeContainerModifier() {
+		// publish while the writer lock is still held so that versions are published in modification order
+		if (m_pSnapshot)
+			m_pSnapshot->publish(std::make_shared<const NodeDataContainer>(m_nodeDataContainer));
+	}
+
 	void NodeContainerModifier::add(const Node& node, NodeSource source) {
 		auto iter = m_nodeDataContainer.find(node.identityKey());
 		if (m_nodeDataContainer.end() == iter) {
@@ -146,8 +160,14 @@ namespace catapult { namespace ionet {
 	// region NodeContainer
 
 	struct NodeContainer::Impl {
+	public:
+		Impl() : Snapshot(std::make_shared<const ionet::NodeDataContainer>())
+		{}
+
+	public:
 		ionet::NodeDataContainer NodeDataContainer;
 		NodeContainerModifier::ServiceRolesMap ServiceRolesMap;
+		utils::VersionedSnapshot<ionet::NodeDataContainer> Snapshot;
 	};
 
 	NodeContainer::NodeContainer() : m_pImpl(std::make_unique<Impl>())
@@ -156,11 +176,11 @@ namespace catapult { namespace ionet {
 	NodeContainer::~NodeContainer() = default;
 
 	NodeContainerView NodeContainer::view() const {
-		return NodeContainerView(m_pImpl->NodeDataContainer, m_lock.acquireReader());
+		return NodeContainerView(m_pImpl->Snapshot.pin());
 	}
 
 	NodeContainerModifier NodeContainer::modifier() {
-		return NodeContainerModifier(m_pImpl->NodeDataContainer, m_pImpl->ServiceRolesMap, m_lock.acquireReader());
+		return NodeContainerModifier(m_pImpl->NodeDataContainer, m_pImpl->ServiceRolesMap, m_pImpl->Snapshot, m_lock.acquireReader());
 	}
 
 	// endregion
@@ -23,6 +23,7 @@
 #include "NodeInfo.h"
 #include "catapult/utils/ArraySet.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
+#include "catapult/utils/VersionedSnapshot.h"
 #include <unordered_map>
 
 namespace catapult { namespace ionet { struct NodeData; } }
@@ -32,11 +33,12 @@ namespace catapult { namespace ionet {
 	/// Internal container wrapped by NodeContainer.
 	using NodeDataContainer = std::unordered_map<Key, NodeData, utils::ArrayHasher<Key>>;
 
-	/// A read only view on top of node container.
+	/// A read only view on top of a (pinned) version of node container.
+	/// \note A view does not block modifiers and does not observe any changes made after it was created.
 	class NodeContainerView : utils::MoveOnly {
 	public:
-		/// Creates a view around \a nodeDataContainer with lock context \a readLock.
-		NodeContainerView(const NodeDataContainer& nodeDataContainer, utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
+		/// Creates a view around \a pNodeDataContainer.
+		explicit NodeContainerView(const std::shared_ptr<const NodeDataContainer>& pNodeDataContainer);
 
 	public:
 		/// Returns the number of nodes.
@@ -52,8 +54,7 @@ namespace catapult { namespace ionet {
 		void forEach(const consumer<const Node&, const NodeInfo&>& consumer) const;
 
 	private:
-		const NodeDataContainer& m_nodeDataContainer;
-		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
+		std::shared_ptr<const NodeDataContainer> m_pNodeDataContainer;
 	};
 
 	/// A write only view on top of node container.
@@ -64,11 +65,19 @@ namespace catapult { namespace ionet {
 
 	public:
 		/// Creates a view around \a nodeDataContainer and \a serviceRolesMap with lock context \a readLock.
+		/// Changes are published to \a snapshot when the view is destroyed.
 		NodeContainerModifier(
 				NodeDataContainer& nodeDataContainer,
 				ServiceRolesMap& serviceRolesMap,
+				utils::VersionedSnapshot<NodeDataContainer>& snapshot,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
+		/// Move constructs a view from \a rhs.
+		NodeContainerModifier(NodeContainerModifier&& rhs);
+
+		/// Destroys the view and publishes a new version of the nodes.
+		~NodeContainerModifier();
+
 	public:
 		/// Adds a \a node to the collection with \a source.
 		/// \note Node sources can be promoted but never demoted.
@@ -89,6 +98,7 @@ namespace catapult { namespace ionet {
 	private:
 		NodeDataContainer& m_nodeDataContainer;
 		ServiceRolesMap& m_serviceRolesMap;
+		utils::VersionedSnapshot<NodeDataContainer>* m_pSnapshot;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 	};
@@ -103,10 +113,11 @@ namespace catapult { namespace ionet {
 		~NodeContainer();
 
 	public:
-		/// Gets a read only view of the nodes.
+		/// Gets a read only view of the most recently published version of the nodes.
 		NodeContainerView view() const;
 
 		/// Gets a write only view of the nodes.
+		/// \note Modifiers are exclusive and each one publishes a new version of the nodes when it is destroyed.
 		NodeContainerModifier modifier();
 
 	private:
@@ -114,7 +125,7 @@ namespace catapult { namespace ionet {
 
 	private:
 		std::unique_ptr<Impl> m_pImpl;
-		mutable utils::SpinReaderWriterLock m_lock;
+		utils::SpinReaderWriterLock m_lock;
 	};
 
 	/// Finds all active nodes in \a view.
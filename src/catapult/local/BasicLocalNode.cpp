@@ -43,7 +43,9 @@ namespace catapult { namespace local {
 					, m_pBlockChainStorage(m_pBootstrapper->extensionManager().createBlockChainStorage())
 					, m_config(m_pBootstrapper->config())
 					, m_catapultCache({}) // note that subcaches are added in boot
-					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage())
+					, m_storage(
+							m_pBootstrapper->subscriptionManager().createBlockStorage(),
+							m_config.Node.BlockStorageCacheMaxSize.bytes())
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(GetUtCacheOptions(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pStateChangeSubscriber(m_pBootstrapper->subscriptionManager().createStateChangeSubscriber())
@@ -116,6 +118,18 @@ namespace catapult { namespace local {
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE FPR"), [&source = *m_pUtCache]() {
+					return static_cast<const cache::MemoryUtCache&>(source).hashFilter().falsePositiveRate();
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C HIT"), [&storage = m_storage]() {
+					return storage.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C MISS"), [&storage = m_storage]() {
+					return storage.statistics().NumMisses;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C EVICTED"), [&storage = m_storage]() {
+					return storage.statistics().NumEvictedBytes;
+				});
 			}
 
 		public:
@@ -26,6 +26,7 @@ namespace catapult { namespace local {
 	cache::MemoryCacheOptions GetUtCacheOptions(const config::NodeConfiguration& config) {
 		return cache::MemoryCacheOptions(
 				config.UnconfirmedTransactionsCacheMaxResponseSize.bytes(),
-				config.UnconfirmedTransactionsCacheMaxSize);
+				config.UnconfirmedTransactionsCacheMaxSize,
+				config.ShouldPrioritizeUnconfirmedTransactionsByFee);
 	}
 }}
@@ -0,0 +1,53 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationBuffer.h"
+#include "catapult/exceptions.h"
+#include <cstddef>
+#include <cstring>
+
+namespace catapult { namespace model {
+
+	namespace {
+		constexpr size_t AlignSize(size_t size) {
+			// align all notifications so that they can be read in place
+			return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+		}
+	}
+
+	size_t NotificationBuffer::size() const {
+		return m_offsets.size();
+	}
+
+	void NotificationBuffer::replay(NotificationSubscriber& sub) const {
+		for (auto offset : m_offsets)
+			sub.notify(reinterpret_cast<const Notification&>(m_buffer[offset]));
+	}
+
+	void NotificationBuffer::notify(const Notification& notification) {
+		if (notification.Size < sizeof(Notification))
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot buffer notification with incorrect size");
+
+		auto offset = m_buffer.size();
+		m_buffer.resize(offset + AlignSize(notification.Size));
+		std::memcpy(&m_buffer[offset], &notification, notification.Size);
+		m_offsets.push_back(offset);
+	}
+}}
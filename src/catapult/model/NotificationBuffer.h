@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationSubscriber.h"
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// A notification subscriber that copies all notifications into a buffer so that they can be replayed later.
+	/// \note Notifications can reference external data, which must outlive the buffer.
+	class NotificationBuffer : public NotificationSubscriber {
+	public:
+		/// Gets the number of buffered notifications.
+		size_t size() const;
+
+	public:
+		/// Forwards all buffered notifications to \a sub in the order they were received.
+		void replay(NotificationSubscriber& sub) const;
+
+	public:
+		void notify(const Notification& notification) override;
+
+	private:
+		std::vector<uint8_t> m_buffer;
+		std::vector<size_t> m_offsets;
+	};
+}}
@@ -34,10 +34,13 @@ namespace catapult { namespace model {
 
 		public:
 			void notify(const Notification& notification) override {
+				// signature notifications are included because they are the only notifications raised for aggregate cosigners
 				if (Core_Register_Account_Address_Notification == notification.Type)
 					m_addresses.insert(static_cast<const AccountAddressNotification&>(notification).Address);
 				else if (Core_Register_Account_Public_Key_Notification == notification.Type)
 					m_addresses.insert(toAddress(static_cast<const AccountPublicKeyNotification&>(notification).PublicKey));
+				else if (Core_Signature_Notification == notification.Type)
+					m_addresses.insert(toAddress(static_cast<const SignatureNotification&>(notification).Signer));
 			}
 
 		public:
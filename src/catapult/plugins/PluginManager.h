@@ -41,6 +41,9 @@ namespace catapult { namespace plugins {
 
 		/// Base directory to use for storing cache database.
 		std::string CacheDatabaseDirectory;
+
+		/// Calculate state roots for all caches that support them.
+		bool ShouldCalculateStateRoots = false;
 	};
 
 	/// A manager for registering plugins.
@@ -90,7 +93,7 @@ namespace catapult { namespace plugins {
 		/// Adds support for a subcache described by \a pSubCache.
 		template<typename TStorageTraits, typename TCache>
 		void addCacheSupport(std::unique_ptr<TCache>&& pSubCache) {
-			m_cacheBuilder.add<TStorageTraits>(std::move(pSubCache));
+			m_cacheBuilder.add<TStorageTraits>(std::move(pSubCache), m_storageConfig.ShouldCalculateStateRoots);
 		}
 
 		/// Creates a catapult cache.
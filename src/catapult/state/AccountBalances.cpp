@@ -28,35 +28,38 @@ namespace catapult { namespace state {
 		}
 	}
 
-	AccountBalances::AccountBalances() = default;
+	std::shared_ptr<CompactMosaicUnorderedMap> AccountBalances::BalancesCopyPolicy::Copy(const CompactMosaicUnorderedMap& balances) {
+		auto pBalancesCopy = std::make_shared<CompactMosaicUnorderedMap>();
+		for (const auto& pair : balances)
+			pBalancesCopy->insert(pair);
 
-	AccountBalances::AccountBalances(const AccountBalances& accountBalances) {
-		*this = accountBalances;
+		return pBalancesCopy;
 	}
 
-	AccountBalances::AccountBalances(AccountBalances&& accountBalances) = default;
+	AccountBalances::AccountBalances() = default;
 
-	AccountBalances& AccountBalances::operator=(const AccountBalances& accountBalances) {
-		for (const auto& pair : accountBalances)
-			m_balances.insert(pair);
+	AccountBalances::AccountBalances(const AccountBalances& accountBalances) = default;
 
-		return *this;
-	}
+	AccountBalances::AccountBalances(AccountBalances&& accountBalances) = default;
+
+	AccountBalances& AccountBalances::operator=(const AccountBalances& accountBalances) = default;
 
 	AccountBalances& AccountBalances::operator=(AccountBalances&& accountBalances) = default;
 
 	Amount AccountBalances::get(MosaicId mosaicId) const {
-		auto iter = m_balances.find(mosaicId);
-		return m_balances.end() == iter ? Amount(0) : iter->second;
+		const auto& balances = m_balances.get();
+		auto iter = balances.find(mosaicId);
+		return balances.end() == iter ? Amount(0) : iter->second;
 	}
 
 	AccountBalances& AccountBalances::credit(MosaicId mosaicId, Amount amount) {
 		if (IsZero(amount))
 			return *this;
 
-		auto iter = m_balances.find(mosaicId);
-		if (m_balances.end() == iter)
-			m_balances.insert(std::make_pair(mosaicId, amount));
+		auto& balances = m_balances.getMutable();
+		auto iter = balances.find(mosaicId);
+		if (balances.end() == iter)
+			balances.insert(std::make_pair(mosaicId, amount));
 		else
 			iter->second = iter->second + amount;
 
@@ -67,18 +70,16 @@ namespace catapult { namespace state {
 		if (IsZero(amount))
 			return *this;
 
-		auto iter = m_balances.find(mosaicId);
-		auto hasZeroBalance = m_balances.end() == iter;
-		if (hasZeroBalance || amount > iter->second) {
-			CATAPULT_THROW_RUNTIME_ERROR_2(
-					"debit amount is greater than current balance",
-					amount,
-					hasZeroBalance ? Amount(0) : iter->second);
-		}
+		// check the balance before making a (possibly shared) copy so that a failed debit does not copy
+		auto currentAmount = get(mosaicId);
+		if (amount > currentAmount)
+			CATAPULT_THROW_RUNTIME_ERROR_2("debit amount is greater than current balance", amount, currentAmount);
 
+		auto& balances = m_balances.getMutable();
+		auto iter = balances.find(mosaicId);
 		iter->second = iter->second - amount;
 		if (IsZero(iter->second))
-			m_balances.erase(mosaicId);
+			balances.erase(mosaicId);
 
 		return *this;
 	}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "CompactMosaicUnorderedMap.h"
+#include "catapult/utils/CopyOnWrite.h"
 #include "catapult/utils/Hashers.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
@@ -33,14 +34,16 @@ namespace catapult { namespace state {
 		/// Creates an empty account balances.
 		AccountBalances();
 
-		/// Copy constructor that makes a deep copy of \a accountBalances.
+		/// Copy constructor that makes a copy of \a accountBalances.
+		/// \note Balances are shared with \a accountBalances until either is modified.
 		AccountBalances(const AccountBalances& accountBalances);
 
 		/// Move constructor that move constructs an account balances from \a accountBalances.
 		AccountBalances(AccountBalances&& accountBalances);
 
 	public:
-		/// Assignment operator that makes a deep copy of \a accountBalances.
+		/// Assignment operator that makes a copy of \a accountBalances.
+		/// \note Balances are shared with \a accountBalances until either is modified.
 		AccountBalances& operator=(const AccountBalances& accountBalances);
 
 		/// Move assignment operator that assigns \a accountBalances.
@@ -49,17 +52,17 @@ namespace catapult { namespace state {
 	public:
 		/// Returns the number of mosaics owned.
 		size_t size() const {
-			return m_balances.size();
+			return m_balances.get().size();
 		}
 
 		/// Returns a const iterator to the first element of the underlying set.
 		auto begin() const {
-			return m_balances.begin();
+			return m_balances.get().begin();
 		}
 
 		/// Returns a const iterator to the element following the last element of the underlying set.
 		auto end() const {
-			return m_balances.end();
+			return m_balances.get().end();
 		}
 
 		/// Returns amount of funds of a given mosaic (\a mosaicId).
@@ -73,6 +76,11 @@ namespace catapult { namespace state {
 		AccountBalances& debit(MosaicId mosaicId, Amount amount);
 
 	private:
-		CompactMosaicUnorderedMap m_balances;
+		struct BalancesCopyPolicy {
+			static std::shared_ptr<CompactMosaicUnorderedMap> Copy(const CompactMosaicUnorderedMap& balances);
+		};
+
+	private:
+		utils::CopyOnWrite<CompactMosaicUnorderedMap, BalancesCopyPolicy> m_balances;
 	};
 }}
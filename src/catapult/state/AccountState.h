@@ -31,6 +31,7 @@ namespace catapult { namespace state {
 		explicit AccountState(const catapult::Address& address, Height addressHeight)
 				: Address(address)
 				, AddressHeight(addressHeight)
+				, PublicKey()
 				, PublicKeyHeight(0)
 		{}
 
@@ -29,12 +29,33 @@
 #include "catapult/cache/AggregateUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/SegmentedFileStorage.h"
+#include <boost/filesystem/path.hpp>
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::PrunableBlockStorage> CreateFileStorage(const config::LocalNodeConfiguration& config) {
+			if (!config.Node.ShouldUseSegmentedBlockStorage)
+				return std::make_unique<io::FileBasedStorage>(config.User.DataDirectory);
+
+			auto segmentsDirectory = boost::filesystem::path(config.User.DataDirectory) / "segments";
+			auto pStorage = std::make_unique<io::SegmentedFileStorage>(segmentsDirectory.generic_string());
+
+			// convert blocks stored in the file-based layout that are missing from the segmented storage
+			// (this also resumes a conversion that was interrupted)
+			io::FileBasedStorage legacyStorage(config.User.DataDirectory);
+			if (pStorage->chainHeight() < legacyStorage.chainHeight())
+				io::ConvertToSegmentedStorage(legacyStorage, *pStorage);
+
+			return pStorage;
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::LocalNodeConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBasedStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
@@ -21,6 +21,8 @@
 #pragma once
 #include "Future.h"
 #include <boost/asio.hpp>
+#include <exception>
+#include <vector>
 
 namespace catapult { namespace thread {
 
@@ -123,4 +125,25 @@ namespace catapult { namespace thread {
 			});
 		});
 	}
+
+	/// Uses \a service to call \a callback for each of \a items in a separate work item and waits for all calls to complete.
+	/// \note Exceptions thrown by \a callback are rethrown (lowest item index first) after all calls have completed.
+	template<typename TItems, typename TWorkCallback>
+	void ParallelForEachAndWait(boost::asio::io_service& service, TItems& items, TWorkCallback callback) {
+		std::vector<std::exception_ptr> exceptions(items.size());
+		ParallelFor(service, items, items.size(), [callback, &exceptions](auto& item, auto index) {
+			try {
+				callback(item, index);
+			} catch (...) {
+				exceptions[index] = std::current_exception();
+			}
+
+			return true;
+		}).get();
+
+		for (const auto& pException : exceptions) {
+			if (pException)
+				std::rethrow_exception(pException);
+		}
+	}
 }}
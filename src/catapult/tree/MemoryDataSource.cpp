@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryDataSource.h"
+#include <unordered_set>
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	size_t MemoryDataSource::size() const {
+		return m_nodes.size();
+	}
+
+	const TreeNode* MemoryDataSource::get(const Hash256& hash) const {
+		auto iter = m_nodes.find(hash);
+		return m_nodes.cend() != iter ? iter->second : nullptr;
+	}
+
+	void MemoryDataSource::set(const TreeNode& node) {
+		if (node.isLeaf())
+			set(node.asLeafNode());
+		else if (node.isBranch())
+			set(node.asBranchNode());
+	}
+
+	void MemoryDataSource::set(const LeafTreeNode& node) {
+		emplace(node);
+	}
+
+	void MemoryDataSource::set(const BranchTreeNode& node) {
+		emplace(node);
+	}
+
+	template<typename TNode>
+	void MemoryDataSource::emplace(const TNode& node) {
+		const auto& hash = node.hash();
+		if (m_nodes.cend() != m_nodes.find(hash))
+			return;
+
+		m_arena.emplace_back(node);
+		m_nodes.emplace(hash, &m_arena.back());
+	}
+
+	size_t MemoryDataSource::prune(const Hash256& rootHash) {
+		// mark all nodes reachable from the root
+		std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> reachableHashes;
+		std::vector<const TreeNode*> pendingNodes;
+		const auto* pRootNode = get(rootHash);
+		if (pRootNode) {
+			reachableHashes.insert(rootHash);
+			pendingNodes.push_back(pRootNode);
+		}
+
+		while (!pendingNodes.empty()) {
+			const auto* pNode = pendingNodes.back();
+			pendingNodes.pop_back();
+			if (!pNode->isBranch())
+				continue;
+
+			const auto& branchNode = pNode->asBranchNode();
+			for (auto i = 0u; i < 16; ++i) {
+				if (!branchNode.hasLink(i) || !reachableHashes.insert(branchNode.link(i)).second)
+					continue;
+
+				const auto* pChildNode = get(branchNode.link(i));
+				if (pChildNode)
+					pendingNodes.push_back(pChildNode);
+			}
+		}
+
+		// sweep all other nodes by moving all reachable nodes into a new arena
+		std::deque<TreeNode> arena;
+		m_nodes.clear();
+		for (auto& node : m_arena) {
+			auto hash = node.hash();
+			if (reachableHashes.cend() == reachableHashes.find(hash))
+				continue;
+
+			arena.push_back(std::move(node));
+			m_nodes.emplace(hash, &arena.back());
+		}
+
+		m_arena = std::move(arena);
+		return m_nodes.size();
+	}
+}}
@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include "catapult/utils/Hashers.h"
+#include <deque>
+#include <unordered_map>
+
+namespace catapult { namespace tree {
+
+	/// An in memory data source for patricia tree nodes.
+	/// \note Nodes are stored contiguously in an arena and are never moved until they are pruned.
+	class MemoryDataSource {
+	public:
+		/// Gets the number of saved nodes.
+		size_t size() const;
+
+		/// Gets the tree node associated with \a hash or \c nullptr if no such node exists.
+		const TreeNode* get(const Hash256& hash) const;
+
+	public:
+		/// Saves a tree \a node.
+		void set(const TreeNode& node);
+
+		/// Saves a leaf tree \a node.
+		void set(const LeafTreeNode& node);
+
+		/// Saves a branch tree \a node.
+		void set(const BranchTreeNode& node);
+
+	public:
+		/// Removes all nodes that are not reachable from the node with \a rootHash.
+		/// Returns the number of remaining nodes.
+		/// \note This invalidates all node pointers previously returned by get.
+		size_t prune(const Hash256& rootHash);
+
+	private:
+		template<typename TNode>
+		void emplace(const TNode& node);
+
+	private:
+		std::deque<TreeNode> m_arena;
+		std::unordered_map<Hash256, const TreeNode*, utils::ArrayHasher<Hash256>> m_nodes;
+	};
+}}
@@ -20,6 +20,8 @@
 
 #pragma once
 #include "TreeNode.h"
+#include <algorithm>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -216,7 +218,7 @@ namespace catapult { namespace tree {
 
 			auto mergedPath = TreeNodePath::Join(branchNode.path(), lastLinkIndex, referencedNode.path());
 			referencedNode.setPath(mergedPath);
-			return std::move(referencedNode);
+			return referencedNode;
 		}
 
 		TreeNode updateBranchLink(BranchTreeNode&& branchNode, size_t linkIndex, const Hash256& link) {
@@ -226,6 +228,282 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region setBatch
+
+	public:
+		/// Sets all key value \a pairs in the tree.
+		/// \note Keys are sorted so that nodes along shared paths are only updated and hashed once.
+		/// \note When a key is present multiple times, its last value is used.
+		void setBatch(const std::vector<std::pair<KeyType, ValueType>>& pairs) {
+			std::vector<PathValuePair> entries;
+			entries.reserve(pairs.size());
+			for (const auto& pair : pairs)
+				entries.push_back({ TreeNodePath(TEncoder::EncodeKey(pair.first)), TEncoder::EncodeValue(pair.second) });
+
+			// keep the last value of each key
+			std::stable_sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+				return IsPathLess(lhs.Path, rhs.Path);
+			});
+			auto reverseEnd = std::unique(entries.rbegin(), entries.rend(), [](const auto& lhs, const auto& rhs) {
+				return lhs.Path == rhs.Path;
+			});
+			entries.erase(entries.begin(), reverseEnd.base());
+
+			if (entries.empty())
+				return;
+
+			m_rootNode = setBatch(m_rootNode, entries.cbegin(), entries.cend(), 0);
+			save(m_rootNode);
+		}
+
+	private:
+		struct PathValuePair {
+			TreeNodePath Path;
+			Hash256 Value;
+		};
+
+		using PathValuePairIterator = typename std::vector<PathValuePair>::const_iterator;
+
+	private:
+		TreeNode setBatch(const TreeNode& node, PathValuePairIterator begin, PathValuePairIterator end, size_t offset) {
+			// if the node is empty, just create a new subtree
+			if (node.empty())
+				return createSubtree(begin, end, offset);
+
+			if (node.isLeaf())
+				return mergeLeafNode(node.asLeafNode(), begin, end, offset);
+
+			// find the length of the branch path that is shared by all new pairs
+			const auto& branchNode = node.asBranchNode();
+			const auto& branchPath = branchNode.path();
+			auto differenceIndex = branchPath.size();
+			for (auto iter = begin; end != iter; ++iter)
+				differenceIndex = std::min(differenceIndex, FindFirstDifferenceIndexAt(branchPath, iter->Path, offset));
+
+			// if the branch path is completely shared, update the existing branch links
+			if (branchPath.size() == differenceIndex) {
+				auto updatedBranchNode = BranchTreeNode(branchNode);
+				ForEachNibbleGroup(begin, end, offset + differenceIndex, [this, &updatedBranchNode, offset, differenceIndex](
+						auto groupBegin,
+						auto groupEnd,
+						auto nibble) {
+					TreeNode emptyNode;
+					const auto* pNextNode = updatedBranchNode.hasLink(nibble) ? m_dataSource.get(updatedBranchNode.link(nibble)) : nullptr;
+					auto updatedNextNode = this->setBatch(pNextNode ? *pNextNode : emptyNode, groupBegin, groupEnd, offset + differenceIndex + 1);
+					this->save(updatedNextNode);
+					updatedBranchNode.setLink(updatedNextNode.hash(), nibble);
+				});
+
+				return TreeNode(updatedBranchNode);
+			}
+
+			// otherwise, split the branch at the shared path and connect the truncated original branch to the new branch
+			auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
+			auto truncatedBranchNode = BranchTreeNode(branchNode);
+			auto branchLinkIndex = branchPath.nibbleAt(differenceIndex);
+			truncatedBranchNode.setPath(branchPath.subpath(differenceIndex + 1));
+
+			auto isTruncatedBranchNodeLinked = false;
+			ForEachNibbleGroup(begin, end, offset + differenceIndex, [&, this](auto groupBegin, auto groupEnd, auto nibble) {
+				auto groupOffset = offset + differenceIndex + 1;
+				auto isTruncatedBranchNodeGroup = branchLinkIndex == nibble;
+				auto updatedNextNode = isTruncatedBranchNodeGroup
+						? this->setBatch(TreeNode(truncatedBranchNode), groupBegin, groupEnd, groupOffset)
+						: this->createSubtree(groupBegin, groupEnd, groupOffset);
+				this->save(updatedNextNode);
+				newBranchNode.setLink(updatedNextNode.hash(), nibble);
+				isTruncatedBranchNodeLinked = isTruncatedBranchNodeLinked || isTruncatedBranchNodeGroup;
+			});
+
+			if (!isTruncatedBranchNodeLinked) {
+				save(truncatedBranchNode);
+				newBranchNode.setLink(truncatedBranchNode.hash(), branchLinkIndex);
+			}
+
+			return TreeNode(newBranchNode);
+		}
+
+		TreeNode mergeLeafNode(const LeafTreeNode& leafNode, PathValuePairIterator begin, PathValuePairIterator end, size_t offset) {
+			// the existing leaf is replaced if its path matches any new pair
+			auto leafPath = TreeNodePath::Join(begin->Path.subpath(0, offset), leafNode.path());
+			auto insertIter = std::lower_bound(begin, end, leafPath, [](const auto& pair, const auto& path) {
+				return IsPathLess(pair.Path, path);
+			});
+			if (end != insertIter && leafPath == insertIter->Path)
+				return createSubtree(begin, end, offset);
+
+			// otherwise, it needs to be merged into the new pairs
+			std::vector<PathValuePair> entries(begin, insertIter);
+			entries.push_back({ leafPath, leafNode.value() });
+			entries.insert(entries.end(), insertIter, end);
+			return createSubtree(entries.cbegin(), entries.cend(), offset);
+		}
+
+		TreeNode createSubtree(PathValuePairIterator begin, PathValuePairIterator end, size_t offset) {
+			if (1 == std::distance(begin, end))
+				return TreeNode(LeafTreeNode(begin->Path.subpath(offset), begin->Value));
+
+			// since pairs are sorted, the path shared by all pairs is the path shared by the first and last pairs
+			const auto& firstPath = begin->Path;
+			const auto& lastPath = std::prev(end)->Path;
+			auto differenceIndex = FindFirstDifferenceIndex(firstPath, lastPath) - offset;
+
+			auto branchNode = BranchTreeNode(firstPath.subpath(offset, differenceIndex));
+			ForEachNibbleGroup(begin, end, offset + differenceIndex, [this, &branchNode, offset, differenceIndex](
+					auto groupBegin,
+					auto groupEnd,
+					auto nibble) {
+				auto nextNode = this->createSubtree(groupBegin, groupEnd, offset + differenceIndex + 1);
+				this->save(nextNode);
+				branchNode.setLink(nextNode.hash(), nibble);
+			});
+
+			return TreeNode(branchNode);
+		}
+
+		// endregion
+
+		// region unsetBatch
+
+	public:
+		/// Removes the values associated with all \a keys from the tree.
+		/// \note Keys are sorted so that nodes along shared paths are only updated and hashed once.
+		void unsetBatch(const std::vector<KeyType>& keys) {
+			std::vector<TreeNodePath> keyPaths;
+			keyPaths.reserve(keys.size());
+			for (const auto& key : keys)
+				keyPaths.push_back(TreeNodePath(TEncoder::EncodeKey(key)));
+
+			std::sort(keyPaths.begin(), keyPaths.end(), IsPathLess);
+			keyPaths.erase(std::unique(keyPaths.begin(), keyPaths.end()), keyPaths.end());
+
+			auto isChanged = false;
+			auto updatedRootNode = unsetBatch(m_rootNode, keyPaths.cbegin(), keyPaths.cend(), 0, isChanged);
+			if (!isChanged)
+				return;
+
+			m_rootNode = std::move(updatedRootNode);
+			save(m_rootNode);
+		}
+
+	private:
+		using PathIterator = std::vector<TreeNodePath>::const_iterator;
+
+	private:
+		TreeNode unsetBatch(const TreeNode& node, PathIterator begin, PathIterator end, size_t offset, bool& isChanged) {
+			// if the node is empty, there is nothing to do
+			if (node.empty())
+				return TreeNode();
+
+			// a leaf node is removed if any key path matches it completely
+			const auto& nodePath = node.path();
+			if (node.isLeaf()) {
+				auto hasMatch = std::any_of(begin, end, [&nodePath, offset](const auto& keyPath) {
+					return nodePath.size() + offset == keyPath.size()
+							&& nodePath.size() == FindFirstDifferenceIndexAt(nodePath, keyPath, offset);
+				});
+
+				isChanged = hasMatch;
+				return hasMatch ? TreeNode() : node.copy();
+			}
+
+			// only key paths that completely share the branch path can be removed from the branch
+			// (since key paths are sorted, they are contiguous)
+			auto isSharedKeyPath = [&nodePath, offset](const auto& keyPath) {
+				return nodePath.size() + offset < keyPath.size()
+						&& nodePath.size() == FindFirstDifferenceIndexAt(nodePath, keyPath, offset);
+			};
+			auto sharedBegin = std::find_if(begin, end, isSharedKeyPath);
+			auto sharedEnd = std::find_if_not(sharedBegin, end, isSharedKeyPath);
+
+			auto updatedBranchNode = BranchTreeNode(node.asBranchNode());
+			auto hasChanges = false;
+			auto linkOffset = offset + nodePath.size();
+			ForEachNibbleGroup(sharedBegin, sharedEnd, linkOffset, [&, this](auto groupBegin, auto groupEnd, auto nibble) {
+				const auto* pNextNode = updatedBranchNode.hasLink(nibble) ? m_dataSource.get(updatedBranchNode.link(nibble)) : nullptr;
+				if (!pNextNode)
+					return;
+
+				auto isNextNodeChanged = false;
+				auto updatedNextNode = this->unsetBatch(*pNextNode, groupBegin, groupEnd, linkOffset + 1, isNextNodeChanged);
+				if (!isNextNodeChanged)
+					return;
+
+				hasChanges = true;
+				if (updatedNextNode.empty()) {
+					updatedBranchNode.clearLink(nibble);
+					return;
+				}
+
+				this->save(updatedNextNode);
+				updatedBranchNode.setLink(updatedNextNode.hash(), nibble);
+			});
+
+			if (!hasChanges)
+				return node.copy();
+
+			isChanged = true;
+			if (0 == updatedBranchNode.numLinks())
+				return TreeNode();
+
+			if (1 != updatedBranchNode.numLinks())
+				return TreeNode(updatedBranchNode);
+
+			// merge the branch if it only has a single link (if the tree state is valid, the referenced node must exist)
+			auto lastLinkIndex = updatedBranchNode.highestLinkIndex();
+			auto referencedNode = m_dataSource.get(updatedBranchNode.link(lastLinkIndex))->copy();
+			referencedNode.setPath(TreeNodePath::Join(nodePath, lastLinkIndex, referencedNode.path()));
+			return referencedNode;
+		}
+
+		// endregion
+
+		// region batch utils
+
+	private:
+		static bool IsPathLess(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			if (differenceIndex == lhs.size() || differenceIndex == rhs.size())
+				return lhs.size() < rhs.size();
+
+			return lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+		}
+
+		static const TreeNodePath& GetPath(const PathValuePair& pair) {
+			return pair.Path;
+		}
+
+		static const TreeNodePath& GetPath(const TreeNodePath& path) {
+			return path;
+		}
+
+		// finds the index of the first nibble in \a nodePath that differs from \a keyPath starting at \a offset
+		static size_t FindFirstDifferenceIndexAt(const TreeNodePath& nodePath, const TreeNodePath& keyPath, size_t offset) {
+			size_t index = 0;
+			for (; index < nodePath.size() && index + offset < keyPath.size(); ++index) {
+				if (nodePath.nibbleAt(index) != keyPath.nibbleAt(index + offset))
+					break;
+			}
+
+			return index;
+		}
+
+		// calls \a action for each group of sorted elements in [\a begin, \a end) that share the nibble at \a offset
+		template<typename TIterator, typename TAction>
+		static void ForEachNibbleGroup(TIterator begin, TIterator end, size_t offset, TAction action) {
+			while (end != begin) {
+				auto nibble = GetPath(*begin).nibbleAt(offset);
+				auto groupEnd = std::find_if(begin, end, [nibble, offset](const auto& element) {
+					return nibble != GetPath(element).nibbleAt(offset);
+				});
+
+				action(begin, groupEnd, nibble);
+				begin = groupEnd;
+			}
+		}
+
+		// endregion
+
 		// region lookup
 
 	public:
@@ -0,0 +1,124 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include "catapult/exceptions.h"
+#include "catapult/types.h"
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Insert-only bloom filter of hashes that confines all bits of a hash to a single cache line sized block.
+	/// \note All operations are lock-free; concurrent inserts and lookups are allowed, but clear must be externally synchronized.
+	/// \note Keys are expected to be cryptographic hashes, so their bytes are used directly instead of being rehashed.
+	class BlockedBloomFilter : public NonCopyable {
+	private:
+		static constexpr size_t Words_Per_Block = 8;
+		static constexpr size_t Bits_Per_Block = Words_Per_Block * 64;
+		static constexpr size_t Bit_Index_Width = 9;
+
+	public:
+		/// Number of bits set per inserted hash.
+		static constexpr size_t Num_Hash_Functions = 4;
+
+	public:
+		/// Creates an empty filter with \a numBlocks blocks.
+		/// \note \a numBlocks must be a non-zero power of two.
+		explicit BlockedBloomFilter(size_t numBlocks)
+				: m_blockMask(numBlocks - 1)
+				, m_words(numBlocks * Words_Per_Block) {
+			if (0 == numBlocks || 0 != (numBlocks & m_blockMask))
+				CATAPULT_THROW_INVALID_ARGUMENT_1("number of blocks must be a non-zero power of two", numBlocks);
+		}
+
+	public:
+		/// Gets the number of blocks.
+		size_t numBlocks() const {
+			return m_blockMask + 1;
+		}
+
+		/// Gets the number of bits.
+		size_t numBits() const {
+			return numBlocks() * Bits_Per_Block;
+		}
+
+	public:
+		/// Inserts \a hash into the filter.
+		void insert(const Hash256& hash) {
+			auto pBlock = block(hash);
+			auto bitSelector = Read64(hash, 8);
+			for (auto i = 0u; i < Num_Hash_Functions; ++i) {
+				auto bitIndex = NextBitIndex(bitSelector);
+				pBlock[bitIndex / 64].fetch_or(Bit(bitIndex), std::memory_order_relaxed);
+			}
+		}
+
+		/// Returns \c false if \a hash was definitely never inserted into the filter, \c true otherwise.
+		bool mayContain(const Hash256& hash) const {
+			auto pBlock = block(hash);
+			auto bitSelector = Read64(hash, 8);
+			for (auto i = 0u; i < Num_Hash_Functions; ++i) {
+				auto bitIndex = NextBitIndex(bitSelector);
+				if (0 == (pBlock[bitIndex / 64].load(std::memory_order_relaxed) & Bit(bitIndex)))
+					return false;
+			}
+
+			return true;
+		}
+
+		/// Removes all hashes from the filter.
+		void clear() {
+			for (auto& word : m_words)
+				word.store(0, std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<uint64_t>* block(const Hash256& hash) {
+			return &m_words[(Read64(hash, 0) & m_blockMask) * Words_Per_Block];
+		}
+
+		const std::atomic<uint64_t>* block(const Hash256& hash) const {
+			return &m_words[(Read64(hash, 0) & m_blockMask) * Words_Per_Block];
+		}
+
+		static uint64_t Read64(const Hash256& hash, size_t offset) {
+			uint64_t value;
+			std::memcpy(&value, &hash[offset], sizeof(uint64_t));
+			return value;
+		}
+
+		static size_t NextBitIndex(uint64_t& bitSelector) {
+			auto bitIndex = static_cast<size_t>(bitSelector & (Bits_Per_Block - 1));
+			bitSelector >>= Bit_Index_Width;
+			return bitIndex;
+		}
+
+		static uint64_t Bit(size_t bitIndex) {
+			return static_cast<uint64_t>(1) << (bitIndex % 64);
+		}
+
+	private:
+		size_t m_blockMask;
+		std::vector<std::atomic<uint64_t>> m_words;
+	};
+}}
@@ -0,0 +1,124 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include "catapult/exceptions.h"
+#include <atomic>
+#include <memory>
+
+namespace catapult { namespace utils {
+
+	/// Bounded lock-free multi-producer multi-consumer queue.
+	/// \note Each slot is tagged with a sequence number that indicates whether it can be written or read in the current lap,
+	///       so producers and consumers only contend on their respective (atomic) positions.
+	template<typename T>
+	class BoundedMpmcQueue : public NonCopyable {
+	private:
+		struct Slot {
+			std::atomic<size_t> Sequence;
+			T Value;
+		};
+
+	public:
+		/// Creates a queue with \a capacity slots.
+		/// \note \a capacity must be a power of two and at least two because sequence numbers of consecutive laps
+		///       could not be distinguished otherwise.
+		explicit BoundedMpmcQueue(size_t capacity)
+				: m_capacity(capacity)
+				, m_pSlots(std::make_unique<Slot[]>(capacity))
+				, m_enqueuePosition(0)
+				, m_dequeuePosition(0) {
+			if (capacity < 2 || 0 != (capacity & (capacity - 1)))
+				CATAPULT_THROW_INVALID_ARGUMENT_1("capacity must be a power of two and at least two", capacity);
+
+			for (auto i = 0u; i < capacity; ++i)
+				m_pSlots[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+	public:
+		/// Gets the capacity of the queue.
+		size_t capacity() const {
+			return m_capacity;
+		}
+
+		/// Returns \c true if the queue is empty.
+		/// \note The result is only a hint when there are concurrent producers or consumers.
+		bool empty() const {
+			return m_enqueuePosition.load(std::memory_order_acquire) == m_dequeuePosition.load(std::memory_order_acquire);
+		}
+
+	public:
+		/// Tries to push \a value into the queue and returns \c false if the queue is full.
+		/// \note \a value is only moved from when \c true is returned.
+		bool tryPush(T&& value) {
+			auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+			for (;;) {
+				auto& slot = m_pSlots[position & (m_capacity - 1)];
+				auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+				if (0 == difference) {
+					if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						slot.Value = std::move(value);
+						slot.Sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				} else if (difference < 0) {
+					// the slot has not been consumed since the previous lap
+					return false;
+				} else {
+					position = m_enqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// Tries to pop the oldest value from the queue into \a value and returns \c false if the queue is empty.
+		bool tryPop(T& value) {
+			auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+			for (;;) {
+				auto& slot = m_pSlots[position & (m_capacity - 1)];
+				auto sequence = slot.Sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+				if (0 == difference) {
+					if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+						value = std::move(slot.Value);
+						slot.Value = T();
+						slot.Sequence.store(position + m_capacity, std::memory_order_release);
+						return true;
+					}
+				} else if (difference < 0) {
+					// the slot has not been produced in the current lap
+					return false;
+				} else {
+					position = m_dequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+	private:
+		// padding prevents producers and consumers from invalidating each other's cache lines
+		static constexpr size_t Cache_Line_Size = 64;
+
+		const size_t m_capacity;
+		std::unique_ptr<Slot[]> m_pSlots;
+		alignas(Cache_Line_Size) std::atomic<size_t> m_enqueuePosition;
+		alignas(Cache_Line_Size) std::atomic<size_t> m_dequeuePosition;
+	};
+}}
@@ -0,0 +1,75 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <memory>
+
+namespace catapult { namespace utils {
+
+	/// Default copy policy that uses the copy constructor.
+	template<typename TValue>
+	struct CopyConstructPolicy {
+		/// Creates a deep copy of \a value.
+		static std::shared_ptr<TValue> Copy(const TValue& value) {
+			return std::make_shared<TValue>(value);
+		}
+	};
+
+	/// A value wrapper that shares the wrapped value between copies until one of them is modified.
+	/// \note Copies are O(1); the first modification of a shared value makes a private deep copy using \a TCopyPolicy.
+	/// \note This class is not thread safe, so all copies of a value that are modified must be owned by the same thread.
+	template<typename TValue, typename TCopyPolicy = CopyConstructPolicy<TValue>>
+	class CopyOnWrite {
+	public:
+		/// Creates a default value.
+		CopyOnWrite() : m_pValue(std::make_shared<TValue>())
+		{}
+
+		/// Copy constructor that shares the value of \a rhs.
+		CopyOnWrite(const CopyOnWrite& rhs) = default;
+
+		/// Assignment operator that shares the value of \a rhs.
+		CopyOnWrite& operator=(const CopyOnWrite& rhs) = default;
+
+		// note: move operations are intentionally not declared so that moved-from instances always have a value
+
+	public:
+		/// Gets a const reference to the value.
+		const TValue& get() const {
+			return *m_pValue;
+		}
+
+		/// Gets a mutable reference to the value, making a private copy first if the value is shared.
+		TValue& getMutable() {
+			if (isShared())
+				m_pValue = TCopyPolicy::Copy(*m_pValue);
+
+			return *m_pValue;
+		}
+
+		/// Returns \c true if the value is shared with at least one other instance.
+		bool isShared() const {
+			return 1 != m_pValue.use_count();
+		}
+
+	private:
+		std::shared_ptr<TValue> m_pValue;
+	};
+}}
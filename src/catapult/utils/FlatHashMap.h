@@ -0,0 +1,593 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "traits/StlTraits.h"
+#include "catapult/preprocessor.h"
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CATAPULT_FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace catapult { namespace utils {
+
+	namespace detail {
+		/// Number of control bytes that are probed together.
+		constexpr size_t Flat_Hash_Map_Group_Width = 16;
+
+		/// Control byte of an empty slot.
+		constexpr int8_t Flat_Hash_Map_Empty = -128;
+
+		/// Control byte of a deleted slot.
+		constexpr int8_t Flat_Hash_Map_Deleted = -2;
+
+		/// A group of control bytes that are probed together.
+		/// \note Control bytes of full slots are non-negative, so empty and deleted slots can be found by their sign bits.
+		class FlatHashMapGroup {
+		public:
+			/// Creates a group around \a pControls.
+			explicit FlatHashMapGroup(const int8_t* pControls)
+#ifdef CATAPULT_FLAT_HASH_MAP_SSE2
+					: m_controls(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pControls)))
+#else
+					: m_pControls(pControls)
+#endif
+			{}
+
+		public:
+			/// Gets a bit mask of all slots with control byte \a control.
+			uint32_t match(int8_t control) const {
+#ifdef CATAPULT_FLAT_HASH_MAP_SSE2
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(control), m_controls)));
+#else
+				uint32_t mask = 0;
+				for (auto i = 0u; i < Flat_Hash_Map_Group_Width; ++i)
+					mask |= static_cast<uint32_t>(control == m_pControls[i]) << i;
+
+				return mask;
+#endif
+			}
+
+			/// Gets a bit mask of all empty slots.
+			uint32_t matchEmpty() const {
+				return match(Flat_Hash_Map_Empty);
+			}
+
+			/// Gets a bit mask of all empty or deleted slots.
+			uint32_t matchEmptyOrDeleted() const {
+#ifdef CATAPULT_FLAT_HASH_MAP_SSE2
+				return static_cast<uint32_t>(_mm_movemask_epi8(m_controls));
+#else
+				uint32_t mask = 0;
+				for (auto i = 0u; i < Flat_Hash_Map_Group_Width; ++i)
+					mask |= static_cast<uint32_t>(m_pControls[i] < 0) << i;
+
+				return mask;
+#endif
+			}
+
+		private:
+#ifdef CATAPULT_FLAT_HASH_MAP_SSE2
+			__m128i m_controls;
+#else
+			const int8_t* m_pControls;
+#endif
+		};
+
+		/// Clears the lowest set bit in \a mask and returns its index.
+		CATAPULT_INLINE size_t PopLowestSetBit(uint32_t& mask) {
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, mask);
+#else
+			auto index = __builtin_ctz(mask);
+#endif
+			mask &= mask - 1;
+			return static_cast<size_t>(index);
+		}
+
+		/// Gets the maximum number of full or deleted slots in a table with \a capacity slots.
+		constexpr size_t GrowthLimit(size_t capacity) {
+			// keep the load factor at or below 7/8 so that every probe sequence ends at an empty slot
+			return capacity - capacity / 8;
+		}
+
+		/// Gets the control byte of a full slot holding an element with \a hash.
+		constexpr int8_t ToControl(size_t hash) {
+			return static_cast<int8_t>(hash & 0x7F);
+		}
+
+		/// Mixes \a hash so that its low bits (probe start) and lowest seven bits (control byte) are well distributed.
+		CATAPULT_INLINE size_t MixHash(size_t rawHash) {
+			// mix the hash because many catapult hashers return raw (and possibly sequential) key bytes
+			auto hash = static_cast<uint64_t>(rawHash);
+			hash ^= hash >> 32;
+			hash *= 0x9E3779B97F4A7C15ull;
+			hash ^= hash >> 29;
+			return static_cast<size_t>(hash);
+		}
+
+		/// Calls \a action with the first slot index of each group in the probe sequence of \a hash in a table with \a capacity slots
+		/// until \a action returns \c true.
+		template<typename TAction>
+		CATAPULT_INLINE void ProbeGroups(size_t capacity, size_t hash, TAction action) {
+			// groups are probed in triangular order, which visits every group because the number of groups is a power of two
+			auto groupMask = capacity / Flat_Hash_Map_Group_Width - 1;
+			auto groupIndex = (hash >> 7) & groupMask;
+			for (auto i = 1u; !action(groupIndex * Flat_Hash_Map_Group_Width); ++i)
+				groupIndex = (groupIndex + i) & groupMask;
+		}
+	}
+
+	/// An open addressing hash map with an interface compatible with std::unordered_map.
+	/// \note Slots are probed in groups of control bytes, each holding seven bits of the hash of the key in the slot
+	///       (swiss table). Elements are owned by slots but allocated separately, so pointers and references to elements
+	///       stay valid until the elements are erased even when the table grows.
+	/// \note Iterators are invalidated by any insert.
+	template<typename TKey, typename TValue, typename THasher = std::hash<TKey>, typename TKeyEquality = std::equal_to<TKey>>
+	class FlatHashMap {
+	public:
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<const TKey, TValue>;
+		using size_type = size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEquality;
+
+	private:
+		using NodePointer = std::unique_ptr<value_type>;
+
+		template<typename TValueType>
+		class BasicIterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = TValueType;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates a default iterator.
+			BasicIterator() : BasicIterator(nullptr, 0)
+			{}
+
+			/// Creates an iterator pointing to the slot at \a index in \a pMap.
+			BasicIterator(const FlatHashMap* pMap, size_t index)
+					: m_pMap(pMap)
+					, m_index(index)
+			{}
+
+			/// Creates a const iterator from a (mutable) iterator (\a rhs).
+			template<
+				typename TOtherValueType,
+				typename X = typename std::enable_if<std::is_convertible<TOtherValueType*, TValueType*>::value>::type>
+			BasicIterator(const BasicIterator<TOtherValueType>& rhs)
+					: m_pMap(rhs.m_pMap)
+					, m_index(rhs.m_index)
+			{}
+
+		public:
+			/// Returns \c true if this iterator is equal to \a rhs.
+			bool operator==(const BasicIterator& rhs) const {
+				return m_pMap == rhs.m_pMap && m_index == rhs.m_index;
+			}
+
+			/// Returns \c true if this iterator is not equal to \a rhs.
+			bool operator!=(const BasicIterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Returns a reference to the current element.
+			reference operator*() const {
+				return *m_pMap->m_slots[m_index];
+			}
+
+			/// Returns a pointer to the current element.
+			pointer operator->() const {
+				return &operator*();
+			}
+
+		public:
+			/// Advances the iterator to the next element.
+			BasicIterator& operator++() {
+				m_index = m_pMap->nextFullIndex(m_index + 1);
+				return *this;
+			}
+
+			/// Advances the iterator to the next element.
+			BasicIterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		private:
+			const FlatHashMap* m_pMap;
+			size_t m_index;
+
+		private:
+			friend class FlatHashMap;
+
+			template<typename TOtherValueType>
+			friend class BasicIterator;
+		};
+
+	public:
+		/// Mutable iterator.
+		using iterator = BasicIterator<value_type>;
+
+		/// Const iterator.
+		using const_iterator = BasicIterator<const value_type>;
+
+	public:
+		/// Creates an empty map.
+		FlatHashMap()
+				: m_size(0)
+				, m_numDeleted(0)
+		{}
+
+		/// Creates a map around the values in \a values.
+		FlatHashMap(std::initializer_list<value_type> values) : FlatHashMap() {
+			reserve(values.size());
+			insert(values.begin(), values.end());
+		}
+
+		/// Copy constructor that makes a deep copy of \a rhs.
+		FlatHashMap(const FlatHashMap& rhs)
+				: m_size(rhs.m_size)
+				, m_numDeleted(rhs.m_numDeleted)
+				, m_controls(rhs.m_controls)
+				, m_slots(rhs.m_slots.size())
+				, m_hasher(rhs.m_hasher)
+				, m_keyEquality(rhs.m_keyEquality) {
+			// copy elements into the same slots because the copy has the same capacity
+			for (auto i = 0u; i < rhs.m_slots.size(); ++i) {
+				if (rhs.m_slots[i])
+					m_slots[i] = std::make_unique<value_type>(*rhs.m_slots[i]);
+			}
+		}
+
+		/// Move constructor that takes ownership of all elements in \a rhs.
+		FlatHashMap(FlatHashMap&& rhs) : FlatHashMap() {
+			swap(rhs);
+		}
+
+	public:
+		/// Assignment operator that makes a deep copy of \a rhs.
+		FlatHashMap& operator=(const FlatHashMap& rhs) {
+			FlatHashMap copy(rhs);
+			swap(copy);
+			return *this;
+		}
+
+		/// Move assignment operator that takes ownership of all elements in \a rhs.
+		FlatHashMap& operator=(FlatHashMap&& rhs) {
+			FlatHashMap moved(std::move(rhs));
+			swap(moved);
+			return *this;
+		}
+
+		/// Swaps the contents of this map with \a rhs.
+		void swap(FlatHashMap& rhs) {
+			std::swap(m_size, rhs.m_size);
+			std::swap(m_numDeleted, rhs.m_numDeleted);
+			m_controls.swap(rhs.m_controls);
+			m_slots.swap(rhs.m_slots);
+			std::swap(m_hasher, rhs.m_hasher);
+			std::swap(m_keyEquality, rhs.m_keyEquality);
+		}
+
+	public:
+		/// Gets a value indicating whether or not the map is empty.
+		bool empty() const {
+			return 0 == m_size;
+		}
+
+		/// Gets the number of elements in the map.
+		size_t size() const {
+			return m_size;
+		}
+
+		/// Gets the number of slots in the map.
+		size_t capacity() const {
+			return m_controls.size();
+		}
+
+	public:
+		/// Returns an iterator to the first element.
+		iterator begin() {
+			return iterator(this, nextFullIndex(0));
+		}
+
+		/// Returns an iterator to the element following the last element.
+		iterator end() {
+			return iterator(this, capacity());
+		}
+
+		/// Returns a const iterator to the first element.
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator end() const {
+			return cend();
+		}
+
+		/// Returns a const iterator to the first element.
+		const_iterator cbegin() const {
+			return const_iterator(this, nextFullIndex(0));
+		}
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator cend() const {
+			return const_iterator(this, capacity());
+		}
+
+	public:
+		/// Searches for \a key in the map.
+		iterator find(const key_type& key) {
+			return iterator(this, findIndex(key, hashKey(key)));
+		}
+
+		/// Searches for \a key in the map.
+		const_iterator find(const key_type& key) const {
+			return const_iterator(this, findIndex(key, hashKey(key)));
+		}
+
+		/// Gets the number of elements with \a key (zero or one).
+		size_t count(const key_type& key) const {
+			return capacity() == findIndex(key, hashKey(key)) ? 0 : 1;
+		}
+
+		/// Gets a reference to the value mapped to \a key, inserting a default value if \a key is not in the map.
+		mapped_type& operator[](const key_type& key) {
+			auto hash = hashKey(key);
+			auto index = findIndex(key, hash);
+			if (capacity() == index)
+				index = insertNew(hash, std::make_unique<value_type>(std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>()));
+
+			return m_slots[index]->second;
+		}
+
+	public:
+		/// Constructs an element from \a args and inserts it into the map if its key is not already in the map.
+		template<typename... TArgs>
+		std::pair<iterator, bool> emplace(TArgs&&... args) {
+			auto pNode = std::make_unique<value_type>(std::forward<TArgs>(args)...);
+			auto hash = hashKey(pNode->first);
+			auto index = findIndex(pNode->first, hash);
+			if (capacity() != index)
+				return std::make_pair(iterator(this, index), false);
+
+			return std::make_pair(iterator(this, insertNew(hash, std::move(pNode))), true);
+		}
+
+		/// Inserts \a value into the map if its key is not already in the map.
+		std::pair<iterator, bool> insert(const value_type& value) {
+			return emplace(value);
+		}
+
+		/// Inserts \a value into the map if its key is not already in the map.
+		std::pair<iterator, bool> insert(value_type&& value) {
+			return emplace(std::move(value));
+		}
+
+		/// Inserts a value constructed from \a pair into the map if its key is not already in the map.
+		template<typename TPair, typename X = typename std::enable_if<std::is_constructible<value_type, TPair&&>::value>::type>
+		std::pair<iterator, bool> insert(TPair&& pair) {
+			return emplace(std::forward<TPair>(pair));
+		}
+
+		/// Inserts \a value into the map if its key is not already in the map.
+		/// \note The hint is ignored and only provided for compatibility with std::unordered_map.
+		iterator insert(const_iterator, const value_type& value) {
+			return insert(value).first;
+		}
+
+		/// Inserts all values in the range [\a first, \a last) into the map.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			for (; first != last; ++first)
+				emplace(*first);
+		}
+
+	public:
+		/// Erases the element at \a position and returns an iterator to the following element.
+		iterator erase(const_iterator position) {
+			eraseAt(position.m_index);
+			return iterator(this, nextFullIndex(position.m_index + 1));
+		}
+
+		/// Erases the element with \a key and returns the number of erased elements (zero or one).
+		size_t erase(const key_type& key) {
+			auto index = findIndex(key, hashKey(key));
+			if (capacity() == index)
+				return 0;
+
+			eraseAt(index);
+			return 1;
+		}
+
+		/// Erases all elements but keeps the allocated slots.
+		void clear() {
+			std::fill(m_controls.begin(), m_controls.end(), detail::Flat_Hash_Map_Empty);
+			for (auto& pNode : m_slots)
+				pNode.reset();
+
+			m_size = 0;
+			m_numDeleted = 0;
+		}
+
+		/// Reserves enough slots for \a count elements.
+		void reserve(size_t count) {
+			auto newCapacity = capacity();
+			if (0 == newCapacity)
+				newCapacity = detail::Flat_Hash_Map_Group_Width;
+
+			while (count > detail::GrowthLimit(newCapacity))
+				newCapacity *= 2;
+
+			if (newCapacity != capacity())
+				rehash(newCapacity);
+		}
+
+	private:
+		CATAPULT_INLINE size_t hashKey(const key_type& key) const {
+			return detail::MixHash(m_hasher(key));
+		}
+
+		size_t nextFullIndex(size_t index) const {
+			while (index < capacity() && m_controls[index] < 0)
+				++index;
+
+			return index;
+		}
+
+		template<typename TAction>
+		CATAPULT_INLINE void probe(size_t hash, TAction action) const {
+			detail::ProbeGroups(capacity(), hash, action);
+		}
+
+		size_t findIndex(const key_type& key, size_t hash) const {
+			auto result = capacity();
+			if (0 == result)
+				return result;
+
+			auto control = detail::ToControl(hash);
+			probe(hash, [this, &key, control, &result](auto groupStart) {
+				detail::FlatHashMapGroup group(&m_controls[groupStart]);
+				auto mask = group.match(control);
+				while (0 != mask) {
+					auto index = groupStart + detail::PopLowestSetBit(mask);
+					if (m_keyEquality(m_slots[index]->first, key)) {
+						result = index;
+						return true;
+					}
+				}
+
+				return 0 != group.matchEmpty();
+			});
+
+			return result;
+		}
+
+		size_t findInsertIndex(size_t hash) const {
+			size_t result = 0;
+			probe(hash, [this, &result](auto groupStart) {
+				auto mask = detail::FlatHashMapGroup(&m_controls[groupStart]).matchEmptyOrDeleted();
+				if (0 == mask)
+					return false;
+
+				result = groupStart + detail::PopLowestSetBit(mask);
+				return true;
+			});
+
+			return result;
+		}
+
+		size_t insertNew(size_t hash, NodePointer&& pNode) {
+			if (m_size + m_numDeleted >= detail::GrowthLimit(capacity())) {
+				// only grow when the map is at least half full, otherwise it is cheaper to purge deleted slots
+				if (0 == capacity())
+					rehash(detail::Flat_Hash_Map_Group_Width);
+				else
+					rehash(m_size >= detail::GrowthLimit(capacity()) / 2 ? capacity() * 2 : capacity());
+			}
+
+			auto index = findInsertIndex(hash);
+			if (detail::Flat_Hash_Map_Deleted == m_controls[index])
+				--m_numDeleted;
+
+			m_controls[index] = detail::ToControl(hash);
+			m_slots[index] = std::move(pNode);
+			++m_size;
+			return index;
+		}
+
+		void eraseAt(size_t index) {
+			// a group that has been full since the last rehash never has empty slots again, so when the group of the slot has
+			// an empty slot, no probe sequence continues past it and the slot can be marked empty instead of deleted
+			auto groupStart = index - index % detail::Flat_Hash_Map_Group_Width;
+			if (0 != detail::FlatHashMapGroup(&m_controls[groupStart]).matchEmpty()) {
+				m_controls[index] = detail::Flat_Hash_Map_Empty;
+			} else {
+				m_controls[index] = detail::Flat_Hash_Map_Deleted;
+				++m_numDeleted;
+			}
+
+			m_slots[index].reset();
+			--m_size;
+		}
+
+		void rehash(size_t newCapacity) {
+			std::vector<int8_t> controls(newCapacity, detail::Flat_Hash_Map_Empty);
+			std::vector<NodePointer> slots(newCapacity);
+			m_controls.swap(controls);
+			m_slots.swap(slots);
+			m_numDeleted = 0;
+
+			for (auto& pNode : slots) {
+				if (!pNode)
+					continue;
+
+				auto hash = hashKey(pNode->first);
+				auto index = findInsertIndex(hash);
+				m_controls[index] = detail::ToControl(hash);
+				m_slots[index] = std::move(pNode);
+			}
+		}
+
+	private:
+		size_t m_size;
+		size_t m_numDeleted;
+		std::vector<int8_t> m_controls;
+		std::vector<NodePointer> m_slots;
+		THasher m_hasher;
+		TKeyEquality m_keyEquality;
+	};
+
+	namespace traits {
+		template<typename ...TArgs>
+		struct is_map<FlatHashMap<TArgs...>> : std::true_type
+		{};
+
+		template<typename ...TArgs>
+		struct is_map<const FlatHashMap<TArgs...>> : std::true_type
+		{};
+	}
+}}
@@ -0,0 +1,371 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "FlatHashMap.h"
+
+namespace catapult { namespace utils {
+
+	/// An open addressing hash set with an interface compatible with std::unordered_set.
+	/// \note In contrast to FlatHashMap, elements are stored inline in the slots, so they need to be default constructible
+	///       and small elements only need a single control byte of overhead.
+	/// \note Iterators, pointers and references are invalidated by any insert.
+	template<typename TValue, typename THasher = std::hash<TValue>, typename TValueEquality = std::equal_to<TValue>>
+	class FlatHashSet {
+	public:
+		using key_type = TValue;
+		using value_type = TValue;
+		using size_type = size_t;
+		using hasher = THasher;
+		using key_equal = TValueEquality;
+
+	public:
+		/// Const iterator.
+		class const_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = const TValue;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates a default iterator.
+			const_iterator() : const_iterator(nullptr, 0)
+			{}
+
+			/// Creates an iterator pointing to the slot at \a index in \a pSet.
+			const_iterator(const FlatHashSet* pSet, size_t index)
+					: m_pSet(pSet)
+					, m_index(index)
+			{}
+
+		public:
+			/// Returns \c true if this iterator is equal to \a rhs.
+			bool operator==(const const_iterator& rhs) const {
+				return m_pSet == rhs.m_pSet && m_index == rhs.m_index;
+			}
+
+			/// Returns \c true if this iterator is not equal to \a rhs.
+			bool operator!=(const const_iterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Returns a reference to the current element.
+			reference operator*() const {
+				return m_pSet->m_slots[m_index];
+			}
+
+			/// Returns a pointer to the current element.
+			pointer operator->() const {
+				return &operator*();
+			}
+
+		public:
+			/// Advances the iterator to the next element.
+			const_iterator& operator++() {
+				m_index = m_pSet->nextFullIndex(m_index + 1);
+				return *this;
+			}
+
+			/// Advances the iterator to the next element.
+			const_iterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		private:
+			const FlatHashSet* m_pSet;
+			size_t m_index;
+
+		private:
+			friend class FlatHashSet;
+		};
+
+		/// Iterator (elements are never mutable because they are hashed).
+		using iterator = const_iterator;
+
+	public:
+		/// Creates an empty set.
+		FlatHashSet()
+				: m_size(0)
+				, m_numDeleted(0)
+		{}
+
+		/// Creates a set around the values in \a values.
+		FlatHashSet(std::initializer_list<value_type> values) : FlatHashSet() {
+			reserve(values.size());
+			insert(values.begin(), values.end());
+		}
+
+		/// Copy constructor that makes a copy of \a rhs.
+		FlatHashSet(const FlatHashSet& rhs) = default;
+
+		/// Move constructor that takes ownership of all elements in \a rhs.
+		FlatHashSet(FlatHashSet&& rhs) : FlatHashSet() {
+			swap(rhs);
+		}
+
+	public:
+		/// Assignment operator that makes a copy of \a rhs.
+		FlatHashSet& operator=(const FlatHashSet& rhs) = default;
+
+		/// Move assignment operator that takes ownership of all elements in \a rhs.
+		FlatHashSet& operator=(FlatHashSet&& rhs) {
+			FlatHashSet moved(std::move(rhs));
+			swap(moved);
+			return *this;
+		}
+
+		/// Swaps the contents of this set with \a rhs.
+		void swap(FlatHashSet& rhs) {
+			std::swap(m_size, rhs.m_size);
+			std::swap(m_numDeleted, rhs.m_numDeleted);
+			m_controls.swap(rhs.m_controls);
+			m_slots.swap(rhs.m_slots);
+			std::swap(m_hasher, rhs.m_hasher);
+			std::swap(m_valueEquality, rhs.m_valueEquality);
+		}
+
+	public:
+		/// Gets a value indicating whether or not the set is empty.
+		bool empty() const {
+			return 0 == m_size;
+		}
+
+		/// Gets the number of elements in the set.
+		size_t size() const {
+			return m_size;
+		}
+
+		/// Gets the number of slots in the set.
+		size_t capacity() const {
+			return m_controls.size();
+		}
+
+	public:
+		/// Returns a const iterator to the first element.
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator end() const {
+			return cend();
+		}
+
+		/// Returns a const iterator to the first element.
+		const_iterator cbegin() const {
+			return const_iterator(this, nextFullIndex(0));
+		}
+
+		/// Returns a const iterator to the element following the last element.
+		const_iterator cend() const {
+			return const_iterator(this, capacity());
+		}
+
+	public:
+		/// Searches for \a value in the set.
+		const_iterator find(const value_type& value) const {
+			return const_iterator(this, findIndex(value, hashValue(value)));
+		}
+
+		/// Gets the number of elements equal to \a value (zero or one).
+		size_t count(const value_type& value) const {
+			return capacity() == findIndex(value, hashValue(value)) ? 0 : 1;
+		}
+
+	public:
+		/// Inserts \a value into the set if it is not already in the set.
+		std::pair<iterator, bool> insert(const value_type& value) {
+			auto hash = hashValue(value);
+			auto index = findIndex(value, hash);
+			if (capacity() != index)
+				return std::make_pair(iterator(this, index), false);
+
+			return std::make_pair(iterator(this, insertNew(hash, value)), true);
+		}
+
+		/// Inserts \a value into the set if it is not already in the set.
+		/// \note The hint is ignored and only provided for compatibility with std::unordered_set.
+		iterator insert(const_iterator, const value_type& value) {
+			return insert(value).first;
+		}
+
+		/// Inserts all values in the range [\a first, \a last) into the set.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		/// Constructs an element from \a args and inserts it into the set if it is not already in the set.
+		template<typename... TArgs>
+		std::pair<iterator, bool> emplace(TArgs&&... args) {
+			return insert(value_type(std::forward<TArgs>(args)...));
+		}
+
+	public:
+		/// Erases the element at \a position and returns an iterator to the following element.
+		iterator erase(const_iterator position) {
+			eraseAt(position.m_index);
+			return iterator(this, nextFullIndex(position.m_index + 1));
+		}
+
+		/// Erases the element equal to \a value and returns the number of erased elements (zero or one).
+		size_t erase(const value_type& value) {
+			auto index = findIndex(value, hashValue(value));
+			if (capacity() == index)
+				return 0;
+
+			eraseAt(index);
+			return 1;
+		}
+
+		/// Erases all elements but keeps the allocated slots.
+		void clear() {
+			std::fill(m_controls.begin(), m_controls.end(), detail::Flat_Hash_Map_Empty);
+			m_size = 0;
+			m_numDeleted = 0;
+		}
+
+		/// Reserves enough slots for \a count elements.
+		void reserve(size_t count) {
+			auto newCapacity = capacity();
+			if (0 == newCapacity)
+				newCapacity = detail::Flat_Hash_Map_Group_Width;
+
+			while (count > detail::GrowthLimit(newCapacity))
+				newCapacity *= 2;
+
+			if (newCapacity != capacity())
+				rehash(newCapacity);
+		}
+
+	private:
+		CATAPULT_INLINE size_t hashValue(const value_type& value) const {
+			return detail::MixHash(m_hasher(value));
+		}
+
+		size_t nextFullIndex(size_t index) const {
+			while (index < capacity() && m_controls[index] < 0)
+				++index;
+
+			return index;
+		}
+
+		size_t findIndex(const value_type& value, size_t hash) const {
+			auto result = capacity();
+			if (0 == result)
+				return result;
+
+			auto control = detail::ToControl(hash);
+			detail::ProbeGroups(capacity(), hash, [this, &value, control, &result](auto groupStart) {
+				detail::FlatHashMapGroup group(&m_controls[groupStart]);
+				auto mask = group.match(control);
+				while (0 != mask) {
+					auto index = groupStart + detail::PopLowestSetBit(mask);
+					if (m_valueEquality(m_slots[index], value)) {
+						result = index;
+						return true;
+					}
+				}
+
+				return 0 != group.matchEmpty();
+			});
+
+			return result;
+		}
+
+		size_t findInsertIndex(size_t hash) const {
+			size_t result = 0;
+			detail::ProbeGroups(capacity(), hash, [this, &result](auto groupStart) {
+				auto mask = detail::FlatHashMapGroup(&m_controls[groupStart]).matchEmptyOrDeleted();
+				if (0 == mask)
+					return false;
+
+				result = groupStart + detail::PopLowestSetBit(mask);
+				return true;
+			});
+
+			return result;
+		}
+
+		size_t insertNew(size_t hash, const value_type& value) {
+			if (m_size + m_numDeleted >= detail::GrowthLimit(capacity())) {
+				// only grow when the set is at least half full, otherwise it is cheaper to purge deleted slots
+				if (0 == capacity())
+					rehash(detail::Flat_Hash_Map_Group_Width);
+				else
+					rehash(m_size >= detail::GrowthLimit(capacity()) / 2 ? capacity() * 2 : capacity());
+			}
+
+			auto index = findInsertIndex(hash);
+			if (detail::Flat_Hash_Map_Deleted == m_controls[index])
+				--m_numDeleted;
+
+			m_controls[index] = detail::ToControl(hash);
+			m_slots[index] = value;
+			++m_size;
+			return index;
+		}
+
+		void eraseAt(size_t index) {
+			// see FlatHashMap::eraseAt
+			auto groupStart = index - index % detail::Flat_Hash_Map_Group_Width;
+			if (0 != detail::FlatHashMapGroup(&m_controls[groupStart]).matchEmpty()) {
+				m_controls[index] = detail::Flat_Hash_Map_Empty;
+			} else {
+				m_controls[index] = detail::Flat_Hash_Map_Deleted;
+				++m_numDeleted;
+			}
+
+			--m_size;
+		}
+
+		void rehash(size_t newCapacity) {
+			std::vector<int8_t> controls(newCapacity, detail::Flat_Hash_Map_Empty);
+			std::vector<value_type> slots(newCapacity);
+			m_controls.swap(controls);
+			m_slots.swap(slots);
+			m_numDeleted = 0;
+
+			for (auto i = 0u; i < controls.size(); ++i) {
+				if (controls[i] < 0)
+					continue;
+
+				auto hash = hashValue(slots[i]);
+				auto index = findInsertIndex(hash);
+				m_controls[index] = detail::ToControl(hash);
+				m_slots[index] = std::move(slots[i]);
+			}
+		}
+
+	private:
+		size_t m_size;
+		size_t m_numDeleted;
+		std::vector<int8_t> m_controls;
+		std::vector<value_type> m_slots;
+		THasher m_hasher;
+		TValueEquality m_valueEquality;
+	};
+}}
@@ -30,20 +30,21 @@ namespace catapult { namespace utils {
 	/// Custom reader writer lock implemented by using an atomic that allows multiple readers and a single writer
 	/// and prefers writers.
 	/// \note
-	/// - 128 max writers
-	/// - 256 max readers
+	/// - 2^31 max writers
+	/// - 2^32 max readers
 	/// - writer lock must be acquired via a reader lock promotion
 	template<typename TReaderNotificationPolicy>
 	class BasicSpinReaderWriterLock : private TReaderNotificationPolicy {
 	private:
-		// 0[active writer]|1234567[total writers]|01234567[total readers]
-		static constexpr uint16_t Active_Writer_Flag = 0x8000;
-		static constexpr uint16_t Pending_Writer_Mask = 0x7F00;
-		static constexpr uint16_t Reader_Mask = 0x00FF;
-		static constexpr uint16_t Writer_Mask = Pending_Writer_Mask | Active_Writer_Flag;
+		// 0[active writer]|1..31[total writers]|0..31[total readers]
+		// (the reader field is wide enough that it cannot overflow in practice, so the number of readers is effectively unbounded)
+		static constexpr uint64_t Active_Writer_Flag = 0x8000'0000'0000'0000;
+		static constexpr uint64_t Pending_Writer_Mask = 0x7FFF'FFFF'0000'0000;
+		static constexpr uint64_t Reader_Mask = 0x0000'0000'FFFF'FFFF;
+		static constexpr uint64_t Writer_Mask = Pending_Writer_Mask | Active_Writer_Flag;
 
-		static constexpr uint16_t Active_Reader_Increment = 0x0001;
-		static constexpr uint16_t Pending_Writer_Increment = 0x0100;
+		static constexpr uint64_t Active_Reader_Increment = 0x0000'0000'0000'0001;
+		static constexpr uint64_t Pending_Writer_Increment = 0x0000'0001'0000'0000;
 
 	private:
 #pragma push_macro("Yield")
@@ -84,7 +85,7 @@ namespace catapult { namespace utils {
 		struct WriterLockGuard : public LockGuard {
 		public:
 			/// Creates a guard around \a value and \a isActive.
-			explicit WriterLockGuard(std::atomic<uint16_t>& value, bool& isActive)
+			explicit WriterLockGuard(std::atomic<uint64_t>& value, bool& isActive)
 					: LockGuard([&value, &isActive]() {
 						// unset the active writer flag and change the writer to a reader
 						value.fetch_sub(Active_Writer_Flag + Pending_Writer_Increment - Active_Reader_Increment);
@@ -100,7 +101,7 @@ namespace catapult { namespace utils {
 		struct ReaderLockGuard : public LockGuard {
 		public:
 			/// Creates a guard around \a value and \a notificationPolicy.
-			explicit ReaderLockGuard(std::atomic<uint16_t>& value, TReaderNotificationPolicy& notificationPolicy)
+			explicit ReaderLockGuard(std::atomic<uint64_t>& value, TReaderNotificationPolicy& notificationPolicy)
 					: LockGuard([&value, &notificationPolicy]() {
 						// decrease the number of readers by one
 						value.fetch_sub(Active_Reader_Increment);
@@ -122,7 +123,7 @@ namespace catapult { namespace utils {
 				m_value.fetch_add(Pending_Writer_Increment - Active_Reader_Increment);
 
 				// wait for exclusive access (when there is no active writer and no readers)
-				uint16_t expected = m_value & Pending_Writer_Mask;
+				uint64_t expected = m_value & Pending_Writer_Mask;
 				while (!m_value.compare_exchange_strong(expected, expected | Active_Writer_Flag)) {
 					Yield();
 					expected = m_value & Pending_Writer_Mask;
@@ -140,7 +141,7 @@ namespace catapult { namespace utils {
 			}
 
 		private:
-			std::atomic<uint16_t>& m_value;
+			std::atomic<uint64_t>& m_value;
 			bool m_isWriterActive;
 		};
 
@@ -153,7 +154,7 @@ namespace catapult { namespace utils {
 		/// Blocks until a reader lock can be acquired.
 		CATAPULT_INLINE
 		ReaderLockGuard acquireReader() {
-			uint16_t current = m_value;
+			uint64_t current = m_value;
 			for (;;) {
 				// wait for any pending writes to complete
 				if (0 != (current & Pending_Writer_Mask)) {
@@ -163,7 +164,7 @@ namespace catapult { namespace utils {
 				}
 
 				// try to increment the number of readers by one
-				uint16_t desired = current + Active_Reader_Increment;
+				uint64_t desired = current + Active_Reader_Increment;
 				if (m_value.compare_exchange_strong(current, desired))
 					break;
 
@@ -194,12 +195,12 @@ namespace catapult { namespace utils {
 
 	private:
 		CATAPULT_INLINE
-		bool isSet(uint16_t mask) const {
+		bool isSet(uint64_t mask) const {
 			return 0 != (m_value & mask);
 		}
 
 	private:
-		std::atomic<uint16_t> m_value;
+		std::atomic<uint64_t> m_value;
 	};
 
 	/// A no-op reader notification policy.
@@ -0,0 +1,221 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "NonCopyable.h"
+#include "catapult/types.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Hierarchical timing wheel that indexes keys by deadline.
+	/// \note Each level splits a slot of the next higher level into smaller slots, down to a resolution of one millisecond,
+	///       so advancing the wheel only touches slots with expiring keys and slots that are cascaded into lower levels.
+	template<typename TKey, typename THasher = std::hash<TKey>>
+	class TimingWheel : public NonCopyable {
+	private:
+		static constexpr size_t Num_Levels = 4;
+		static constexpr size_t Slot_Bits = 8;
+		static constexpr size_t Num_Slots = 1u << Slot_Bits;
+		static constexpr uint64_t Slot_Mask = Num_Slots - 1;
+		static constexpr size_t Overflow_Shift = Slot_Bits * Num_Levels;
+
+		using Bucket = std::unordered_map<TKey, Timestamp, THasher>;
+		using Level = std::array<Bucket, Num_Slots>;
+		using ExpiredKeys = std::vector<std::pair<Timestamp, TKey>>;
+
+	public:
+		/// Creates an empty wheel.
+		TimingWheel()
+				: m_currentTime(0)
+				, m_size(0)
+				, m_levelSizes()
+				, m_pLevels(std::make_unique<std::array<Level, Num_Levels>>())
+		{}
+
+	public:
+		/// Gets the number of keys in the wheel.
+		size_t size() const {
+			return m_size;
+		}
+
+	public:
+		/// Adds \a key with \a deadline to the wheel.
+		/// \note A key with a deadline that has already passed expires in the next call to advance.
+		void add(const TKey& key, Timestamp deadline) {
+			if (place(key, deadline))
+				++m_size;
+		}
+
+		/// Removes \a key with \a deadline from the wheel.
+		/// \note \a deadline must match the deadline passed to add.
+		bool remove(const TKey& key, Timestamp deadline) {
+			auto location = locate(deadline);
+			if (0 == location.first->erase(key))
+				return false;
+
+			if (location.second < Num_Levels)
+				--m_levelSizes[location.second];
+
+			--m_size;
+			return true;
+		}
+
+		/// Advances the wheel to \a time and removes all keys with deadlines at or before \a time.
+		/// \note The removed keys are returned ordered by deadline (and key).
+		std::vector<TKey> advance(Timestamp time) {
+			ExpiredKeys expiredKeys;
+			auto targetTime = time.unwrap();
+			while (m_currentTime < targetTime) {
+				auto level = findLowestNonEmptyLevel();
+				if (Num_Levels == level) {
+					// nothing is due before the overflow keys, so jump directly to the target time
+					auto previousTime = m_currentTime;
+					m_currentTime = targetTime;
+					if (previousTime >> Overflow_Shift != m_currentTime >> Overflow_Shift)
+						redistribute(m_overflow);
+
+					break;
+				}
+
+				// no keys are due before the start of the next nonempty slot of the lowest nonempty level
+				auto nextEventTime = findNextSlotStartTime(level);
+				if (nextEventTime > targetTime) {
+					m_currentTime = targetTime;
+					break;
+				}
+
+				m_currentTime = nextEventTime - 1;
+				tick(expiredKeys);
+			}
+
+			// collect all due keys, including the ones that were added with passed deadlines
+			for (auto iter = m_due.begin(); m_due.end() != iter;) {
+				if (iter->second > time) {
+					++iter;
+					continue;
+				}
+
+				expiredKeys.emplace_back(iter->second, iter->first);
+				iter = m_due.erase(iter);
+			}
+
+			m_size -= expiredKeys.size();
+
+			std::sort(expiredKeys.begin(), expiredKeys.end());
+			std::vector<TKey> keys;
+			keys.reserve(expiredKeys.size());
+			for (const auto& pair : expiredKeys)
+				keys.push_back(pair.second);
+
+			return keys;
+		}
+
+	private:
+		size_t findLowestNonEmptyLevel() const {
+			auto level = 0u;
+			while (Num_Levels != level && 0 == m_levelSizes[level])
+				++level;
+
+			return level;
+		}
+
+		uint64_t findNextSlotStartTime(size_t level) const {
+			// all keys in a level are in slots following the slot containing the current time
+			auto slotShift = Slot_Bits * level;
+			auto slot = (m_currentTime >> slotShift) & Slot_Mask;
+			const auto& buckets = (*m_pLevels)[level];
+			while (buckets[++slot].empty())
+			{}
+
+			auto windowShift = slotShift + Slot_Bits;
+			return (m_currentTime >> windowShift << windowShift) | (slot << slotShift);
+		}
+
+		void tick(ExpiredKeys& expiredKeys) {
+			++m_currentTime;
+
+			// cascade keys from all levels with slots starting at the current time, starting with the highest one
+			for (auto level = Num_Levels - 1; level > 0; --level) {
+				auto slotShift = Slot_Bits * level;
+				if (0 != (m_currentTime & ((static_cast<uint64_t>(1) << slotShift) - 1)))
+					continue;
+
+				auto& bucket = (*m_pLevels)[level][(m_currentTime >> slotShift) & Slot_Mask];
+				m_levelSizes[level] -= bucket.size();
+				redistribute(bucket);
+			}
+
+			// all keys in the lowest level slot expire at the current time
+			auto& bucket = (*m_pLevels)[0][m_currentTime & Slot_Mask];
+			m_levelSizes[0] -= bucket.size();
+			for (const auto& pair : bucket)
+				expiredKeys.emplace_back(pair.second, pair.first);
+
+			bucket.clear();
+		}
+
+		void redistribute(Bucket& bucket) {
+			Bucket keys;
+			keys.swap(bucket);
+			for (const auto& pair : keys)
+				place(pair.first, pair.second);
+		}
+
+		bool place(const TKey& key, Timestamp deadline) {
+			auto location = locate(deadline);
+			if (!location.first->emplace(key, deadline).second)
+				return false;
+
+			if (location.second < Num_Levels)
+				++m_levelSizes[location.second];
+
+			return true;
+		}
+
+		std::pair<Bucket*, size_t> locate(Timestamp deadline) {
+			auto rawDeadline = deadline.unwrap();
+			if (rawDeadline <= m_currentTime)
+				return std::make_pair(&m_due, Num_Levels);
+
+			// use the lowest level with a window that contains both the current time and the deadline
+			for (auto level = 0u; level < Num_Levels; ++level) {
+				auto windowShift = Slot_Bits * (level + 1);
+				if (rawDeadline >> windowShift == m_currentTime >> windowShift)
+					return std::make_pair(&(*m_pLevels)[level][(rawDeadline >> (Slot_Bits * level)) & Slot_Mask], level);
+			}
+
+			return std::make_pair(&m_overflow, Num_Levels);
+		}
+
+	private:
+		uint64_t m_currentTime;
+		size_t m_size;
+		std::array<size_t, Num_Levels> m_levelSizes;
+		std::unique_ptr<std::array<Level, Num_Levels>> m_pLevels;
+		Bucket m_due;
+		Bucket m_overflow;
+	};
+}}
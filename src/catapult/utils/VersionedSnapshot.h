@@ -0,0 +1,70 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "NonCopyable.h"
+#include "SpinLock.h"
+#include <memory>
+
+namespace catapult { namespace utils {
+
+	/// Holder of immutable versions of a value that are published by a writer and pinned by any number of readers.
+	/// \note Readers never wait for writers (or other readers) to finish. A version is reclaimed as soon as it has been
+	///       replaced and the last reader pinning it releases it.
+	template<typename T>
+	class VersionedSnapshot : public NonCopyable {
+	public:
+		/// Creates a holder around the initial version \a pValue.
+		explicit VersionedSnapshot(std::shared_ptr<const T>&& pValue)
+				: m_pValue(std::move(pValue))
+				, m_version(0)
+		{}
+
+	public:
+		/// Pins and returns the current version.
+		std::shared_ptr<const T> pin() const {
+			// the lock is only held while the reference count is incremented
+			SpinLockGuard guard(m_lock);
+			return m_pValue;
+		}
+
+		/// Gets the number of versions published after the initial version.
+		uint64_t version() const {
+			return m_version;
+		}
+
+	public:
+		/// Publishes \a pValue as the current version.
+		void publish(std::shared_ptr<const T>&& pValue) {
+			// swap under the lock so that the previous version is (potentially) destroyed outside of it
+			{
+				SpinLockGuard guard(m_lock);
+				m_pValue.swap(pValue);
+				++m_version;
+			}
+		}
+
+	private:
+		std::shared_ptr<const T> m_pValue;
+		std::atomic<uint64_t> m_version;
+		mutable SpinLock m_lock;
+	};
+}}
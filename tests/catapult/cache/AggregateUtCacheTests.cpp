@@ -51,6 +51,10 @@ namespace catapult { namespace cache {
 			std::vector<model::TransactionInfo> removeAll() override {
 				CATAPULT_THROW_RUNTIME_ERROR("removeAll - not supported in mock");
 			}
+
+			model::TransactionInfo evict(const model::TransactionInfo&, const predicate<>&) override {
+				CATAPULT_THROW_RUNTIME_ERROR("evict - not supported in mock");
+			}
 		};
 
 		template<typename TUtCacheModifier>
@@ -240,4 +244,94 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region evict
+
+	namespace {
+		class MockEvictUtCacheModifier : public UnsupportedUtCacheModifier {
+		public:
+			explicit MockEvictUtCacheModifier(std::vector<Hash256>& evictHashes, model::TransactionInfo&& evictedTransactionInfo)
+					: m_evictHashes(evictHashes)
+					, m_evictedTransactionInfo(std::move(evictedTransactionInfo))
+			{}
+
+		public:
+			model::TransactionInfo evict(const model::TransactionInfo& transactionInfo, const predicate<>& canEvict) override {
+				m_evictHashes.push_back(transactionInfo.EntityHash);
+				return canEvict() ? std::move(m_evictedTransactionInfo) : model::TransactionInfo();
+			}
+
+		private:
+			std::vector<Hash256>& m_evictHashes;
+			model::TransactionInfo m_evictedTransactionInfo;
+		};
+	}
+
+	TEST(TEST_CLASS, EvictDelegatesToCacheOnlyWhenNothingIsEvicted) {
+		// Arrange:
+		std::vector<Hash256> evictHashes;
+		auto utInfo = test::CreateRandomTransactionInfo();
+		TestContext<MockEvictUtCacheModifier> context(evictHashes, model::TransactionInfo());
+
+		// Act:
+		auto evictedInfo = context.aggregate().modifier().evict(utInfo, []() { return true; });
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Hash256>({ utInfo.EntityHash }), evictHashes);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(FlushInfo({ 0u, 0u }), context.subscriber().flushInfos()[0]);
+	}
+
+	TEST(TEST_CLASS, EvictDelegatesToCacheAndSubscriberWhenTransactionIsEvicted) {
+		// Arrange:
+		std::vector<Hash256> evictHashes;
+		auto utInfo = test::CreateRandomTransactionInfo();
+		auto evictedUtInfo = test::CreateRandomTransactionInfo();
+		TestContext<MockEvictUtCacheModifier> context(evictHashes, evictedUtInfo.copy());
+
+		// Act:
+		auto evictedInfo = context.aggregate().modifier().evict(utInfo, []() { return true; });
+
+		// Assert:
+		test::AssertEqual(evictedUtInfo, evictedInfo);
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Hash256>({ utInfo.EntityHash }), evictHashes);
+
+		// - check subscriber
+		ASSERT_EQ(1u, context.subscriber().removedInfos().size());
+		test::AssertEqual(evictedUtInfo, context.subscriber().removedInfos()[0]);
+
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(FlushInfo({ 0u, 1u }), context.subscriber().flushInfos()[0]);
+	}
+
+	TEST(TEST_CLASS, EvictForwardsPredicateToCache) {
+		// Arrange:
+		std::vector<Hash256> evictHashes;
+		auto utInfo = test::CreateRandomTransactionInfo();
+		TestContext<MockEvictUtCacheModifier> context(evictHashes, test::CreateRandomTransactionInfo());
+
+		// Act: reject the eviction
+		auto evictedInfo = context.aggregate().modifier().evict(utInfo, []() { return false; });
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+
+		// - check ut cache modifier was called as expected
+		EXPECT_EQ(std::vector<Hash256>({ utInfo.EntityHash }), evictHashes);
+
+		// - check subscriber
+		EXPECT_TRUE(context.subscriber().removedInfos().empty());
+
+		ASSERT_EQ(1u, context.subscriber().flushInfos().size());
+		EXPECT_EQ(FlushInfo({ 0u, 0u }), context.subscriber().flushInfos()[0]);
+	}
+
+	// endregion
 }}
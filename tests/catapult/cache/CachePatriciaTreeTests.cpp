@@ -0,0 +1,264 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CachePatriciaTree.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/io/PodIoUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS CachePatriciaTreeTests
+
+	namespace {
+		struct TestStorageTraits {
+			using StorageType = std::pair<uint64_t, uint64_t>;
+
+			static void Save(const StorageType& element, io::OutputStream& output) {
+				io::Write64(output, element.second);
+			}
+		};
+
+		Hash256 CalculateKeyHash(uint64_t key) {
+			Hash256 keyHash;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&key), sizeof(uint64_t) }, keyHash);
+			return keyHash;
+		}
+
+		Hash256 CalculateValueHash(uint64_t value) {
+			Hash256 valueHash;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&value), sizeof(uint64_t) }, valueHash);
+			return valueHash;
+		}
+
+		void SetAll(CachePatriciaTree& tree, const std::vector<std::pair<uint64_t, uint64_t>>& elements) {
+			for (const auto& element : elements)
+				tree.setElement<TestStorageTraits>(element);
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, TreeIsInitiallyEmpty) {
+		// Act:
+		CachePatriciaTree tree;
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+		EXPECT_EQ(0u, tree.numNodes());
+	}
+
+	TEST(TEST_CLASS, CanCalculateKeyHash) {
+		// Act:
+		auto keyHash = CachePatriciaTree::CalculateKeyHash(static_cast<uint64_t>(0x1234'5678'9ABC'DEF0));
+
+		// Assert:
+		EXPECT_EQ(CalculateKeyHash(0x1234'5678'9ABC'DEF0), keyHash);
+	}
+
+	TEST(TEST_CLASS, CanCalculateValueHash) {
+		// Act:
+		auto valueHash = CachePatriciaTree::CalculateValueHash([](auto& output) {
+			io::Write32(output, 0x9ABC'DEF0);
+			io::Write32(output, 0x1234'5678);
+		});
+
+		// Assert: all written data is hashed
+		EXPECT_EQ(CalculateValueHash(0x1234'5678'9ABC'DEF0), valueHash);
+	}
+
+	// endregion
+
+	// region set / unset
+
+	TEST(TEST_CLASS, SetElementHashesKeyAndSerializedValue) {
+		// Arrange:
+		CachePatriciaTree tree1;
+		CachePatriciaTree tree2;
+
+		// Act:
+		tree1.setElement<TestStorageTraits>(std::make_pair<uint64_t, uint64_t>(123, 987));
+		tree2.set(CalculateKeyHash(123), CalculateValueHash(987));
+
+		// Assert:
+		EXPECT_NE(Hash256(), tree1.root());
+		EXPECT_EQ(tree2.root(), tree1.root());
+	}
+
+	TEST(TEST_CLASS, SetElementChangesRoot) {
+		// Arrange:
+		CachePatriciaTree tree;
+		SetAll(tree, { { 1, 11 }, { 2, 22 } });
+		auto originalRoot = tree.root();
+
+		// Act:
+		tree.setElement<TestStorageTraits>(std::make_pair<uint64_t, uint64_t>(2, 23));
+
+		// Assert:
+		EXPECT_NE(originalRoot, tree.root());
+	}
+
+	TEST(TEST_CLASS, UnsetElementRestoresPreviousRoot) {
+		// Arrange:
+		CachePatriciaTree tree;
+		SetAll(tree, { { 1, 11 }, { 2, 22 } });
+		auto originalRoot = tree.root();
+		tree.setElement<TestStorageTraits>(std::make_pair<uint64_t, uint64_t>(3, 33));
+
+		// Act:
+		tree.unsetElement(static_cast<uint64_t>(3));
+
+		// Assert:
+		EXPECT_EQ(originalRoot, tree.root());
+	}
+
+	TEST(TEST_CLASS, RootIsIndependentOfUpdateOrder) {
+		// Arrange:
+		CachePatriciaTree tree1;
+		CachePatriciaTree tree2;
+
+		// Act:
+		SetAll(tree1, { { 1, 11 }, { 2, 22 }, { 3, 33 }, { 4, 44 } });
+		SetAll(tree2, { { 4, 40 }, { 3, 33 }, { 7, 77 }, { 2, 22 }, { 1, 11 }, { 4, 44 } });
+		tree2.unsetElement(static_cast<uint64_t>(7));
+
+		// Assert:
+		EXPECT_EQ(tree1.root(), tree2.root());
+	}
+
+	TEST(TEST_CLASS, CanCalculateElementHashes) {
+		// Act:
+		auto hashPair = CachePatriciaTree::CalculateElementHashes<TestStorageTraits>(std::make_pair<uint64_t, uint64_t>(123, 987));
+
+		// Assert:
+		EXPECT_EQ(CalculateKeyHash(123), hashPair.first);
+		EXPECT_EQ(CalculateValueHash(987), hashPair.second);
+	}
+
+	// endregion
+
+	// region setBatch / unsetBatch
+
+	TEST(TEST_CLASS, SetBatchProducesSameRootAsSetElement) {
+		// Arrange:
+		CachePatriciaTree tree1;
+		CachePatriciaTree tree2;
+		SetAll(tree1, { { 1, 11 }, { 2, 22 } });
+		SetAll(tree2, { { 1, 11 }, { 2, 22 } });
+
+		// Act:
+		SetAll(tree1, { { 2, 23 }, { 3, 33 }, { 4, 44 } });
+		tree2.setBatch({
+			{ CalculateKeyHash(4), CalculateValueHash(44) },
+			{ CalculateKeyHash(2), CalculateValueHash(23) },
+			{ CalculateKeyHash(3), CalculateValueHash(33) }
+		});
+
+		// Assert:
+		EXPECT_EQ(tree1.root(), tree2.root());
+	}
+
+	TEST(TEST_CLASS, UnsetBatchProducesSameRootAsUnsetElement) {
+		// Arrange:
+		CachePatriciaTree tree1;
+		CachePatriciaTree tree2;
+		SetAll(tree1, { { 1, 11 }, { 2, 22 }, { 3, 33 }, { 4, 44 } });
+		SetAll(tree2, { { 1, 11 }, { 2, 22 }, { 3, 33 }, { 4, 44 } });
+
+		// Act:
+		tree1.unsetElement(static_cast<uint64_t>(2));
+		tree1.unsetElement(static_cast<uint64_t>(4));
+		tree2.unsetBatch({ CalculateKeyHash(4), CalculateKeyHash(2), CalculateKeyHash(7) });
+
+		// Assert:
+		EXPECT_EQ(tree1.root(), tree2.root());
+	}
+
+	// endregion
+
+	// region compact / clear
+
+	namespace {
+		void UpdateRepeatedly(CachePatriciaTree& tree, size_t numElements, size_t numRounds) {
+			for (auto round = 0u; round < numRounds; ++round) {
+				for (auto i = 0u; i < numElements; ++i)
+					tree.setElement<TestStorageTraits>(std::make_pair<uint64_t, uint64_t>(i, round * numElements + i));
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CompactDoesNotPruneSmallTree) {
+		// Arrange:
+		CachePatriciaTree tree;
+		UpdateRepeatedly(tree, 10, 3);
+		auto numNodes = tree.numNodes();
+		auto root = tree.root();
+
+		// Act:
+		tree.compact();
+
+		// Assert:
+		EXPECT_EQ(numNodes, tree.numNodes());
+		EXPECT_EQ(root, tree.root());
+	}
+
+	TEST(TEST_CLASS, CompactPrunesUnreachableNodesWithoutChangingRoot) {
+		// Arrange:
+		CachePatriciaTree tree;
+		UpdateRepeatedly(tree, 100, 20);
+		auto numNodes = tree.numNodes();
+		auto root = tree.root();
+
+		// Act:
+		tree.compact();
+
+		// Assert:
+		EXPECT_GT(numNodes, tree.numNodes());
+		EXPECT_EQ(root, tree.root());
+
+		// - the tree is still usable and matches a tree built from scratch
+		CachePatriciaTree expectedTree;
+		UpdateRepeatedly(expectedTree, 100, 20);
+		tree.unsetElement(static_cast<uint64_t>(50));
+		expectedTree.unsetElement(static_cast<uint64_t>(50));
+		EXPECT_EQ(expectedTree.root(), tree.root());
+	}
+
+	TEST(TEST_CLASS, CanClearTree) {
+		// Arrange:
+		CachePatriciaTree tree;
+		SetAll(tree, { { 1, 11 }, { 2, 22 } });
+
+		// Act:
+		tree.clear();
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+		EXPECT_EQ(0u, tree.numNodes());
+
+		// - the tree is still usable
+		CachePatriciaTree expectedTree;
+		SetAll(tree, { { 3, 33 } });
+		SetAll(expectedTree, { { 3, 33 } });
+		EXPECT_EQ(expectedTree.root(), tree.root());
+	}
+
+	// endregion
+}}
@@ -22,6 +22,8 @@
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateCacheStorage.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
@@ -340,6 +342,159 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region stateRoot
+
+	namespace {
+		constexpr auto Account_State_Cache_Options = AccountStateCacheTypes::Options{
+			model::NetworkIdentifier::Mijin_Test,
+			543,
+			Amount(std::numeric_limits<Amount::ValueType>::max())
+		};
+
+		CatapultCache CreateStateRootCatapultCache(bool enableStateRoot) {
+			CatapultCacheBuilder builder;
+			builder.add<AccountStateCacheStorage>(
+					std::make_unique<AccountStateCache>(CacheConfiguration(), Account_State_Cache_Options),
+					enableStateRoot);
+			builder.add<test::SimpleCacheStorageTraits>(std::make_unique<test::SimpleCacheT<2>>(), enableStateRoot);
+			return builder.build();
+		}
+
+		void AddAccounts(CatapultCache& cache, const std::vector<std::pair<Address, Amount>>& accounts) {
+			auto delta = cache.createDelta();
+			auto& accountStateCacheDelta = delta.sub<AccountStateCache>();
+			for (const auto& pair : accounts)
+				accountStateCacheDelta.addAccount(pair.first, Height(1)).Balances.credit(Xem_Id, pair.second);
+
+			delta.sub<test::SimpleCacheT<2>>().increment();
+			cache.commit(Height(1));
+		}
+	}
+
+	TEST(TEST_CLASS, StateRootIsInitiallyZero) {
+		// Act:
+		auto cache = CreateStateRootCatapultCache(true);
+
+		// Assert:
+		EXPECT_EQ(Hash256(), cache.stateRoot());
+	}
+
+	TEST(TEST_CLASS, StateRootIsZeroWhenNoSubCachesSupportStateRoots) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+		{
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+
+			// Act:
+			cache.commit(Height(1));
+		}
+
+		// Assert:
+		EXPECT_EQ(Hash256(), cache.stateRoot());
+	}
+
+	TEST(TEST_CLASS, StateRootIsZeroWhenStateRootsAreDisabled) {
+		// Arrange:
+		auto cache = CreateStateRootCatapultCache(false);
+
+		// Act:
+		AddAccounts(cache, { { test::GenerateRandomData<Address_Decoded_Size>(), Amount(100) } });
+
+		// Assert:
+		EXPECT_EQ(Hash256(), cache.stateRoot());
+	}
+
+	TEST(TEST_CLASS, CommitUpdatesStateRoot) {
+		// Arrange:
+		auto cache = CreateStateRootCatapultCache(true);
+
+		// Act:
+		AddAccounts(cache, { { test::GenerateRandomData<Address_Decoded_Size>(), Amount(100) } });
+		auto stateRoot1 = cache.stateRoot();
+
+		AddAccounts(cache, { { test::GenerateRandomData<Address_Decoded_Size>(), Amount(200) } });
+		auto stateRoot2 = cache.stateRoot();
+
+		// Assert:
+		EXPECT_NE(Hash256(), stateRoot1);
+		EXPECT_NE(Hash256(), stateRoot2);
+		EXPECT_NE(stateRoot1, stateRoot2);
+	}
+
+	TEST(TEST_CLASS, StateRootIsIndependentOfCommitHistory) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(4);
+		auto cache1 = CreateStateRootCatapultCache(true);
+		auto cache2 = CreateStateRootCatapultCache(true);
+
+		// Act: add all accounts in a single commit to the first cache
+		AddAccounts(cache1, { { addresses[0], Amount(100) }, { addresses[1], Amount(300) }, { addresses[3], Amount(400) } });
+
+		// - add, modify and remove accounts across multiple commits to the second cache
+		AddAccounts(cache2, { { addresses[0], Amount(100) }, { addresses[1], Amount(200) }, { addresses[2], Amount(300) } });
+		AddAccounts(cache2, { { addresses[1], Amount(100) }, { addresses[3], Amount(400) } });
+		{
+			auto delta = cache2.createDelta();
+			auto& accountStateCacheDelta = delta.sub<AccountStateCache>();
+			accountStateCacheDelta.queueRemove(addresses[2], Height(1));
+			accountStateCacheDelta.commitRemovals();
+			cache2.commit(Height(3));
+		}
+
+		// Assert:
+		EXPECT_NE(Hash256(), cache1.stateRoot());
+		EXPECT_EQ(cache1.stateRoot(), cache2.stateRoot());
+	}
+
+	TEST(TEST_CLASS, StateRootIsNotAffectedByUncommittedChanges) {
+		// Arrange:
+		auto cache = CreateStateRootCatapultCache(true);
+		AddAccounts(cache, { { test::GenerateRandomData<Address_Decoded_Size>(), Amount(100) } });
+		auto stateRoot = cache.stateRoot();
+
+		// Act:
+		auto delta = cache.createDelta();
+		delta.sub<AccountStateCache>().addAccount(test::GenerateRandomData<Address_Decoded_Size>(), Height(2));
+
+		// Assert:
+		EXPECT_EQ(stateRoot, cache.stateRoot());
+	}
+
+	TEST(TEST_CLASS, StateRootIsRebuiltAfterSubCacheIsLoadedFromStorage) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		auto cache1 = CreateStateRootCatapultCache(true);
+		AddAccounts(cache1, { { addresses[0], Amount(100) }, { addresses[1], Amount(200) }, { addresses[2], Amount(300) } });
+
+		std::vector<std::vector<uint8_t>> serializedSubCaches;
+		for (const auto& pStorage : const_cast<const CatapultCache&>(cache1).storages()) {
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream("", buffer);
+			pStorage->saveAll(stream);
+			serializedSubCaches.push_back(buffer);
+		}
+
+		// - load all data into a second cache, which bypasses CatapultCache::commit
+		auto i = 0u;
+		auto cache2 = CreateStateRootCatapultCache(true);
+		for (const auto& pStorage : cache2.storages()) {
+			mocks::MockMemoryStream stream("", serializedSubCaches[i++]);
+			pStorage->loadAll(stream, 2);
+		}
+
+		// Act: commit an empty delta
+		{
+			auto delta = cache2.createDelta();
+			cache2.commit(Height(2));
+		}
+
+		// Assert:
+		EXPECT_EQ(cache1.stateRoot(), cache2.stateRoot());
+	}
+
+	// endregion
+
 	// region general cache synchronization tests
 
 	namespace {
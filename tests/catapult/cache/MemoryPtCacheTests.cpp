@@ -607,10 +607,15 @@ namespace catapult { namespace cache {
 		}
 
 		Hash256 HashCosignatures(const std::vector<model::Cosignature>& cosignatures) {
-			Hash256 cosignaturesHash;
-			crypto::Sha3_256(
-					{ reinterpret_cast<const uint8_t*>(cosignatures.data()), cosignatures.size() * sizeof(model::Cosignature) },
-					cosignaturesHash);
+			// cosignatures hash is the xor of the hashes of all cosignatures
+			Hash256 cosignaturesHash{};
+			for (const auto& cosignature : cosignatures) {
+				Hash256 cosignatureHash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&cosignature), sizeof(model::Cosignature) }, cosignatureHash);
+				for (auto i = 0u; i < Hash256_Size; ++i)
+					cosignaturesHash[i] ^= cosignatureHash[i];
+			}
+
 			return cosignaturesHash;
 		}
 	}
@@ -670,8 +675,8 @@ namespace catapult { namespace cache {
 			}
 		}
 
-		// - calculate the expected cosignatures hash (notice that the cosignatures must be sorted)
-		auto expectedCosignaturesHash = HashCosignatures(Sort(cosignatures));
+		// - calculate the expected cosignatures hash (notice that it does not depend on the order of cosignatures)
+		auto expectedCosignaturesHash = HashCosignatures(cosignatures);
 
 		// Act:
 		auto shortHashPairs = cache.view().shortHashPairs();
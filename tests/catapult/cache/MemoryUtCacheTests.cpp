@@ -476,6 +476,43 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region hashFilter
+
+	TEST(TEST_CLASS, HashFilterMayContainAllAddedTransactionInfos) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(10);
+
+		// Act:
+		test::AddAll(cache, transactionInfos);
+
+		// Assert:
+		const auto& hashFilter = cache.hashFilter();
+		for (const auto& transactionInfo : transactionInfos)
+			EXPECT_TRUE(hashFilter.mayContain(transactionInfo.pEntity->Deadline, transactionInfo.EntityHash));
+
+		EXPECT_FALSE(hashFilter.mayContain(transactionInfos[0].pEntity->Deadline, test::GenerateRandomData<Hash256_Size>()));
+	}
+
+	TEST(TEST_CLASS, HashFilterIsNotUpdatedWhenTransactionInfosAreRemoved) {
+		// Arrange:
+		auto pCache = PrepareCache(10);
+		std::vector<std::pair<Timestamp, Hash256>> pairs;
+		pCache->view().forEach([&pairs](const auto& info) {
+			pairs.emplace_back(info.pEntity->Deadline, info.EntityHash);
+			return true;
+		});
+
+		// Act:
+		pCache->modifier().removeAll();
+
+		// Assert: filter can only be used to rule out transactions
+		for (const auto& pair : pairs)
+			EXPECT_TRUE(pCache->hashFilter().mayContain(pair.first, pair.second));
+	}
+
+	// endregion
+
 	// region forEach
 
 	namespace {
@@ -611,6 +648,194 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region snapshot
+
+	namespace {
+		std::vector<Timestamp::ValueType> ExtractRawDeadlines(const MemoryUtCacheSnapshot& snapshot) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			snapshot.forEach([&rawDeadlines](const auto& transactionInfo) {
+				rawDeadlines.push_back(transactionInfo.pEntity->Deadline.unwrap());
+				return true;
+			});
+			return rawDeadlines;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlines(const MemoryUtCache& cache) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEach([&rawDeadlines](const auto& transactionInfo) {
+				rawDeadlines.push_back(transactionInfo.pEntity->Deadline.unwrap());
+				return true;
+			});
+			return rawDeadlines;
+		}
+	}
+
+	TEST(TEST_CLASS, SnapshotIsInitiallyEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act:
+		auto pSnapshot = cache.snapshot();
+
+		// Assert:
+		EXPECT_EQ(0u, pSnapshot->size());
+		EXPECT_EQ(0u, pSnapshot->shortHashes().size());
+		EXPECT_TRUE(ExtractRawDeadlines(*pSnapshot).empty());
+	}
+
+	TEST(TEST_CLASS, SnapshotContainsAllTransactionsInInsertionOrder) {
+		// Arrange:
+		auto pCache = PrepareCache(5);
+
+		// Act:
+		auto pSnapshot = pCache->snapshot();
+
+		// Assert:
+		EXPECT_EQ(5u, pSnapshot->size());
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4, 5 }), ExtractRawDeadlines(*pSnapshot));
+	}
+
+	TEST(TEST_CLASS, SnapshotIsNotAffectedByLaterModifications) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+		auto pSnapshot = cache.snapshot();
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[1].EntityHash);
+			modifier.add(test::CreateTransactionInfoWithDeadline(6));
+		}
+
+		// Assert: the original snapshot is unchanged but a new snapshot reflects all modifications
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4, 5 }), ExtractRawDeadlines(*pSnapshot));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 4, 5, 6 }), ExtractRawDeadlines(*cache.snapshot()));
+	}
+
+	TEST(TEST_CLASS, SnapshotIsOnlyUpdatedWhenModifierIsDestroyed) {
+		// Arrange:
+		auto pCache = PrepareCache(3);
+
+		// Act: notice that taking a snapshot while the modifier holds the cache write lock does not deadlock
+		std::shared_ptr<const MemoryUtCacheSnapshot> pSnapshotDuringModification;
+		{
+			auto modifier = pCache->modifier();
+			modifier.add(test::CreateTransactionInfoWithDeadline(4));
+			pSnapshotDuringModification = pCache->snapshot();
+		}
+
+		auto pSnapshotAfterModification = pCache->snapshot();
+
+		// Assert:
+		EXPECT_EQ(3u, pSnapshotDuringModification->size());
+		EXPECT_EQ(4u, pSnapshotAfterModification->size());
+	}
+
+	TEST(TEST_CLASS, SnapshotIsNotReplacedWhenModifierHasNoChanges) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		test::AddAll(cache, transactionInfos);
+		auto pSnapshot = cache.snapshot();
+
+		// Act: adding a duplicate transaction does not change the cache
+		{
+			auto modifier = cache.modifier();
+			modifier.add(transactionInfos[1]);
+		}
+
+		// Assert:
+		EXPECT_EQ(pSnapshot.get(), cache.snapshot().get());
+	}
+
+	TEST(TEST_CLASS, SnapshotReflectsModificationsAcrossMultipleChunks) {
+		// Arrange: add enough transactions to span multiple chunks
+		MemoryUtCache cache(MemoryCacheOptions(1'000'000, 5'000));
+		auto transactionInfos = test::CreateTransactionInfos(3000);
+		test::AddAll(cache, transactionInfos);
+
+		// Act: remove all transactions in the middle
+		{
+			auto modifier = cache.modifier();
+			for (auto i = 500u; i < 2500; ++i)
+				modifier.remove(transactionInfos[i].EntityHash);
+		}
+
+		auto pSnapshot = cache.snapshot();
+
+		// Assert:
+		EXPECT_EQ(1000u, pSnapshot->size());
+		EXPECT_EQ(ExtractRawDeadlines(cache), ExtractRawDeadlines(*pSnapshot));
+	}
+
+	TEST(TEST_CLASS, SnapshotReflectsRemoveAll) {
+		// Arrange:
+		auto pCache = PrepareCache(5);
+
+		// Act:
+		{
+			auto modifier = pCache->modifier();
+			auto transactionInfos = modifier.removeAll();
+			modifier.add(transactionInfos[3]);
+			modifier.add(transactionInfos[1]);
+		}
+
+		auto pSnapshot = pCache->snapshot();
+
+		// Assert:
+		EXPECT_EQ(2u, pSnapshot->size());
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 4, 2 }), ExtractRawDeadlines(*pSnapshot));
+	}
+
+	TEST(TEST_CLASS, SnapshotForEachCanBeShortCircuited) {
+		// Arrange:
+		auto pCache = PrepareCache(10);
+
+		// Act:
+		auto numConsumed = 0u;
+		pCache->snapshot()->forEach([&numConsumed](const auto&) {
+			return 4 != ++numConsumed;
+		});
+
+		// Assert:
+		EXPECT_EQ(4u, numConsumed);
+	}
+
+	TEST(TEST_CLASS, SnapshotShortHashesAreConsistentWithView) {
+		// Arrange:
+		auto pCache = PrepareCache(10);
+
+		// Act:
+		auto shortHashes = pCache->snapshot()->shortHashes();
+		auto expectedShortHashes = pCache->view().shortHashes();
+
+		// Assert:
+		ASSERT_EQ(expectedShortHashes.size(), shortHashes.size());
+		EXPECT_TRUE(std::equal(expectedShortHashes.cbegin(), expectedShortHashes.cend(), shortHashes.cbegin()));
+	}
+
+	TEST(TEST_CLASS, SnapshotUnknownTransactionsAreConsistentWithView) {
+		// Arrange: known short hashes contain every second transaction
+		auto transactionSize = test::CreateTransactionInfos(1)[0].pEntity->Size;
+		MemoryUtCache cache(MemoryCacheOptions(3 * transactionSize, 1000));
+		test::AddAll(cache, test::CreateTransactionInfos(10));
+
+		utils::ShortHashesSet knownShortHashes;
+		for (const auto& hash : ExtractEverySecondHash(cache))
+			knownShortHashes.insert(utils::ToShortHash(hash));
+
+		// Act:
+		auto transactions = cache.snapshot()->unknownTransactions(knownShortHashes);
+
+		// Assert: max response size is respected
+		AssertDeadlines(transactions, { 2, 4, 6 });
+		EXPECT_EQ(cache.view().unknownTransactions(knownShortHashes), transactions);
+	}
+
+	// endregion
+
 	// region max size
 
 	namespace {
@@ -675,6 +900,233 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prioritizedTransactionInfos
+
+	namespace {
+		constexpr auto Fee_Options = MemoryCacheOptions(1024, 5, true);
+
+		model::TransactionInfo CreateTransactionInfoWithFee(const model::TransactionInfo& transactionInfo, Amount fee) {
+			auto pTransaction = test::CopyEntity(*transactionInfo.pEntity);
+			pTransaction->Fee = fee;
+			return model::TransactionInfo(std::move(pTransaction), transactionInfo.EntityHash);
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithFees(const std::vector<Amount::ValueType>& fees) {
+			// notice that all transactions have the same size and deadlines starting at 1
+			auto transactionInfos = test::CreateTransactionInfos(fees.size());
+			for (auto i = 0u; i < fees.size(); ++i)
+				transactionInfos[i] = CreateTransactionInfoWithFee(transactionInfos[i], Amount(fees[i]));
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> GetPrioritizedDeadlines(const MemoryUtCache& cache, size_t count) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			for (const auto* pTransactionInfo : cache.view().prioritizedTransactionInfos(count))
+				rawDeadlines.push_back(pTransactionInfo->pEntity->Deadline.unwrap());
+
+			return rawDeadlines;
+		}
+	}
+
+	TEST(TEST_CLASS, PrioritizedTransactionInfosReturnsFirstTransactionInfosWhenNotPrioritizingByFee) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		test::AddAll(cache, CreateTransactionInfosWithFees({ 10, 50, 20, 40, 30 }));
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3 }), GetPrioritizedDeadlines(cache, 3));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4, 5 }), GetPrioritizedDeadlines(cache, 10));
+	}
+
+	TEST(TEST_CLASS, PrioritizedTransactionInfosReturnsHighestPayingTransactionInfosWhenPrioritizingByFee) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		test::AddAll(cache, CreateTransactionInfosWithFees({ 10, 50, 20, 40, 30 }));
+
+		// Act + Assert: transaction infos are returned in insertion order
+		EXPECT_EQ(std::vector<Timestamp::ValueType>(), GetPrioritizedDeadlines(cache, 0));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 5 }), GetPrioritizedDeadlines(cache, 3));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 3, 4, 5 }), GetPrioritizedDeadlines(cache, 10));
+	}
+
+	TEST(TEST_CLASS, PrioritizedTransactionInfosRespectsOrderOfTransactionInfosWithSameSigner) {
+		// Arrange: the second and fourth transactions have the same signer
+		MemoryUtCache cache(Fee_Options);
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto transactionInfos = CreateTransactionInfosWithFees({ 30, 0, 10, 0 });
+		transactionInfos[1] = CreateTransactionInfoWithFee(CreateTransactionInfos(signer, 1)[0], Amount(20));
+		transactionInfos[3] = CreateTransactionInfoWithFee(CreateTransactionInfos(signer, 1)[0], Amount(90));
+		test::AddAll(cache, transactionInfos);
+
+		// - the highest paying transaction can only be selected after the preceding transaction with the same signer
+		std::vector<std::vector<size_t>> expectedIndexesForCounts{ { 0 }, { 0, 1 }, { 0, 1, 3 } };
+		for (auto count = 1u; count <= expectedIndexesForCounts.size(); ++count) {
+			// Act:
+			auto transactionInfoPointers = cache.view().prioritizedTransactionInfos(count);
+
+			// Assert:
+			const auto& expectedIndexes = expectedIndexesForCounts[count - 1];
+			ASSERT_EQ(expectedIndexes.size(), transactionInfoPointers.size()) << count;
+			for (auto i = 0u; i < expectedIndexes.size(); ++i)
+				EXPECT_EQ(transactionInfos[expectedIndexes[i]].EntityHash, transactionInfoPointers[i]->EntityHash) << count << " at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, PrioritizedTransactionInfosExcludesRemovedTransactionInfos) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		auto transactionInfos = CreateTransactionInfosWithFees({ 10, 50, 20, 40, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		cache.modifier().remove(transactionInfos[1].EntityHash);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 3, 4, 5 }), GetPrioritizedDeadlines(cache, 3));
+	}
+
+	// endregion
+
+	// region evict
+
+	TEST(TEST_CLASS, EvictHasNoEffectWhenNotPrioritizingByFee) {
+		// Arrange:
+		MemoryUtCache cache(MemoryCacheOptions(1024, 5));
+		test::AddAll(cache, CreateTransactionInfosWithFees({ 10, 50, 20, 40, 30 }));
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfosWithFees({ 100 })[0], []() { return true; });
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+		AssertCacheSize(cache, 5);
+	}
+
+	TEST(TEST_CLASS, EvictHasNoEffectWhenCacheIsNotFull) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		test::AddAll(cache, CreateTransactionInfosWithFees({ 10, 50, 20, 40 }));
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfosWithFees({ 100 })[0], []() { return true; });
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+		AssertCacheSize(cache, 4);
+	}
+
+	TEST(TEST_CLASS, EvictHasNoEffectWhenTransactionInfoDoesNotPayMoreThanLowestPayingTransactionInfo) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		test::AddAll(cache, CreateTransactionInfosWithFees({ 10, 50, 20, 40, 30 }));
+
+		for (auto fee : { 0u, 5u, 10u }) {
+			// Act:
+			auto evictedInfo = cache.modifier().evict(CreateTransactionInfosWithFees({ fee })[0], []() { return true; });
+
+			// Assert:
+			EXPECT_FALSE(!!evictedInfo) << fee;
+			AssertCacheSize(cache, 5);
+		}
+	}
+
+	TEST(TEST_CLASS, EvictHasNoEffectWhenTransactionInfoIsAlreadyCached) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		auto transactionInfos = CreateTransactionInfosWithFees({ 10, 50, 20, 40, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfoWithFee(transactionInfos[0], Amount(100)), []() { return true; });
+
+		// Assert:
+		EXPECT_FALSE(!!evictedInfo);
+		AssertCacheSize(cache, 5);
+	}
+
+	TEST(TEST_CLASS, EvictRemovesLowestPayingTransactionInfoWhenTransactionInfoPaysMore) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		auto transactionInfos = CreateTransactionInfosWithFees({ 20, 50, 10, 40, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfosWithFees({ 11 })[0], []() { return true; });
+
+		// Assert:
+		ASSERT_TRUE(!!evictedInfo);
+		EXPECT_EQ(transactionInfos[2].EntityHash, evictedInfo.EntityHash);
+		AssertCacheSize(cache, 4);
+		test::AssertDeadlines(cache, { 1, 2, 4, 5 });
+	}
+
+	TEST(TEST_CLASS, EvictOnlyRemovesLastTransactionInfoWithSameSigner) {
+		// Arrange: the lowest paying transaction is followed by a higher paying transaction with the same signer
+		MemoryUtCache cache(Fee_Options);
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto transactionInfos = CreateTransactionInfosWithFees({ 30, 0, 40, 0, 50 });
+		transactionInfos[1] = CreateTransactionInfoWithFee(CreateTransactionInfos(signer, 1)[0], Amount(10));
+		transactionInfos[3] = CreateTransactionInfoWithFee(CreateTransactionInfos(signer, 1)[0], Amount(20));
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfosWithFees({ 100 })[0], []() { return true; });
+
+		// Assert: the last transaction with the same signer was evicted
+		ASSERT_TRUE(!!evictedInfo);
+		EXPECT_EQ(transactionInfos[3].EntityHash, evictedInfo.EntityHash);
+		AssertCacheSize(cache, 4);
+		EXPECT_TRUE(cache.view().contains(transactionInfos[1].EntityHash));
+	}
+
+	TEST(TEST_CLASS, EvictChecksPredicateAfterRemovingLowestPayingTransactionInfo) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		auto transactionInfos = CreateTransactionInfosWithFees({ 20, 50, 10, 40, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		std::vector<size_t> predicateCacheSizes;
+		model::TransactionInfo evictedInfo;
+		{
+			auto modifier = cache.modifier();
+			evictedInfo = modifier.evict(CreateTransactionInfosWithFees({ 11 })[0], [&modifier, &predicateCacheSizes]() {
+				predicateCacheSizes.push_back(modifier.size());
+				return true;
+			});
+		}
+
+		// Assert: the predicate was called once the transaction was removed
+		ASSERT_TRUE(!!evictedInfo);
+		EXPECT_EQ(transactionInfos[2].EntityHash, evictedInfo.EntityHash);
+		EXPECT_EQ(std::vector<size_t>({ 4 }), predicateCacheSizes);
+		AssertCacheSize(cache, 4);
+	}
+
+	TEST(TEST_CLASS, EvictRestoresLowestPayingTransactionInfoWhenPredicateRejectsEviction) {
+		// Arrange:
+		MemoryUtCache cache(Fee_Options);
+		auto transactionInfos = CreateTransactionInfosWithFees({ 20, 50, 10, 40, 30 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto numPredicateCalls = 0u;
+		auto evictedInfo = cache.modifier().evict(CreateTransactionInfosWithFees({ 11 })[0], [&numPredicateCalls]() {
+			++numPredicateCalls;
+			return false;
+		});
+
+		// Assert: nothing was evicted and the order of transactions is unchanged
+		EXPECT_FALSE(!!evictedInfo);
+		EXPECT_EQ(1u, numPredicateCalls);
+		AssertCacheSize(cache, 5);
+		test::AssertDeadlines(cache, { 1, 2, 3, 4, 5 });
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 2, 4, 5 }), GetPrioritizedDeadlines(cache, 4));
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
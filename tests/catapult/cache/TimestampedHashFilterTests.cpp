@@ -0,0 +1,247 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/TimestampedHashFilter.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimestampedHashFilterTests
+
+	namespace {
+		constexpr auto Window_Duration = utils::TimeSpan::FromMilliseconds(10);
+
+		auto CreateFilter() {
+			// 3 windows of 10ms
+			return std::make_unique<TimestampedHashFilter>(Window_Duration, 3, 64);
+		}
+
+		Hash256 GenerateRandomHash() {
+			return test::GenerateRandomData<Hash256_Size>();
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateFilter) {
+		// Act:
+		TimestampedHashFilter filter(Window_Duration, 3, 64);
+
+		// Assert:
+		EXPECT_EQ(3u, filter.numWindows());
+		EXPECT_EQ(0u, filter.numDefiniteMisses());
+		EXPECT_EQ(0u, filter.numFalsePositives());
+		EXPECT_EQ(0u, filter.falsePositiveRate());
+	}
+
+	TEST(TEST_CLASS, CannotCreateFilterWithInvalidParameters) {
+		// Act + Assert:
+		EXPECT_THROW(TimestampedHashFilter(utils::TimeSpan(), 3, 64), catapult_invalid_argument);
+		EXPECT_THROW(TimestampedHashFilter(Window_Duration, 0, 64), catapult_invalid_argument);
+		EXPECT_THROW(TimestampedHashFilter(Window_Duration, 3, 0), catapult_invalid_argument);
+		EXPECT_THROW(TimestampedHashFilter(Window_Duration, 3, 63), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region insert / mayContain
+
+	TEST(TEST_CLASS, MayContainReturnsTrueForAllInsertedHashes) {
+		// Arrange:
+		auto pFilter = CreateFilter();
+		std::vector<std::pair<Timestamp, Hash256>> pairs;
+		for (auto i = 0u; i < 30; ++i)
+			pairs.emplace_back(Timestamp(100 + i), GenerateRandomHash());
+
+		// Act:
+		for (const auto& pair : pairs)
+			pFilter->insert(pair.first, pair.second);
+
+		// Assert:
+		for (const auto& pair : pairs)
+			EXPECT_TRUE(pFilter->mayContain(pair.first, pair.second)) << pair.first;
+	}
+
+	TEST(TEST_CLASS, MayContainReturnsFalseForUnknownHashesInActiveWindows) {
+		// Arrange:
+		auto pFilter = CreateFilter();
+		auto hash = GenerateRandomHash();
+		pFilter->insert(Timestamp(100), GenerateRandomHash());
+		pFilter->insert(Timestamp(115), hash);
+
+		// Act + Assert: inserted hash is not found at different timestamps in active windows
+		EXPECT_FALSE(pFilter->mayContain(Timestamp(100), GenerateRandomHash()));
+		EXPECT_FALSE(pFilter->mayContain(Timestamp(105), hash));
+		EXPECT_FALSE(pFilter->mayContain(Timestamp(110), GenerateRandomHash()));
+	}
+
+	TEST(TEST_CLASS, MayContainReturnsTrueForAnyHashInUnusedWindows) {
+		// Arrange:
+		auto pFilter = CreateFilter();
+		pFilter->insert(Timestamp(100), GenerateRandomHash());
+
+		// Act + Assert:
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(110), GenerateRandomHash()));
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(120), GenerateRandomHash()));
+	}
+
+	TEST(TEST_CLASS, InsertIntoNewerWindowRecyclesSlotOfOlderWindow) {
+		// Arrange: windows 10 and 13 share the same slot
+		auto pFilter = CreateFilter();
+		auto oldHash = GenerateRandomHash();
+		auto newHash = GenerateRandomHash();
+		pFilter->insert(Timestamp(100), oldHash);
+
+		// Act:
+		pFilter->insert(Timestamp(130), newHash);
+
+		// Assert: new window rules out unknown hashes
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(130), newHash));
+		EXPECT_FALSE(pFilter->mayContain(Timestamp(130), oldHash));
+		EXPECT_FALSE(pFilter->mayContain(Timestamp(130), GenerateRandomHash()));
+
+		// - old window can no longer rule out any hashes
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(100), oldHash));
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(100), GenerateRandomHash()));
+	}
+
+	TEST(TEST_CLASS, InsertIntoOlderWindowDoesNotRecycleSlotOfNewerWindow) {
+		// Arrange: windows 10 and 13 share the same slot
+		auto pFilter = CreateFilter();
+		auto oldHash = GenerateRandomHash();
+		auto newHash = GenerateRandomHash();
+		pFilter->insert(Timestamp(130), newHash);
+
+		// Act:
+		pFilter->insert(Timestamp(100), oldHash);
+
+		// Assert: new window is unaffected
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(130), newHash));
+		EXPECT_FALSE(pFilter->mayContain(Timestamp(130), GenerateRandomHash()));
+
+		// - old window can not rule out any hashes (but does not report a false negative for oldHash)
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(100), oldHash));
+		EXPECT_TRUE(pFilter->mayContain(Timestamp(100), GenerateRandomHash()));
+	}
+
+	TEST(TEST_CLASS, ConcurrentInsertsAndLookupsDoNotProduceFalseNegatives) {
+		// Arrange:
+		constexpr auto Num_Hashes = 2000u;
+		auto pFilter = CreateFilter();
+		std::vector<std::pair<Timestamp, Hash256>> pairs;
+		for (auto i = 0u; i < Num_Hashes; ++i)
+			pairs.emplace_back(Timestamp(i / 20), GenerateRandomHash());
+
+		// Act: insert hashes with increasing timestamps (recycling slots) while another thread looks up inserted hashes
+		std::atomic<size_t> numInserted(0);
+		std::atomic<size_t> numFalseNegatives(0);
+		boost::thread_group threads;
+		threads.create_thread([&pFilter, &pairs, &numInserted] {
+			for (const auto& pair : pairs) {
+				pFilter->insert(pair.first, pair.second);
+				++numInserted;
+			}
+		});
+		threads.create_thread([&pFilter, &pairs, &numInserted, &numFalseNegatives] {
+			while (numInserted < pairs.size()) {
+				auto index = numInserted.load();
+				for (auto i = index; i > 0 && i + 40 > index; --i) {
+					if (!pFilter->mayContain(pairs[i - 1].first, pairs[i - 1].second))
+						++numFalseNegatives;
+				}
+			}
+		});
+
+		threads.join_all();
+
+		// Assert:
+		EXPECT_EQ(0u, numFalseNegatives);
+	}
+
+	// endregion
+
+	// region contains
+
+	TEST(TEST_CLASS, ContainsShortCircuitsDefiniteMisses) {
+		// Arrange:
+		auto pFilter = CreateFilter();
+		pFilter->insert(Timestamp(100), GenerateRandomHash());
+
+		// Act:
+		auto numExactCalls = 0u;
+		auto result = pFilter->contains(Timestamp(100), GenerateRandomHash(), [&numExactCalls]() {
+			++numExactCalls;
+			return true;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(0u, numExactCalls);
+		EXPECT_EQ(1u, pFilter->numDefiniteMisses());
+		EXPECT_EQ(0u, pFilter->numFalsePositives());
+	}
+
+	TEST(TEST_CLASS, ContainsDefersToExactLookupWhenFilterPasses) {
+		// Arrange:
+		auto pFilter = CreateFilter();
+		auto hash = GenerateRandomHash();
+		pFilter->insert(Timestamp(100), hash);
+
+		for (auto exactResult : { true, false }) {
+			// Act:
+			auto numExactCalls = 0u;
+			auto result = pFilter->contains(Timestamp(100), hash, [&numExactCalls, exactResult]() {
+				++numExactCalls;
+				return exactResult;
+			});
+
+			// Assert:
+			EXPECT_EQ(exactResult, result);
+			EXPECT_EQ(1u, numExactCalls);
+		}
+
+		// - only the failed exact lookup is counted as a false positive
+		EXPECT_EQ(0u, pFilter->numDefiniteMisses());
+		EXPECT_EQ(1u, pFilter->numFalsePositives());
+	}
+
+	TEST(TEST_CLASS, FalsePositiveRateIsCalculatedFromAllLookupsOfUnknownHashes) {
+		// Arrange:
+		auto pFilter = CreateFilter();
+		auto hash = GenerateRandomHash();
+		pFilter->insert(Timestamp(100), hash);
+
+		// Act: one definite miss, three false positives (unused window) and one hit (ignored)
+		auto exactContains = []() { return false; };
+		pFilter->contains(Timestamp(100), GenerateRandomHash(), exactContains);
+		for (auto i = 0u; i < 3; ++i)
+			pFilter->contains(Timestamp(110), GenerateRandomHash(), exactContains);
+
+		pFilter->contains(Timestamp(100), hash, []() { return true; });
+
+		// Assert:
+		EXPECT_EQ(1u, pFilter->numDefiniteMisses());
+		EXPECT_EQ(3u, pFilter->numFalsePositives());
+		EXPECT_EQ(7500u, pFilter->falsePositiveRate());
+	}
+
+	// endregion
+}}
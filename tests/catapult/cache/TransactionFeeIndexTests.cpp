@@ -0,0 +1,266 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/TransactionFeeIndex.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TransactionFeeIndexTests
+
+	namespace {
+		using Entry = TransactionFeeIndex::Entry;
+
+		Entry CreateEntry(size_t id, Amount::ValueType fee, uint32_t size = 100) {
+			return { id, test::GenerateRandomData<Key_Size>(), Amount(fee), size };
+		}
+
+		Entry CreateEntry(size_t id, const Key& signer, Amount::ValueType fee) {
+			return { id, signer, Amount(fee), 100 };
+		}
+
+		void AddAll(TransactionFeeIndex& index, const std::vector<Entry>& entries) {
+			for (const auto& entry : entries)
+				index.add(entry);
+		}
+	}
+
+	// region HasHigherFeePerByte
+
+	TEST(TEST_CLASS, HasHigherFeePerByteComparesFeesOfEqualSizedEntries) {
+		// Act + Assert:
+		EXPECT_TRUE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 200), CreateEntry(2, 100)));
+		EXPECT_FALSE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 100), CreateEntry(2, 200)));
+		EXPECT_FALSE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 100), CreateEntry(2, 100)));
+	}
+
+	TEST(TEST_CLASS, HasHigherFeePerByteAccountsForEntrySizes) {
+		// Act + Assert: 300 / 200 > 100 / 100
+		EXPECT_TRUE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 300, 200), CreateEntry(2, 100, 100)));
+		EXPECT_FALSE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 100, 100), CreateEntry(2, 300, 200)));
+
+		// - 200 / 200 == 100 / 100
+		EXPECT_FALSE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 200, 200), CreateEntry(2, 100, 100)));
+		EXPECT_FALSE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 100, 100), CreateEntry(2, 200, 200)));
+
+		// - 101 / 100 > 201 / 200 (remainders are compared)
+		EXPECT_TRUE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, 101, 100), CreateEntry(2, 201, 200)));
+	}
+
+	TEST(TEST_CLASS, HasHigherFeePerByteDoesNotOverflowForLargeFees) {
+		// Arrange:
+		constexpr auto Max_Fee = std::numeric_limits<Amount::ValueType>::max();
+
+		// Act + Assert:
+		EXPECT_TRUE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, Max_Fee, 3), CreateEntry(2, Max_Fee - 1, 3)));
+		EXPECT_FALSE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, Max_Fee - 1, 3), CreateEntry(2, Max_Fee, 3)));
+		EXPECT_TRUE(TransactionFeeIndex::HasHigherFeePerByte(CreateEntry(1, Max_Fee, 7), CreateEntry(2, Max_Fee, 11)));
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, InitiallyIndexIsEmpty) {
+		// Act:
+		TransactionFeeIndex index;
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_FALSE(!!index.lowest());
+		EXPECT_TRUE(index.select(10).empty());
+	}
+
+	// endregion
+
+	// region add / remove / clear
+
+	TEST(TEST_CLASS, CanAddEntries) {
+		// Arrange:
+		TransactionFeeIndex index;
+
+		// Act:
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 30), CreateEntry(3, 20) });
+
+		// Assert:
+		EXPECT_EQ(3u, index.size());
+		EXPECT_EQ(1u, index.lowest()->Id);
+	}
+
+	TEST(TEST_CLASS, CannotAddEntryWithSameIdTwice) {
+		// Arrange:
+		TransactionFeeIndex index;
+		index.add(CreateEntry(1, 10));
+
+		// Act + Assert:
+		EXPECT_THROW(index.add(CreateEntry(1, 20)), catapult_invalid_argument);
+		EXPECT_EQ(1u, index.size());
+	}
+
+	TEST(TEST_CLASS, CanRemoveEntries) {
+		// Arrange:
+		TransactionFeeIndex index;
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 30), CreateEntry(3, 20) });
+
+		// Act:
+		index.remove(1);
+
+		// Assert:
+		EXPECT_EQ(2u, index.size());
+		EXPECT_EQ(3u, index.lowest()->Id);
+		EXPECT_EQ(std::vector<size_t>({ 2, 3 }), index.select(10));
+	}
+
+	TEST(TEST_CLASS, RemovingUnknownEntryHasNoEffect) {
+		// Arrange:
+		TransactionFeeIndex index;
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 30) });
+
+		// Act:
+		index.remove(7);
+
+		// Assert:
+		EXPECT_EQ(2u, index.size());
+		EXPECT_EQ(std::vector<size_t>({ 1, 2 }), index.select(10));
+	}
+
+	TEST(TEST_CLASS, CanClearEntries) {
+		// Arrange:
+		TransactionFeeIndex index;
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 30) });
+
+		// Act:
+		index.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_FALSE(!!index.lowest());
+		EXPECT_TRUE(index.select(10).empty());
+	}
+
+	// endregion
+
+	// region lowest
+
+	TEST(TEST_CLASS, LowestReturnsNewestEntryWhenFeesAreEqual) {
+		// Arrange:
+		TransactionFeeIndex index;
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 10), CreateEntry(3, 10) });
+
+		// Act + Assert:
+		EXPECT_EQ(3u, index.lowest()->Id);
+	}
+
+	TEST(TEST_CLASS, LowestOnlyReturnsLastEntryOfSigner) {
+		// Arrange: the lowest paying entry is followed by an entry with the same signer
+		TransactionFeeIndex index;
+		auto signer = test::GenerateRandomData<Key_Size>();
+		AddAll(index, { CreateEntry(1, signer, 10), CreateEntry(2, 30), CreateEntry(3, signer, 20) });
+
+		// Act + Assert:
+		EXPECT_EQ(3u, index.lowest()->Id);
+
+		// - removing the last entry of the signer makes the preceding entry eligible
+		index.remove(3);
+		EXPECT_EQ(1u, index.lowest()->Id);
+	}
+
+	// endregion
+
+	// region select
+
+	TEST(TEST_CLASS, SelectReturnsHighestPayingEntriesSortedById) {
+		// Arrange:
+		TransactionFeeIndex index;
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 50), CreateEntry(3, 20), CreateEntry(4, 40), CreateEntry(5, 30) });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<size_t>(), index.select(0));
+		EXPECT_EQ(std::vector<size_t>({ 2 }), index.select(1));
+		EXPECT_EQ(std::vector<size_t>({ 2, 4, 5 }), index.select(3));
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3, 4, 5 }), index.select(5));
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3, 4, 5 }), index.select(10));
+	}
+
+	TEST(TEST_CLASS, SelectPrefersOlderEntriesWhenFeesAreEqual) {
+		// Arrange:
+		TransactionFeeIndex index;
+		AddAll(index, { CreateEntry(1, 10), CreateEntry(2, 20), CreateEntry(3, 10), CreateEntry(4, 20) });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<size_t>({ 2, 4 }), index.select(2));
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 4 }), index.select(3));
+	}
+
+	TEST(TEST_CLASS, SelectNeverSelectsEntryWithoutPrecedingEntriesOfSameSigner) {
+		// Arrange: entry 4 pays the most but depends on entry 2
+		TransactionFeeIndex index;
+		auto signer = test::GenerateRandomData<Key_Size>();
+		AddAll(index, { CreateEntry(1, 30), CreateEntry(2, signer, 10), CreateEntry(3, 20), CreateEntry(4, signer, 90) });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1 }), index.select(1));
+		EXPECT_EQ(std::vector<size_t>({ 1, 3 }), index.select(2));
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3 }), index.select(3));
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3, 4 }), index.select(4));
+	}
+
+	TEST(TEST_CLASS, SelectMergesSuccessorsOfSelectedEntries) {
+		// Arrange: entry 3 becomes eligible after entry 1 is selected
+		TransactionFeeIndex index;
+		auto signer = test::GenerateRandomData<Key_Size>();
+		AddAll(index, { CreateEntry(1, signer, 50), CreateEntry(2, 30), CreateEntry(3, signer, 40), CreateEntry(4, 10) });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<size_t>({ 1, 3 }), index.select(2));
+		EXPECT_EQ(std::vector<size_t>({ 1, 2, 3 }), index.select(3));
+	}
+
+	TEST(TEST_CLASS, SelectIsConsistentWithLinearScanForRandomEntries) {
+		// Arrange: use a few signers so that there are chains of entries
+		TransactionFeeIndex index;
+		std::vector<Key> signers(5);
+		for (auto& signer : signers)
+			signer = test::GenerateRandomData<Key_Size>();
+
+		std::vector<Entry> entries;
+		for (auto i = 1u; i <= 100; ++i)
+			entries.push_back(CreateEntry(i, signers[test::Random() % signers.size()], test::Random() % 1000));
+
+		AddAll(index, entries);
+
+		// Act:
+		auto ids = index.select(30);
+
+		// Assert: each selected entry is preceded by all entries of the same signer
+		ASSERT_EQ(30u, ids.size());
+		EXPECT_TRUE(std::is_sorted(ids.cbegin(), ids.cend()));
+		std::set<size_t> selectedIds(ids.cbegin(), ids.cend());
+		for (auto id : ids) {
+			for (const auto& entry : entries) {
+				if (entry.Id < id && entry.Signer == entries[id - 1].Signer) {
+					EXPECT_TRUE(selectedIds.cend() != selectedIds.find(entry.Id)) << id << " depends on " << entry.Id;
+				}
+			}
+		}
+	}
+
+	// endregion
+}}
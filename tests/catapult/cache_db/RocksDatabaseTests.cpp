@@ -56,6 +56,44 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(RdbDataIterator::End(), iter);
 	}
 
+	namespace {
+		RocksDatabaseSettings CreateTunedSettings() {
+			RocksDatabaseSettings settings("testdb");
+			settings.BlockCacheSize = utils::FileSize::FromMegabytes(4);
+			settings.MaxBackgroundJobs = 2;
+
+			auto columnSettings = RocksColumnSettings("beta");
+			columnSettings.KeySize = 5;
+			columnSettings.BloomFilterBitsPerKey = 10;
+			columnSettings.ShouldEnableCompression = false;
+			columnSettings.WriteBufferSize = utils::FileSize::FromMegabytes(1);
+			settings.Columns.push_back(columnSettings);
+			return settings;
+		}
+	}
+
+	TEST(TEST_CLASS, CanWriteToAndReadFromDbWithCustomSettings) {
+		// Arrange:
+		test::DbInitializer initializer("testdb", { "beta" }, test::DbSeeder());
+		RocksDatabase database(CreateTunedSettings());
+
+		// Act: keys shorter than the fixed prefix size are also supported
+		database.put(1, "hello", "amazing");
+		database.put(1, "size", "small");
+
+		// Assert:
+		RdbDataIterator iter1;
+		RdbDataIterator iter2;
+		RdbDataIterator iter3;
+		database.get(1, "hello", iter1);
+		database.get(1, "size", iter2);
+		database.get(1, "world", iter3);
+
+		test::AssertIteratorValue("amazing", iter1);
+		test::AssertIteratorValue("small", iter2);
+		EXPECT_EQ(RdbDataIterator::End(), iter3);
+	}
+
 	// region single value
 
 	TEST(TEST_CLASS, CanReadFromDb_DefaultColumn) {
@@ -269,6 +307,101 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region write batch
+
+	TEST(TEST_CLASS, DatabaseIsInitiallyNotBatching) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act + Assert:
+		EXPECT_FALSE(context.database().isBatching());
+	}
+
+	TEST(TEST_CLASS, CannotStartBatchWhenBatching) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		database.startBatch();
+
+		// Act + Assert:
+		EXPECT_THROW(database.startBatch(), catapult_runtime_error);
+		EXPECT_TRUE(database.isBatching());
+	}
+
+	TEST(TEST_CLASS, CannotFlushBatchWhenNotBatching) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().flushBatch(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, BatchedChangesAreNotVisibleBeforeFlush) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+		database.put(0, "world", "awesome");
+
+		// Act:
+		database.startBatch();
+		database.put(0, "hello", "amazing");
+		database.put(1, "hello", "incredible");
+		database.del(0, "world");
+
+		// Assert: nothing has been written
+		EXPECT_TRUE(database.isBatching());
+
+		auto iters = GetHelloKeyFromColumns(database, 2);
+		for (const auto& iter : iters)
+			EXPECT_EQ(RdbDataIterator::End(), iter);
+
+		AssertKeyValueColumn0(database, "world", "awesome");
+	}
+
+	TEST(TEST_CLASS, BatchedChangesAreVisibleAfterFlush) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+		database.put(0, "world", "awesome");
+
+		database.startBatch();
+		database.put(0, "hello", "amazing");
+		database.put(1, "hello", "incredible");
+		database.del(0, "world");
+
+		// Act:
+		database.flushBatch();
+
+		// Assert: all changes have been written
+		EXPECT_FALSE(database.isBatching());
+
+		auto iters = GetHelloKeyFromColumns(database, 2);
+		test::AssertIteratorValue("amazing", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+
+		RdbDataIterator iter;
+		database.get(0, "world", iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	TEST(TEST_CLASS, ChangesAreWrittenDirectlyAfterFlush) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		database.startBatch();
+		database.put(0, "hello", "amazing");
+		database.flushBatch();
+
+		// Act:
+		database.put(0, "world", "awesome");
+
+		// Assert:
+		AssertKeyValueColumn0(database, "hello", "amazing");
+		AssertKeyValueColumn0(database, "world", "awesome");
+	}
+
+	// endregion
+
 	// region iterators
 
 	namespace {
@@ -23,6 +23,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -623,6 +624,233 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region parallel download
+
+	namespace {
+		constexpr auto Num_Remote_Blocks = 10u;
+
+		// MockChainApi generates new (random) blocks for every request, so this mock returns blocks of a predefined chain instead
+		class PredefinedChainApi : public MockChainApi {
+		public:
+			PredefinedChainApi(const ChainScore& score, const HashRange& hashes, const std::vector<std::shared_ptr<Block>>& blocks)
+					: MockChainApi(score, test::GenerateVerifiableBlockAtHeight(Default_Height), hashes)
+					, m_blocks(blocks)
+			{}
+
+		public:
+			thread::future<BlockRange> blocksFrom(Height height, const api::BlocksFromOptions& options) const override {
+				// forward to the base implementation in order to capture the request and to raise configured errors
+				return MockChainApi::blocksFrom(height, options).then([height, options, blocks = m_blocks](auto&& rangeFuture) {
+					rangeFuture.get();
+
+					std::vector<const Block*> rawBlocks;
+					for (const auto& pBlock : blocks) {
+						if (pBlock->Height >= height && rawBlocks.size() < options.NumBlocks)
+							rawBlocks.push_back(pBlock.get());
+					}
+
+					return test::CreateEntityRange(rawBlocks);
+				});
+			}
+
+		private:
+			std::vector<std::shared_ptr<Block>> m_blocks;
+		};
+
+		struct ParallelTestContext {
+		public:
+			explicit ParallelTestContext(size_t numHelpers) : NumSupplierCalls(0) {
+				// remote chain extends the local chain by blocks at heights 20 - 29
+				std::vector<Hash256> hashes;
+				for (auto i = 0u; i < Num_Remote_Blocks; ++i) {
+					Blocks.push_back(test::GenerateVerifiableBlockAtHeight(Default_Height + Height(i)));
+					hashes.push_back(CalculateHash(*Blocks.back()));
+				}
+
+				RemoteHashes = HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+				pChainApi = std::make_shared<PredefinedChainApi>(ChainScore(11), RemoteHashes, Blocks);
+				for (auto i = 0u; i < numHelpers; ++i)
+					HelperApis.push_back(std::make_shared<PredefinedChainApi>(ChainScore(11), RemoteHashes, Blocks));
+
+				Config = CreateConfiguration();
+				Config.MaxRollbackBlocks = 9;
+				Config.MaxChainBytesPerSyncAttempt = 23;
+				Config.MaxHelperPeers = 2;
+			}
+
+		public:
+			RemoteNodeSynchronizer<api::RemoteChainApi> createSynchronizer(uint32_t forkDepth = 0) {
+				auto localHashes = test::ConcatHashes(
+						test::GenerateRandomHashesSubset(RemoteHashes, Num_Remote_Blocks - 1 - forkDepth),
+						test::GenerateRandomHashes(forkDepth));
+				auto pLocal = std::make_shared<MockChainApi>(ChainScore(10), test::GenerateVerifiableBlockAtHeight(Default_Height), localHashes);
+
+				auto blockRangeConsumer = [this](auto&& range, const auto&) {
+					ConsumedRangeHeights.emplace_back(range.cbegin()->Height, (--range.cend())->Height);
+					return ConsumedRangeHeights.size();
+				};
+
+				auto helperApisSupplier = [this](auto count) {
+					++NumSupplierCalls;
+					auto numHelpers = std::min(count, HelperApis.size());
+					return std::vector<std::shared_ptr<const api::RemoteChainApi>>(HelperApis.cbegin(), HelperApis.cbegin() + numHelpers);
+				};
+
+				return CreateChainSynchronizer(pLocal, Config, blockRangeConsumer, helperApisSupplier);
+			}
+
+		public:
+			std::vector<std::shared_ptr<Block>> Blocks;
+			HashRange RemoteHashes;
+			std::shared_ptr<MockChainApi> pChainApi;
+			std::vector<std::shared_ptr<MockChainApi>> HelperApis;
+			ChainSynchronizerConfiguration Config;
+
+			size_t NumSupplierCalls;
+			std::vector<std::pair<Height, Height>> ConsumedRangeHeights;
+		};
+
+		void AssertBlocksFromRequests(
+				const MockChainApi& chainApi,
+				const std::vector<std::pair<Height, uint32_t>>& expectedRequests,
+				const std::string& message) {
+			ASSERT_EQ(expectedRequests.size(), chainApi.blocksFromRequests().size()) << message;
+
+			auto i = 0u;
+			for (const auto& params : chainApi.blocksFromRequests()) {
+				EXPECT_EQ(expectedRequests[i].first, params.first) << message << " height of request " << i;
+				EXPECT_EQ(expectedRequests[i].second, params.second.NumBlocks) << message << " NumBlocks of request " << i;
+				EXPECT_EQ(23, params.second.NumBytes) << message << " NumBytes of request " << i;
+				++i;
+			}
+		}
+
+		using HeightPairs = std::vector<std::pair<Height, Height>>;
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_PullsDisjointChunksFromAllPeers) {
+		// Arrange: 10 hashes are split across 3 peers (chunk size 4)
+		ParallelTestContext context(2);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: chunks are consumed in height order
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(1u, context.NumSupplierCalls);
+		EXPECT_EQ(
+				HeightPairs({ { Height(20), Height(23) }, { Height(24), Height(27) }, { Height(28), Height(29) } }),
+				context.ConsumedRangeHeights);
+
+		AssertBlocksFromRequests(*context.pChainApi, { { Height(20), 4 } }, "remote");
+		AssertBlocksFromRequests(*context.HelperApis[0], { { Height(24), 4 } }, "helper 0");
+		AssertBlocksFromRequests(*context.HelperApis[1], { { Height(28), 2 } }, "helper 1");
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_ReassignsChunkOfLyingPeerToRemote) {
+		// Arrange: the first helper returns blocks that do not match the remote hashes
+		ParallelTestContext context(2);
+		context.HelperApis[0] = std::make_shared<MockChainApi>(ChainScore(11), Default_Height, context.RemoteHashes);
+		context.HelperApis[0]->setNumBlocksPerBlocksFromRequest({ 4 });
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: the remaining blocks are pulled from the remote
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(HeightPairs({ { Height(20), Height(23) }, { Height(24), Height(29) } }), context.ConsumedRangeHeights);
+
+		AssertBlocksFromRequests(*context.pChainApi, { { Height(20), 4 }, { Height(24), 9 } }, "remote");
+		AssertBlocksFromRequests(*context.HelperApis[0], { { Height(24), 4 } }, "helper 0");
+		AssertBlocksFromRequests(*context.HelperApis[1], { { Height(28), 2 } }, "helper 1");
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_ReassignsChunkOfFailingPeerToRemote) {
+		// Arrange: the second helper fails to deliver blocks
+		ParallelTestContext context(2);
+		context.HelperApis[1]->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(
+				HeightPairs({ { Height(20), Height(23) }, { Height(24), Height(27) }, { Height(28), Height(29) } }),
+				context.ConsumedRangeHeights);
+
+		AssertBlocksFromRequests(*context.pChainApi, { { Height(20), 4 }, { Height(28), 9 } }, "remote");
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_FailedInteractionIfRemoteFailsToDeliverReassignedChunk) {
+		// Arrange: the remote fails to deliver blocks
+		ParallelTestContext context(1);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: the chunk of the helper cannot be consumed before the chunk of the remote
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_TRUE(context.ConsumedRangeHeights.empty());
+
+		AssertBlocksFromRequests(*context.pChainApi, { { Height(20), 5 }, { Height(20), 9 } }, "remote");
+		AssertBlocksFromRequests(*context.HelperApis[0], { { Height(25), 5 } }, "helper 0");
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_PullsFromRemoteOnlyWhenNoHelpersAreAvailable) {
+		// Arrange:
+		ParallelTestContext context(0);
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: reference hashes are not requested
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(1u, context.NumSupplierCalls);
+		EXPECT_EQ(1u, context.pChainApi->hashesFromRequests().size());
+		EXPECT_EQ(HeightPairs({ { Height(20), Height(28) } }), context.ConsumedRangeHeights);
+
+		AssertBlocksFromRequests(*context.pChainApi, { { Height(20), 9 } }, "remote");
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_PullsFromRemoteOnlyWhenLocalChainIsForked) {
+		// Arrange:
+		ParallelTestContext context(2);
+		auto synchronizer = context.createSynchronizer(2);
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: helpers are not requested
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(0u, context.NumSupplierCalls);
+		EXPECT_EQ(0u, context.HelperApis[0]->blocksFromRequests().size());
+		EXPECT_EQ(0u, context.HelperApis[1]->blocksFromRequests().size());
+	}
+
+	TEST(TEST_CLASS, ParallelDownload_PullsFromRemoteOnlyWhenHelpersAreDisabled) {
+		// Arrange:
+		ParallelTestContext context(2);
+		context.Config.MaxHelperPeers = 0;
+		auto synchronizer = context.createSynchronizer();
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(0u, context.NumSupplierCalls);
+		AssertBlocksFromRequests(*context.pChainApi, { { Height(20), 9 } }, "remote");
+	}
+
+	// endregion
+
 	// region clean shutdown
 
 	TEST(TEST_CLASS, SynchronizerFutureCanCompleteAfterSynchronizerIsDestroyed) {
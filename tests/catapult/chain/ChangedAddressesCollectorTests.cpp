@@ -0,0 +1,164 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/ChangedAddressesCollector.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS ChangedAddressesCollectorTests
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Mijin_Test;
+
+		Address ToAddress(const Key& publicKey) {
+			return model::PublicKeyToAddress(publicKey, Network_Identifier);
+		}
+
+		void AssertTracked(const ChangedAddressesCollector& collector, const model::AddressSet& expectedAddresses) {
+			EXPECT_FALSE(collector.hasUntrackedChanges());
+			EXPECT_EQ(expectedAddresses, collector.addresses());
+		}
+
+		void AssertUntrackedChanges(model::NotificationChannel channel, model::FacilityCode facility) {
+			// Arrange:
+			ChangedAddressesCollector collector(Network_Identifier);
+
+			// Act:
+			collector.notify(model::Notification(model::MakeNotificationType(channel, facility, 0x0123), sizeof(model::Notification)));
+
+			// Assert:
+			EXPECT_TRUE(collector.hasUntrackedChanges());
+			EXPECT_TRUE(collector.addresses().empty());
+		}
+	}
+
+	TEST(TEST_CLASS, CollectorIsInitiallyEmpty) {
+		// Act:
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Assert:
+		AssertTracked(collector, {});
+	}
+
+	TEST(TEST_CLASS, CanCollectAccountAddress) {
+		// Arrange:
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act:
+		collector.notify(model::AccountAddressNotification(address));
+
+		// Assert:
+		AssertTracked(collector, { address });
+	}
+
+	TEST(TEST_CLASS, CanCollectAccountPublicKeyAsAddress) {
+		// Arrange:
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act:
+		collector.notify(model::AccountPublicKeyNotification(publicKey));
+
+		// Assert:
+		AssertTracked(collector, { ToAddress(publicKey) });
+	}
+
+	TEST(TEST_CLASS, CanCollectBalanceTransferAccounts) {
+		// Arrange:
+		auto sender = test::GenerateRandomData<Key_Size>();
+		auto recipient = test::GenerateRandomData<Address_Decoded_Size>();
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act:
+		collector.notify(model::BalanceTransferNotification(sender, recipient, MosaicId(123), Amount(234)));
+
+		// Assert:
+		AssertTracked(collector, { ToAddress(sender), recipient });
+	}
+
+	TEST(TEST_CLASS, CanCollectTransactionSigner) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act:
+		collector.notify(model::TransactionNotification(signer, hash, model::EntityType(), Timestamp()));
+
+		// Assert:
+		AssertTracked(collector, { ToAddress(signer) });
+	}
+
+	TEST(TEST_CLASS, NotificationsThatAreNotObservedDoNotChangeState) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto signature = test::GenerateRandomData<Signature_Size>();
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act: notice that cosignatures are published as signature notifications
+		collector.notify(model::EntityNotification(model::NetworkIdentifier::Mijin_Test));
+		collector.notify(model::SignatureNotification(signer, signature, {}));
+		collector.notify(model::BalanceReserveNotification(signer, MosaicId(123), Amount(234)));
+		collector.notify(model::Notification(
+				model::MakeNotificationType(model::NotificationChannel::Validator, model::FacilityCode::Transfer, 0x0123),
+				sizeof(model::Notification)));
+
+		// Assert:
+		AssertTracked(collector, {});
+	}
+
+	TEST(TEST_CLASS, BlockNotificationIsUntrackedChange) {
+		// Arrange:
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act:
+		collector.notify(model::BlockNotification(test::GenerateRandomData<Key_Size>(), Timestamp(), Difficulty()));
+
+		// Assert:
+		EXPECT_TRUE(collector.hasUntrackedChanges());
+	}
+
+	TEST(TEST_CLASS, ObservedPluginNotificationsAreUntrackedChanges) {
+		// Assert:
+		AssertUntrackedChanges(model::NotificationChannel::Observer, model::FacilityCode::Namespace);
+		AssertUntrackedChanges(model::NotificationChannel::All, model::FacilityCode::Mosaic);
+		AssertUntrackedChanges(model::NotificationChannel::All, model::FacilityCode::Multisig);
+		AssertUntrackedChanges(model::NotificationChannel::All, model::FacilityCode::Lock);
+	}
+
+	TEST(TEST_CLASS, AccountsAreCollectedAfterUntrackedChanges) {
+		// Arrange:
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+		ChangedAddressesCollector collector(Network_Identifier);
+
+		// Act:
+		collector.notify(model::BlockNotification(test::GenerateRandomData<Key_Size>(), Timestamp(), Difficulty()));
+		collector.notify(model::AccountAddressNotification(address));
+
+		// Assert:
+		EXPECT_TRUE(collector.hasUntrackedChanges());
+		EXPECT_EQ(model::AddressSet({ address }), collector.addresses());
+	}
+}}
@@ -322,6 +322,49 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region disableValidation
+
+	TEST(TEST_CLASS, NotificationsAreOnlyPassedToObserverWhenValidationIsDisabled) {
+		// Arrange:
+		TestContext context;
+		context.setValidationResult(ValidationResult::Failure);
+		auto notification1 = test::CreateNotification(Notification_Type_Validator);
+		auto notification2 = test::CreateNotification(Notification_Type_All);
+		auto notification3 = test::CreateNotification(Notification_Type_Observer);
+
+		// Act: process three notifications
+		context.sub().disableValidation();
+		context.sub().notify(notification1);
+		context.sub().notify(notification2);
+		context.sub().notify(notification3);
+
+		// Assert: validator failure is not detected because the validator is bypassed
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({});
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_Observer });
+	}
+
+	TEST(TEST_CLASS, CanUndoNotificationsWhenValidationIsDisabled) {
+		// Arrange:
+		TestContext context;
+		auto notification1 = test::CreateNotification(Notification_Type_All);
+		auto notification2 = test::CreateNotification(Notification_Type_All_2);
+
+		// Act: process two notifications and undo them
+		context.sub().disableValidation();
+		context.sub().enableUndo();
+		context.sub().notify(notification1);
+		context.sub().notify(notification2);
+		context.sub().undo();
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({});
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All_2, Notification_Type_All_2, Notification_Type_All }, 2);
+	}
+
+	// endregion
+
 	// region undo
 
 	TEST(TEST_CLASS, CannotUndoWhenUndoIsNotEnabled) {
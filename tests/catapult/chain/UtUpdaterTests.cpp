@@ -25,6 +25,8 @@
 #include "catapult/model/TransactionStatus.h"
 #include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -111,13 +113,35 @@ namespace catapult { namespace chain {
 			size_t UtCacheSize;
 		};
 
-		enum class ThrottleMode { Off, Even };
+		enum class ThrottleMode { Off, Even, Full };
+
+		constexpr auto Full_Throttle_Cache_Size = 3u;
+
+		cache::MemoryCacheOptions CreateUtCacheOptions(ThrottleMode throttleMode) {
+			// when throttling a full cache, use a small cache that prioritizes transactions by fee so that eviction is supported
+			return ThrottleMode::Full == throttleMode
+					? cache::MemoryCacheOptions(1024, Full_Throttle_Cache_Size, true)
+					: cache::MemoryCacheOptions(1024, 1000);
+		}
+
+		bool IsThrottled(ThrottleMode throttleMode, const model::TransactionInfo& transactionInfo, const UtUpdater::ThrottleContext& context) {
+			switch (throttleMode) {
+			case ThrottleMode::Even:
+				return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
+
+			case ThrottleMode::Full:
+				return context.TransactionsCache.size() >= Full_Throttle_Cache_Size;
+
+			default:
+				return false;
+			}
+		}
 
 		class UpdaterTestContext {
 		public:
 			explicit UpdaterTestContext(ThrottleMode throttleMode = ThrottleMode::Off)
 					: m_cache(CreateCacheWithDefaultHeight())
-					, m_transactionsCache(cache::MemoryCacheOptions(1024, 1000))
+					, m_transactionsCache(CreateUtCacheOptions(throttleMode))
 					, m_updater(
 							m_transactionsCache,
 							m_cache,
@@ -129,7 +153,7 @@ namespace catapult { namespace chain {
 							},
 							[this, throttleMode](const auto& transactionInfo, const auto& context) {
 								m_throttleParams.emplace_back(transactionInfo, context);
-								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
+								return IsThrottled(throttleMode, transactionInfo, context);
 							})
 			{}
 
@@ -146,6 +170,14 @@ namespace catapult { namespace chain {
 				m_executionConfig.pValidator->setResult(result, hash, id);
 			}
 
+			void setValidatorOnlyNotifications(const Hash256& hash) {
+				m_executionConfig.pNotificationPublisher->setValidatorOnly(hash);
+			}
+
+			size_t numValidatorCalls() const {
+				return m_executionConfig.pValidator->params().size();
+			}
+
 			void setPartialUndoFailureIndexes(const std::unordered_set<size_t>& partialUndoFailureIndexes) {
 				m_partialUndoFailureIndexes = partialUndoFailureIndexes;
 			}
@@ -354,6 +386,7 @@ namespace catapult { namespace chain {
 				}
 			}
 
+		public:
 			void assertFailedTransactionStatuses(const model::WeakEntityInfos& entityInfos, const IndexResultPairs& failedIndexes) const {
 				// Assert:
 				ASSERT_EQ(failedIndexes.size(), m_failedTransactionStatuses.size());
@@ -471,6 +504,19 @@ namespace catapult { namespace chain {
 
 			return data;
 		}
+
+		void SetFees(TransactionData& data, const std::vector<Amount>& fees) {
+			for (auto i = 0u; i < data.UtInfos.size(); ++i) {
+				auto pTransaction = test::CopyEntity(*data.UtInfos[i].pEntity);
+				pTransaction->Fee = fees[i];
+				data.UtInfos[i].pEntity = std::move(pTransaction);
+			}
+
+			data.Entities = test::ExtractEntities(data.UtInfos);
+			data.EntityInfos.clear();
+			for (auto i = 0u; i < data.UtInfos.size(); ++i)
+				data.EntityInfos.push_back(CreateEntityInfoAt(data, i));
+		}
 	}
 
 #define NON_SUCCESS_VALIDATION_TRAITS_BASED_TEST(TEST_NAME) \
@@ -572,6 +618,24 @@ namespace catapult { namespace chain {
 		context.assertEntityInfosWithDuplicates(transactionData.EntityInfos, { 1, 3 }, { { 0, result }, { 2, result }, { 4, result } });
 	}
 
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(ThrottledTransactionsCanEvictLowerPriorityTransactionsFromCache) {
+		// Arrange: throttle when the cache (of size 3) is full
+		UpdaterTestContext context(ThrottleMode::Full);
+		auto transactionData = CreateTransactionData(5);
+		SetFees(transactionData, { Amount(10), Amount(50), Amount(20), Amount(5), Amount(40) });
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert: the fourth transaction was dropped because it pays less than all cached transactions
+		//         and the fifth transaction evicted the lowest paying (first) transaction
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 1, 2, 4 }));
+
+		auto result = Failure_Chain_Unconfirmed_Cache_Too_Full;
+		context.assertFailedTransactionStatuses(transactionData.EntityInfos, { { 3, result }, { 0, result } });
+	}
+
 	// endregion
 
 	// region shared tests - new transactions that fail validation do not get added / are undone
@@ -963,4 +1027,237 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor) - changed addresses
+
+	namespace {
+		// notice that all transactions created with a start of at least 32 have deadlines after Default_Time
+		constexpr auto Unexpired_Start = 32u;
+
+		void SetExtractedAddresses(model::TransactionInfo& utInfo, const model::AddressSet& addresses) {
+			utInfo.OptionalExtractedAddresses = std::make_shared<model::AddressSet>(addresses);
+		}
+
+		void SetExtractedAddresses(TransactionData& data, const std::vector<Address>& addresses) {
+			for (auto i = 0u; i < addresses.size(); ++i)
+				SetExtractedAddresses(data.UtInfos[i], { addresses[i] });
+		}
+
+		std::vector<Address> GenerateRandomAddresses(size_t count) {
+			std::vector<Address> addresses;
+			for (auto i = 0u; i < count; ++i)
+				addresses.push_back(test::GenerateRandomAddress());
+
+			return addresses;
+		}
+	}
+
+	TEST(TEST_CLASS, OriginalTransactionsNotReferencingChangedAddressesAreOnlyObserved) {
+		// Arrange: initialize the UT cache with 4 transactions, each referencing a different address
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		auto addresses = GenerateRandomAddresses(4);
+		SetExtractedAddresses(originalTransactionData, addresses);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act: only the second address is changed
+		context.updater().update({}, {}, { addresses[1] });
+
+		// Assert: all transactions are still in the cache
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+
+		// - only the transaction referencing the changed address is validated but all transactions are observed
+		//   old: E[0] O0,O1; E[1] V2,O2,V3,O3; E[2] O4,O5; E[3] O6,O7
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), std::vector<size_t>({ 2, 3 }));
+		context.assertEntityInfos(
+				originalTransactionData.EntityInfos,
+				std::vector<size_t>({ 1, 1 }),
+				std::vector<size_t>({ 0, 0, 1, 1, 2, 2, 3, 3 }));
+	}
+
+	TEST(TEST_CLASS, OriginalTransactionsReferencingRevertedTransactionAddressesAreRevalidated) {
+		// Arrange: initialize the UT cache with 3 transactions, each referencing a different address
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, Unexpired_Start + 1);
+		auto addresses = GenerateRandomAddresses(4);
+		SetExtractedAddresses(originalTransactionData, { addresses[0], addresses[1], addresses[2] });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - prepare a reverted transaction that references the same address as the second original transaction
+		auto transactionData = CreateTransactionData(1, Unexpired_Start);
+		SetExtractedAddresses(transactionData, { addresses[1] });
+
+		// Act: none of the addresses are changed by the block
+		context.updater().update({}, transactionData.UtInfos, { addresses[3] });
+
+		// Assert: the cache contains original and reverted transactions
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		// - reverted transactions are always validated and original transactions depending on them are revalidated
+		//   new: E[0] V0,O0,V1,O1
+		//   old: E[0] O2,O3; E[1] V4,O4,V5,O5; E[2] O6,O7
+		context.assertContexts(CreateRevertedAndExistingSources(1, 3), std::vector<size_t>({ 0, 1, 4, 5 }));
+		context.assertEntityInfos(
+				ConcatContainers(transactionData.EntityInfos, originalTransactionData.EntityInfos),
+				std::vector<size_t>({ 0, 0, 2, 2 }),
+				std::vector<size_t>({ 0, 0, 1, 1, 2, 2, 3, 3 }));
+	}
+
+	TEST(TEST_CLASS, OriginalTransactionsWithoutExtractedAddressesAreRevalidated) {
+		// Arrange: initialize the UT cache with 3 transactions, but do not extract addresses for the second one
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, Unexpired_Start);
+		auto addresses = GenerateRandomAddresses(3);
+		SetExtractedAddresses(originalTransactionData.UtInfos[0], { addresses[0] });
+		originalTransactionData.UtInfos[1].OptionalExtractedAddresses.reset();
+		SetExtractedAddresses(originalTransactionData.UtInfos[2], { addresses[2] });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, {});
+
+		// Assert: all transactions are still in the cache
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+
+		// - only the transaction with unknown dependencies is validated
+		//   old: E[0] O0,O1; E[1] V2,O2,V3,O3; E[2] O4,O5
+		context.assertContexts(CreateRevertedAndExistingSources(0, 3), std::vector<size_t>({ 2, 3 }));
+		context.assertEntityInfos(
+				originalTransactionData.EntityInfos,
+				std::vector<size_t>({ 1, 1 }),
+				std::vector<size_t>({ 0, 0, 1, 1, 2, 2 }));
+	}
+
+	TEST(TEST_CLASS, ExpiredOriginalTransactionsAreRevalidated) {
+		// Arrange: initialize the UT cache with 3 transactions with deadlines before Default_Time
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3);
+		SetExtractedAddresses(originalTransactionData, GenerateRandomAddresses(3));
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, {});
+
+		// Assert: all transactions are validated even though none reference changed addresses
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+
+		context.assertContexts(CreateRevertedAndExistingSources(0, 3));
+		context.assertEntityInfos(originalTransactionData.EntityInfos);
+	}
+
+	TEST(TEST_CLASS, OriginalTransactionsReferencingAddressesOfDroppedTransactionsAreRevalidated) {
+		// Arrange: initialize the UT cache with 3 transactions, where the first two share an address
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, Unexpired_Start);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		auto addresses = GenerateRandomAddresses(3);
+		SetExtractedAddresses(originalTransactionData.UtInfos[0], { addresses[0], addresses[1] });
+		SetExtractedAddresses(originalTransactionData.UtInfos[1], { addresses[1] });
+		SetExtractedAddresses(originalTransactionData.UtInfos[2], { addresses[2] });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - fail the first transaction (neutral results are not forwarded to the failed transaction sink)
+		//   and don't let it change any state that is not keyed by address
+		context.setValidationResult(ValidationResult::Neutral, originalHashes[0], 1);
+		context.setValidatorOnlyNotifications(originalHashes[0]);
+
+		// Act: only the first address is changed
+		context.updater().update({}, {}, { addresses[0] });
+
+		// Assert: the first transaction was dropped
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 1, 2 }));
+
+		// - the second transaction is revalidated because the dropped transaction referenced the same address
+		//   old: E[0] V0; E[1] V0,O0,V1,O1; E[2] O2,O3
+		context.assertContexts(CreateRevertedAndExistingSources(0, 3), std::vector<size_t>({ 0, 0, 1 }));
+		context.assertEntityInfos(
+				originalTransactionData.EntityInfos,
+				std::vector<size_t>({ 0, 1, 1 }),
+				std::vector<size_t>({ 1, 1, 2, 2 }));
+	}
+
+	TEST(TEST_CLASS, OriginalTransactionsAreRevalidatedWhenDroppedTransactionsChangeUntrackedState) {
+		// Arrange: initialize the UT cache with 3 transactions with disjoint addresses
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, Unexpired_Start);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		auto addresses = GenerateRandomAddresses(3);
+		for (auto i = 0u; i < 3; ++i)
+			SetExtractedAddresses(originalTransactionData.UtInfos[i], { addresses[i] });
+
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - fail the first transaction after it raised an observable notification that is not keyed by address
+		context.setValidationResult(ValidationResult::Neutral, originalHashes[0], 2);
+
+		// Act: only the first address is changed
+		context.updater().update({}, {}, { addresses[0] });
+
+		// Assert: the first transaction was dropped
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 1, 2 }));
+
+		// - all subsequent transactions are revalidated because the changes made by the dropped transaction are unknown
+		//   old: E[0] V0,O1,V1;RO2 E[1] V2,O3,V3,O4; E[2] V4,O5,V5,O6
+		context.setPartialUndoFailureIndexes({ 1 });
+		context.assertContexts(CreateRevertedAndExistingSources(0, 3));
+		context.assertEntityInfos(originalTransactionData.EntityInfos);
+	}
+
+	TEST(TEST_CLASS, TransactionsAddedWithoutValidationAreRevalidatedIrrespectiveOfChangedAddresses) {
+		// Arrange: initialize the UT cache with 2 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(2, Unexpired_Start);
+		SetExtractedAddresses(originalTransactionData, GenerateRandomAddresses(2));
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - modify the catapult cache after creating the updater so that new transactions are added without validation
+		context.seedDifficultyInfos(7);
+		auto transactionData = CreateTransactionData(2, Unexpired_Start + 2);
+		SetExtractedAddresses(transactionData, GenerateRandomAddresses(2));
+		context.updater().update(transactionData.UtInfos);
+
+		// Act: none of the addresses are changed by the block
+		context.updater().update({}, {}, {});
+
+		// Assert: the cache contains original and new transactions
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		// - all transactions were validated
+		context.assertContexts(CreateRevertedAndExistingSources(0, 4), 7);
+		context.assertEntityInfos(ConcatContainers(originalTransactionData.EntityInfos, transactionData.EntityInfos));
+	}
+
+	TEST(TEST_CLASS, TransactionsAreRevalidatedIrrespectiveOfChangedAddressesAfterEviction) {
+		// Arrange: throttle when the cache (of size 3) is full
+		UpdaterTestContext context(ThrottleMode::Full);
+		auto transactionData = CreateTransactionData(4, Unexpired_Start);
+		SetExtractedAddresses(transactionData, GenerateRandomAddresses(4));
+		SetFees(transactionData, { Amount(10), Amount(50), Amount(20), Amount(40) });
+
+		// - the fourth transaction evicts the first transaction, whose changes are not undone
+		context.updater().update(transactionData.UtInfos);
+		auto numValidatorCalls = context.numValidatorCalls();
+
+		// Sanity:
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 1, 2, 3 }));
+
+		// Act: none of the addresses are changed by the block
+		context.updater().update({}, {}, {});
+
+		// Assert: all remaining transactions were validated (the mock publisher creates two notifications per transaction)
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		EXPECT_EQ(numValidatorCalls + 2 * 3, context.numValidatorCalls());
+	}
+
+	// endregion
 }}
@@ -31,6 +31,7 @@
 #include "tests/test/core/NotificationTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include <unordered_map>
+#include <unordered_set>
 
 namespace catapult { namespace test {
 
@@ -53,7 +54,11 @@ namespace catapult { namespace test {
 	struct MockNotification : public model::Notification {
 	public:
 		explicit MockNotification(const Hash256& hash, size_t id)
-				: Notification(static_cast<model::NotificationType>(-1), sizeof(MockNotification))
+				: MockNotification(static_cast<model::NotificationType>(-1), hash, id)
+		{}
+
+		explicit MockNotification(model::NotificationType type, const Hash256& hash, size_t id)
+				: Notification(type, sizeof(MockNotification))
 				, Hash(hash)
 				, Id(id)
 		{}
@@ -67,9 +72,23 @@ namespace catapult { namespace test {
 	public:
 		void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
 			const_cast<MockNotificationPublisher*>(this)->push(entityInfo);
-			subscriber.notify(MockNotification(entityInfo.hash(), 1));
-			subscriber.notify(MockNotification(entityInfo.hash(), 2));
+
+			auto type = static_cast<model::NotificationType>(-1);
+			if (m_validatorOnlyHashes.cend() != m_validatorOnlyHashes.find(entityInfo.hash()))
+				model::SetNotificationChannel(type, model::NotificationChannel::Validator);
+
+			subscriber.notify(MockNotification(type, entityInfo.hash(), 1));
+			subscriber.notify(MockNotification(type, entityInfo.hash(), 2));
 		}
+
+	public:
+		/// Only raises notifications for the entity with \a hash on the validator channel.
+		void setValidatorOnly(const Hash256& hash) {
+			m_validatorOnlyHashes.insert(hash);
+		}
+
+	private:
+		std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> m_validatorOnlyHashes;
 	};
 
 	// endregion
@@ -72,12 +72,17 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 			EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+			EXPECT_FALSE(config.ShouldCalculateCacheStateRoots);
+			EXPECT_FALSE(config.ShouldUseSegmentedBlockStorage);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.BlockStorageCacheMaxSize);
+			EXPECT_EQ(360u, config.StateCheckpointInterval);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(3u, config.MaxHelperPeersPerSyncAttempt);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -86,6 +91,8 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(1'000'000u, config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_FALSE(config.ShouldPrioritizeUnconfirmedTransactionsByFee);
+			EXPECT_EQ(0u, config.UnconfirmedTransactionsFullRevalidationInterval);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
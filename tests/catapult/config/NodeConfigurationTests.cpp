@@ -38,12 +38,17 @@ namespace catapult { namespace config {
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
+							{ "shouldCalculateCacheStateRoots", "true" },
+							{ "shouldUseSegmentedBlockStorage", "true" },
+							{ "blockStorageCacheMaxSize", "321KB" },
+							{ "stateCheckpointInterval", "43" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxHelperPeersPerSyncAttempt", "7" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -52,6 +57,8 @@ namespace catapult { namespace config {
 
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98'763" },
+							{ "shouldPrioritizeUnconfirmedTransactionsByFee", "true" },
+							{ "unconfirmedTransactionsFullRevalidationInterval", "17" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -119,12 +126,17 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_FALSE(config.ShouldCalculateCacheStateRoots);
+				EXPECT_FALSE(config.ShouldUseSegmentedBlockStorage);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockStorageCacheMaxSize);
+				EXPECT_EQ(0u, config.StateCheckpointInterval);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxHelperPeersPerSyncAttempt);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -133,6 +145,8 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_FALSE(config.ShouldPrioritizeUnconfirmedTransactionsByFee);
+				EXPECT_EQ(0u, config.UnconfirmedTransactionsFullRevalidationInterval);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -175,12 +189,17 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_TRUE(config.ShouldCalculateCacheStateRoots);
+				EXPECT_TRUE(config.ShouldUseSegmentedBlockStorage);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(321), config.BlockStorageCacheMaxSize);
+				EXPECT_EQ(43u, config.StateCheckpointInterval);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(7u, config.MaxHelperPeersPerSyncAttempt);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -189,6 +208,8 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_TRUE(config.ShouldPrioritizeUnconfirmedTransactionsByFee);
+				EXPECT_EQ(17u, config.UnconfirmedTransactionsFullRevalidationInterval);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
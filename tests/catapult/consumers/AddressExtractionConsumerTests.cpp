@@ -23,6 +23,7 @@
 #include "catapult/model/Address.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
 
@@ -42,12 +43,19 @@ namespace catapult { namespace consumers {
 			auto senderAddress = model::PublicKeyToAddress(transaction.Signer, transaction.Network());
 			EXPECT_TRUE(pAddresses->cend() != pAddresses->find(senderAddress)) << message;
 		}
+
+		std::shared_ptr<const ParallelConsumerPolicy> CreateParallelPolicy() {
+			return std::make_shared<ParallelConsumerPolicy>(test::CreateStartedIoServiceThreadPool(4), 1);
+		}
 	}
 
 	// region block
 
 	namespace {
-		void AssertBlockAddressesAreExtractedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+		void AssertBlockAddressesAreExtractedCorrectly(
+				uint32_t numBlocks,
+				uint32_t numTransactionsPerBlock,
+				const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy = nullptr) {
 			// Arrange:
 			std::vector<std::shared_ptr<const model::Block>> blocks;
 			std::vector<const model::Block*> rawBlocks;
@@ -61,7 +69,10 @@ namespace catapult { namespace consumers {
 			auto input = test::CreateBlockElements(rawBlocks);
 
 			// Act:
-			auto result = CreateBlockAddressExtractionConsumer(*pPublisher)(input);
+			auto consumer = pParallelPolicy
+					? CreateBlockAddressExtractionConsumer(*pPublisher, pParallelPolicy)
+					: CreateBlockAddressExtractionConsumer(*pPublisher);
+			auto result = consumer(input);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -104,19 +115,29 @@ namespace catapult { namespace consumers {
 		AssertBlockAddressesAreExtractedCorrectly(3, 4);
 	}
 
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactionsInParallel) {
+		// Assert:
+		AssertBlockAddressesAreExtractedCorrectly(3, 20, CreateParallelPolicy());
+	}
+
 	// endregion
 
 	// region transaction
 
 	namespace {
-		void AssertTransactionAddressesAreExtractedCorrectly(uint32_t numTransactions) {
+		void AssertTransactionAddressesAreExtractedCorrectly(
+				uint32_t numTransactions,
+				const std::shared_ptr<const ParallelConsumerPolicy>& pParallelPolicy = nullptr) {
 			// Arrange:
 			auto registry = mocks::CreateDefaultTransactionRegistry();
 			auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
 			auto input = test::CreateTransactionElements(numTransactions);
 
 			// Act:
-			auto result = CreateTransactionAddressExtractionConsumer(*pPublisher)(input);
+			auto consumer = pParallelPolicy
+					? CreateTransactionAddressExtractionConsumer(*pPublisher, pParallelPolicy)
+					: CreateTransactionAddressExtractionConsumer(*pPublisher);
+			auto result = consumer(input);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -147,5 +168,10 @@ namespace catapult { namespace consumers {
 		AssertTransactionAddressesAreExtractedCorrectly(3);
 	}
 
+	TEST(TRANSACTION_TEST_CLASS, CanProcessMultipleEntitiesInParallel) {
+		// Assert:
+		AssertTransactionAddressesAreExtractedCorrectly(20, CreateParallelPolicy());
+	}
+
 	// endregion
 }}
@@ -25,9 +25,11 @@
 #include "catapult/chain/ChainResults.h"
 #include "catapult/consumers/InputUtils.h"
 #include "catapult/model/BlockUtils.h"
+#include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include "tests/TestHarness.h"
 
@@ -483,4 +485,153 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region pipelined processor
+
+	namespace {
+		struct PipelinedProcessorTestContext {
+		public:
+			explicit PipelinedProcessorTestContext(size_t numLookaheadBlocks)
+					// use a single threaded pool because the mock publisher is not thread safe
+					: pPool(test::CreateStartedIoServiceThreadPool(1))
+					, Processor(CreatePipelinedBlockChainProcessor(
+							[](const auto&) {
+								return [](const auto&, const auto&, const auto&) { return true; };
+							},
+							ExecutionConfig.Config,
+							pPool,
+							numLookaheadBlocks))
+			{}
+
+		public:
+			test::MockExecutionConfiguration ExecutionConfig;
+			std::shared_ptr<thread::IoServiceThreadPool> pPool;
+			BlockChainProcessor Processor;
+		};
+
+		struct SequentialProcessorTestContext {
+		public:
+			SequentialProcessorTestContext()
+					: Processor(CreateBlockChainProcessor(
+							[](const auto&) {
+								return [](const auto&, const auto&, const auto&) { return true; };
+							},
+							chain::CreateBatchEntityProcessor(ExecutionConfig.Config)))
+			{}
+
+		public:
+			test::MockExecutionConfiguration ExecutionConfig;
+			BlockChainProcessor Processor;
+		};
+
+		template<typename TContext>
+		ValidationResult ProcessWithContext(TContext& context, const model::Block& parentBlock, BlockElements& elements) {
+			state::CatapultState state;
+			auto cache = test::CreateCatapultCacheWithMarkerAccount();
+			auto delta = cache.createDelta();
+			auto parentBlockElement = test::BlockToBlockElement(parentBlock);
+			return context.Processor(WeakBlockInfo(parentBlockElement), elements, observers::ObserverState(delta, state));
+		}
+
+		void AssertPipelinedProcessingIsEquivalent(
+				size_t numLookaheadBlocks,
+				ValidationResult expectedResult,
+				const consumer<test::MockExecutionConfiguration&, const BlockElements&>& prepare) {
+			// Arrange:
+			auto pParentBlock = test::GenerateEmptyRandomBlock();
+			pParentBlock->Height = Height(11);
+			auto pBlock1 = test::GenerateBlockWithTransactionsAtHeight(3, 12);
+			auto pBlock2 = test::GenerateBlockWithTransactionsAtHeight(2, 13);
+			auto pBlock3 = test::GenerateBlockWithTransactionsAtHeight(4, 14);
+			auto pBlock4 = test::GenerateBlockWithTransactionsAtHeight(1, 15);
+			auto elements = test::CreateBlockElements({ pBlock1.get(), pBlock2.get(), pBlock3.get(), pBlock4.get() });
+			test::LinkBlocks(*pParentBlock, const_cast<model::Block&>(elements[0].Block));
+
+			SequentialProcessorTestContext sequentialContext;
+			PipelinedProcessorTestContext pipelinedContext(numLookaheadBlocks);
+			prepare(sequentialContext.ExecutionConfig, elements);
+			prepare(pipelinedContext.ExecutionConfig, elements);
+
+			// Act:
+			auto sequentialResult = ProcessWithContext(sequentialContext, *pParentBlock, elements);
+			auto pipelinedResult = ProcessWithContext(pipelinedContext, *pParentBlock, elements);
+
+			// Assert: the results are the same
+			EXPECT_EQ(expectedResult, sequentialResult);
+			EXPECT_EQ(expectedResult, pipelinedResult);
+
+			// - the same notifications were validated in the same order
+			const auto& expectedValidatorParams = sequentialContext.ExecutionConfig.pValidator->params();
+			const auto& validatorParams = pipelinedContext.ExecutionConfig.pValidator->params();
+			ASSERT_EQ(expectedValidatorParams.size(), validatorParams.size());
+			for (auto i = 0u; i < validatorParams.size(); ++i) {
+				auto message = "validator at " + std::to_string(i);
+				EXPECT_EQ(expectedValidatorParams[i].HashCopy, validatorParams[i].HashCopy) << message;
+				EXPECT_EQ(expectedValidatorParams[i].SequenceId, validatorParams[i].SequenceId) << message;
+				EXPECT_EQ(expectedValidatorParams[i].Context.Height, validatorParams[i].Context.Height) << message;
+				EXPECT_EQ(expectedValidatorParams[i].NumDifficultyInfos, validatorParams[i].NumDifficultyInfos) << message;
+			}
+
+			// - the same notifications were observed in the same order
+			const auto& expectedObserverParams = sequentialContext.ExecutionConfig.pObserver->params();
+			const auto& observerParams = pipelinedContext.ExecutionConfig.pObserver->params();
+			ASSERT_EQ(expectedObserverParams.size(), observerParams.size());
+			for (auto i = 0u; i < observerParams.size(); ++i) {
+				auto message = "observer at " + std::to_string(i);
+				EXPECT_EQ(expectedObserverParams[i].HashCopy, observerParams[i].HashCopy) << message;
+				EXPECT_EQ(expectedObserverParams[i].SequenceId, observerParams[i].SequenceId) << message;
+				EXPECT_EQ(expectedObserverParams[i].Context.Height, observerParams[i].Context.Height) << message;
+				EXPECT_EQ(expectedObserverParams[i].NumDifficultyInfos, observerParams[i].NumDifficultyInfos) << message;
+			}
+		}
+
+		void AssertPipelinedProcessingIsEquivalent(size_t numLookaheadBlocks) {
+			AssertPipelinedProcessingIsEquivalent(numLookaheadBlocks, ValidationResult::Success, [](const auto&, const auto&) {});
+		}
+	}
+
+	TEST(TEST_CLASS, PipelinedProcessorWithoutLookaheadProducesSameResultAsSequentialProcessor) {
+		// Assert:
+		AssertPipelinedProcessingIsEquivalent(0);
+	}
+
+	TEST(TEST_CLASS, PipelinedProcessorWithLookaheadProducesSameResultAsSequentialProcessor) {
+		// Assert:
+		AssertPipelinedProcessingIsEquivalent(2);
+	}
+
+	TEST(TEST_CLASS, PipelinedProcessorWithLookaheadBeyondInputProducesSameResultAsSequentialProcessor) {
+		// Assert:
+		AssertPipelinedProcessingIsEquivalent(10);
+	}
+
+	TEST(TEST_CLASS, PipelinedProcessorShortCircuitsOnFailureLikeSequentialProcessor) {
+		// Assert: fail validation of the second notification of the first transaction in the third block
+		AssertPipelinedProcessingIsEquivalent(2, ValidationResult::Failure, [](auto& executionConfig, const auto& elements) {
+			executionConfig.pValidator->setResult(ValidationResult::Failure, elements[2].Transactions[0].EntityHash, 2);
+		});
+	}
+
+	TEST(TEST_CLASS, PipelinedProcessorPublishesNotificationsOfEachEntityOnce) {
+		// Arrange:
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		pParentBlock->Height = Height(11);
+		auto elements = test::CreateBlockElements(5);
+		test::LinkBlocks(*pParentBlock, const_cast<model::Block&>(elements[0].Block));
+
+		PipelinedProcessorTestContext context(2);
+
+		// Act:
+		auto result = ProcessWithContext(context, *pParentBlock, elements);
+
+		// Assert: each block was published exactly once (by the pool) and in order
+		EXPECT_EQ(ValidationResult::Success, result);
+
+		const auto& publisherParams = context.ExecutionConfig.pNotificationPublisher->params();
+		ASSERT_EQ(5u, publisherParams.size());
+		for (auto i = 0u; i < publisherParams.size(); ++i)
+			EXPECT_EQ(elements[i].EntityHash, publisherParams[i].HashCopy) << "publisher at " << i;
+	}
+
+	// endregion
 }}
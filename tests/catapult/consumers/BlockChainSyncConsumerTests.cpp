@@ -22,7 +22,11 @@
 #include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/cache_core/BlockDifficultyCache.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/Address.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
 #include "tests/catapult/consumers/test/ConsumerInputFactory.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
@@ -208,14 +212,21 @@ namespace catapult { namespace consumers {
 
 		struct TransactionsChangeParams {
 		public:
-			TransactionsChangeParams(const HashSet& addedTransactionHashes, const HashSet& revertedTransactionHashes)
+			TransactionsChangeParams(
+					const HashSet& addedTransactionHashes,
+					const HashSet& revertedTransactionHashes,
+					const model::AddressSet* pChangedAddresses)
 					: AddedTransactionHashes(addedTransactionHashes)
 					, RevertedTransactionHashes(revertedTransactionHashes)
+					, HasChangedAddresses(!!pChangedAddresses)
+					, ChangedAddresses(pChangedAddresses ? *pChangedAddresses : model::AddressSet())
 			{}
 
 		public:
 			const HashSet AddedTransactionHashes;
 			const HashSet RevertedTransactionHashes;
+			const bool HasChangedAddresses;
+			const model::AddressSet ChangedAddresses;
 		};
 
 		class MockTransactionsChange : public test::ParamsCapture<TransactionsChangeParams> {
@@ -223,7 +234,8 @@ namespace catapult { namespace consumers {
 			void operator()(const TransactionsChangeInfo& changeInfo) const {
 				TransactionsChangeParams params(
 						CopyHashes(changeInfo.AddedTransactionHashes),
-						CopyHashes(changeInfo.RevertedTransactionInfos));
+						CopyHashes(changeInfo.RevertedTransactionInfos),
+						changeInfo.pChangedAddresses);
 				const_cast<MockTransactionsChange*>(this)->push(std::move(params));
 			}
 
@@ -247,6 +259,33 @@ namespace catapult { namespace consumers {
 
 		// endregion
 
+		// region MockNotificationPublisher
+
+		class MockNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void setUntrackedChanges(const Hash256& hash) {
+				m_untrackedChangesHashes.insert(hash);
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				// every transaction changes its signer and some transactions (also) change state that is not keyed by account
+				sub.notify(model::AccountPublicKeyNotification(entityInfo.entity().Signer));
+				if (m_untrackedChangesHashes.cend() != m_untrackedChangesHashes.find(entityInfo.hash())) {
+					auto notificationType = model::MakeNotificationType(
+							model::NotificationChannel::All,
+							model::FacilityCode::Namespace,
+							0x0123);
+					sub.notify(model::Notification(notificationType, sizeof(model::Notification)));
+				}
+			}
+
+		private:
+			HashSet m_untrackedChangesHashes;
+		};
+
+		// endregion
+
 		void SetBlockHeight(model::Block& block, Height height) {
 			block.Timestamp = Timestamp(height.unwrap() * 1000);
 			block.Difficulty = Difficulty();
@@ -257,7 +296,8 @@ namespace catapult { namespace consumers {
 		public:
 			ConsumerTestContext()
 					: Cache(test::CreateCatapultCacheWithMarkerAccount())
-					, Storage(std::make_unique<mocks::MockMemoryBasedStorage>()) {
+					, Storage(std::make_unique<mocks::MockMemoryBasedStorage>())
+					, pNotificationPublisher(std::make_shared<MockNotificationPublisher>()) {
 				State.LastRecalculationHeight = Initial_Last_Recalculation_Height;
 
 				BlockChainSyncHandlers handlers;
@@ -277,7 +317,7 @@ namespace catapult { namespace consumers {
 					return TransactionsChange(changeInfo);
 				};
 
-				Consumer = CreateBlockChainSyncConsumer(Cache, State, Storage, Max_Rollback_Blocks, handlers);
+				Consumer = CreateBlockChainSyncConsumer(Cache, State, Storage, Max_Rollback_Blocks, pNotificationPublisher, handlers);
 			}
 
 		public:
@@ -291,6 +331,7 @@ namespace catapult { namespace consumers {
 			MockProcessor Processor;
 			MockStateChange StateChange;
 			MockTransactionsChange TransactionsChange;
+			std::shared_ptr<MockNotificationPublisher> pNotificationPublisher;
 
 			disruptor::DisruptorConsumer Consumer;
 
@@ -757,6 +798,10 @@ namespace catapult { namespace consumers {
 				return m_addedHashes;
 			}
 
+			const model::AddressSet& signerAddresses() const {
+				return m_signerAddresses;
+			}
+
 		public:
 			void addRandom(size_t elementIndex, size_t numTransactions) {
 				for (auto i = 0u; i < numTransactions; ++i)
@@ -781,14 +826,17 @@ namespace catapult { namespace consumers {
 				auto transactionElement = model::TransactionElement(*pTransaction);
 				transactionElement.EntityHash = hash;
 
-				m_input.blocks()[elementIndex].Transactions.push_back(transactionElement);
+				auto& blockElement = m_input.blocks()[elementIndex];
+				blockElement.Transactions.push_back(transactionElement);
 				m_addedHashes.push_back(hash);
+				m_signerAddresses.insert(model::PublicKeyToAddress(pTransaction->Signer, blockElement.Block.Network()));
 				m_transactions.push_back(pTransaction); // keep the transaction alive
 			}
 
 		private:
 			ConsumerInput& m_input;
 			std::vector<Hash256> m_addedHashes;
+			model::AddressSet m_signerAddresses;
 			std::vector<std::shared_ptr<model::Transaction>> m_transactions;
 		};
 
@@ -839,6 +887,89 @@ namespace catapult { namespace consumers {
 		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
 	}
 
+	TEST(TEST_CLASS, CanSyncCompatibleChainsWithChangedAddresses_TransactionNotification) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+		ConsumerTestContext context;
+		context.seedStorage(Height(7), 3);
+		auto input = CreateInput(Height(8), 4);
+
+		// - add transactions to the input
+		InputTransactionBuilder builder(input);
+		builder.addRandom(0, 1);
+		builder.addRandom(2, 3);
+
+		// - all harvesters and accounts changed by transactions (their signers) are changed
+		auto expectedChangedAddresses = builder.signerAddresses();
+		for (const auto& element : input.blocks())
+			expectedChangedAddresses.insert(model::PublicKeyToAddress(element.Block.Signer, element.Block.Network()));
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		// - the change notification had 4 added and 0 reverted
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+
+		EXPECT_EQ(4u, txChangeParams.AddedTransactionHashes.size());
+		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+
+		EXPECT_TRUE(txChangeParams.HasChangedAddresses);
+		EXPECT_EQ(expectedChangedAddresses, txChangeParams.ChangedAddresses);
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChainsWithUntrackedStateChanges_TransactionNotification) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+		ConsumerTestContext context;
+		context.seedStorage(Height(7), 3);
+		auto input = CreateInput(Height(8), 4);
+
+		// - add transactions to the input where one transaction changes state that is not keyed by account
+		InputTransactionBuilder builder(input);
+		builder.addRandom(0, 1);
+		builder.addRandom(2, 3);
+		context.pNotificationPublisher->setUntrackedChanges(builder.hashes()[2]);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		// - changed addresses are unknown because not all changes are keyed by account
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+
+		EXPECT_EQ(4u, txChangeParams.AddedTransactionHashes.size());
+		EXPECT_FALSE(txChangeParams.HasChangedAddresses);
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChainsWithoutChangedAddresses_TransactionNotification) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
+		ConsumerTestContext context;
+		context.seedStorage(Height(7), 3);
+		auto input = CreateInput(Height(5), 4);
+
+		// - add transactions to the input
+		InputTransactionBuilder builder(input);
+		builder.addRandom(0, 1);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		// - changed addresses are unknown because local blocks were unwound
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+
+		EXPECT_EQ(9u, txChangeParams.RevertedTransactionHashes.size());
+		EXPECT_FALSE(txChangeParams.HasChangedAddresses);
+	}
+
 	TEST(TEST_CLASS, CanSyncIncompatibleChains_TransactionNotification) {
 		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 5-8
 		ConsumerTestContext context;
@@ -27,6 +27,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/TestHarness.h"
@@ -139,14 +140,22 @@ namespace catapult { namespace consumers {
 			EXPECT_EQ(numExpectedTransactions, numTransactions);
 		}
 
-		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+		std::shared_ptr<const ParallelConsumerPolicy> CreateParallelPolicy() {
+			return std::make_shared<ParallelConsumerPolicy>(test::CreateStartedIoServiceThreadPool(4), 1);
+		}
+
+		template<typename TConsumerFactory>
+		void AssertBlockHashesAreCalculatedCorrectly(
+				uint32_t numBlocks,
+				uint32_t numTransactionsPerBlock,
+				TConsumerFactory consumerFactory) {
 			// Arrange:
 			auto registry = CustomBuffersTraits::CreateTransactionRegistry();
 			auto input = CreateBlockConsumerInput(registry, numBlocks, numTransactionsPerBlock);
 			auto& blockElements = input.blocks();
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(registry)(blockElements);
+			auto result = consumerFactory(registry)(blockElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -154,6 +163,12 @@ namespace catapult { namespace consumers {
 			for (const auto& blockElement : blockElements)
 				AssertCorrectHashes(blockElement, numTransactionsPerBlock);
 		}
+
+		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+			AssertBlockHashesAreCalculatedCorrectly(numBlocks, numTransactionsPerBlock, [](const auto& registry) {
+				return CreateBlockHashCalculatorConsumer(registry);
+			});
+		}
 	}
 
 	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
@@ -182,6 +197,14 @@ namespace catapult { namespace consumers {
 		AssertBlockHashesAreCalculatedCorrectly(3, 4);
 	}
 
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactionsInParallel) {
+		// Assert:
+		auto pParallelPolicy = CreateParallelPolicy();
+		AssertBlockHashesAreCalculatedCorrectly(3, 20, [pParallelPolicy](const auto& registry) {
+			return CreateBlockHashCalculatorConsumer(registry, pParallelPolicy);
+		});
+	}
+
 	TEST(BLOCK_TEST_CLASS, CalculatesCorrectHashForDeterministicEntity) {
 		// Arrange:
 		auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -266,14 +289,15 @@ namespace catapult { namespace consumers {
 			return ConsumerInput(std::move(range));
 		}
 
-		void AssertTransactionHashesAreCalculatedCorrectly(uint32_t numTransactions) {
+		template<typename TConsumerFactory>
+		void AssertTransactionHashesAreCalculatedCorrectly(uint32_t numTransactions, TConsumerFactory consumerFactory) {
 			// Arrange:
 			auto registry = CustomBuffersTraits::CreateTransactionRegistry();
 			auto input = CreateTransactionConsumerInput(numTransactions);
 			auto& transactionElements = input.transactions();
 
 			// Act:
-			auto result = CreateTransactionHashCalculatorConsumer(registry)(transactionElements);
+			auto result = consumerFactory(registry)(transactionElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -281,6 +305,11 @@ namespace catapult { namespace consumers {
 			for (const auto& transactionElement : transactionElements)
 				AssertCorrectHash(transactionElement);
 		}
+		void AssertTransactionHashesAreCalculatedCorrectly(uint32_t numTransactions) {
+			AssertTransactionHashesAreCalculatedCorrectly(numTransactions, [](const auto& registry) {
+				return CreateTransactionHashCalculatorConsumer(registry);
+			});
+		}
 	}
 
 	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities) {
@@ -299,6 +328,14 @@ namespace catapult { namespace consumers {
 		AssertTransactionHashesAreCalculatedCorrectly(3);
 	}
 
+	TEST(TRANSACTION_TEST_CLASS, CanProcessMultipleEntitiesInParallel) {
+		// Assert:
+		auto pParallelPolicy = CreateParallelPolicy();
+		AssertTransactionHashesAreCalculatedCorrectly(20, [pParallelPolicy](const auto& registry) {
+			return CreateTransactionHashCalculatorConsumer(registry, pParallelPolicy);
+		});
+	}
+
 	TEST(TRANSACTION_TEST_CLASS, CalculatesCorrectHashForDeterministicEntity) {
 		// Arrange:
 		auto registry = mocks::CreateDefaultTransactionRegistry();
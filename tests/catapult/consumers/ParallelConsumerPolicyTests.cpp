@@ -0,0 +1,187 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/ParallelConsumerPolicy.h"
+#include "catapult/model/Elements.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_set>
+
+namespace catapult { namespace consumers {
+
+#define TEST_CLASS ParallelConsumerPolicyTests
+
+	namespace {
+		class TestContext {
+		public:
+			explicit TestContext(size_t numElements) {
+				for (auto i = 0u; i < numElements; ++i) {
+					m_transactions.push_back(test::GenerateRandomTransaction());
+					m_elements.push_back(model::TransactionElement(*m_transactions.back()));
+				}
+
+				for (auto& element : m_elements)
+					m_elementPointers.push_back(&element);
+			}
+
+		public:
+			const auto& elementPointers() const {
+				return m_elementPointers;
+			}
+
+		public:
+			void assertAllElementsProcessedOnce(const std::vector<std::vector<model::TransactionElement*>>& partitions) const {
+				std::unordered_set<const model::TransactionElement*> processedElements;
+				auto numProcessedElements = 0u;
+				for (const auto& partition : partitions) {
+					processedElements.insert(partition.cbegin(), partition.cend());
+					numProcessedElements += static_cast<uint32_t>(partition.size());
+				}
+
+				EXPECT_EQ(m_elements.size(), numProcessedElements);
+				EXPECT_EQ(m_elements.size(), processedElements.size());
+			}
+
+		private:
+			std::vector<std::unique_ptr<model::Transaction>> m_transactions;
+			std::vector<model::TransactionElement> m_elements;
+			std::vector<model::TransactionElement*> m_elementPointers;
+		};
+
+		auto ProcessAll(const ParallelConsumerPolicy& policy, const TestContext& context, std::set<std::thread::id>& threadIds) {
+			std::mutex mutex;
+			std::vector<std::vector<model::TransactionElement*>> partitions;
+			policy.process(context.elementPointers(), [&mutex, &partitions, &threadIds](auto itBegin, auto itEnd) {
+				std::lock_guard<std::mutex> lock(mutex);
+				partitions.emplace_back(itBegin, itEnd);
+				threadIds.insert(std::this_thread::get_id());
+			});
+
+			return partitions;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreatePolicy) {
+		// Act:
+		ParallelConsumerPolicy policy(nullptr, 10);
+
+		// Assert:
+		EXPECT_EQ(0u, policy.workMicros());
+		EXPECT_EQ(0u, policy.elapsedMicros());
+		EXPECT_EQ(0u, policy.speedupPercentage());
+	}
+
+	TEST(TEST_CLASS, ProcessIgnoresEmptyInput) {
+		// Arrange:
+		ParallelConsumerPolicy policy(nullptr, 10);
+		TestContext context(0);
+		std::set<std::thread::id> threadIds;
+
+		// Act:
+		auto partitions = ProcessAll(policy, context, threadIds);
+
+		// Assert:
+		EXPECT_TRUE(partitions.empty());
+		EXPECT_EQ(0u, policy.elapsedMicros());
+	}
+
+	TEST(TEST_CLASS, ProcessUsesCallingThreadWhenPoolIsNotSet) {
+		// Arrange:
+		ParallelConsumerPolicy policy(nullptr, 2);
+		TestContext context(20);
+		std::set<std::thread::id> threadIds;
+
+		// Act:
+		auto partitions = ProcessAll(policy, context, threadIds);
+
+		// Assert:
+		ASSERT_EQ(1u, partitions.size());
+		EXPECT_EQ(std::set<std::thread::id>{ std::this_thread::get_id() }, threadIds);
+		context.assertAllElementsProcessedOnce(partitions);
+	}
+
+	TEST(TEST_CLASS, ProcessUsesCallingThreadWhenThereIsNotEnoughWorkToSplit) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+		ParallelConsumerPolicy policy(std::move(pPool), 20);
+		TestContext context(20);
+		std::set<std::thread::id> threadIds;
+
+		// Act:
+		auto partitions = ProcessAll(policy, context, threadIds);
+
+		// Assert:
+		ASSERT_EQ(1u, partitions.size());
+		EXPECT_EQ(std::set<std::thread::id>{ std::this_thread::get_id() }, threadIds);
+		context.assertAllElementsProcessedOnce(partitions);
+	}
+
+	namespace {
+		void AssertWorkIsSplitAcrossPool(size_t minPartitionSize, size_t numElements, size_t numExpectedPartitions) {
+			// Arrange:
+			auto pPool = test::CreateStartedIoServiceThreadPool(4);
+			ParallelConsumerPolicy policy(std::move(pPool), minPartitionSize);
+			TestContext context(numElements);
+			std::set<std::thread::id> threadIds;
+
+			// Act:
+			auto partitions = ProcessAll(policy, context, threadIds);
+
+			// Assert:
+			EXPECT_EQ(numExpectedPartitions, partitions.size());
+			EXPECT_EQ(0u, threadIds.count(std::this_thread::get_id()));
+			context.assertAllElementsProcessedOnce(partitions);
+		}
+	}
+
+	TEST(TEST_CLASS, ProcessSplitsWorkIntoPartitionsOfAtLeastMinimumSize) {
+		// Assert:
+		AssertWorkIsSplitAcrossPool(10, 20, 2);
+		AssertWorkIsSplitAcrossPool(10, 29, 2);
+		AssertWorkIsSplitAcrossPool(5, 20, 4);
+	}
+
+	TEST(TEST_CLASS, ProcessSplitsWorkIntoAtMostOnePartitionPerWorkerThread) {
+		// Assert:
+		AssertWorkIsSplitAcrossPool(1, 20, 4);
+		AssertWorkIsSplitAcrossPool(2, 100, 4);
+	}
+
+	TEST(TEST_CLASS, ProcessUpdatesTimings) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoServiceThreadPool(4);
+		ParallelConsumerPolicy policy(std::move(pPool), 1);
+		TestContext context(4);
+
+		// Act: each partition sleeps so that its work is measurable
+		policy.process(context.elementPointers(), [](auto, auto) {
+			test::Sleep(10);
+		});
+
+		// Assert: all four partitions are processed concurrently
+		EXPECT_LE(4u * 10'000, policy.workMicros());
+		EXPECT_LE(10'000u, policy.elapsedMicros());
+		EXPECT_LT(100u, policy.speedupPercentage());
+	}
+}}
@@ -240,4 +240,73 @@ namespace catapult { namespace crypto {
 		// Assert:
 		EXPECT_EQ(expected1, nonAlignedResult);
 	}
+
+	namespace {
+		std::vector<Hash256> CalculateSingleHashes(const std::vector<std::vector<uint8_t>>& dataSets) {
+			std::vector<Hash256> hashes;
+			for (const auto& data : dataSets) {
+				Hash256 hash;
+				Sha3_256(data, hash);
+				hashes.push_back(hash);
+			}
+
+			return hashes;
+		}
+
+		std::vector<Hash256> CalculateMultiHashes(const std::vector<std::vector<uint8_t>>& dataSets) {
+			std::vector<RawBuffer> buffers(dataSets.cbegin(), dataSets.cend());
+			std::vector<Hash256> hashes(dataSets.size());
+			Sha3_256_Multi(buffers.data(), hashes.data(), hashes.size());
+			return hashes;
+		}
+	}
+
+	SHA3_256_TEST(MultiShaMatchesSingleCallVariantForTestVectors) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> dataSets;
+		for (const auto& dataStr : Data_Set_Shorter)
+			dataSets.push_back(test::ToVector(dataStr));
+
+		for (const auto& dataStr : Data_Sets_Long)
+			dataSets.push_back(test::ToVector(dataStr));
+
+		// Act:
+		auto hashes = CalculateMultiHashes(dataSets);
+
+		// Assert:
+		EXPECT_EQ(CalculateSingleHashes(dataSets), hashes);
+	}
+
+	SHA3_256_TEST(MultiShaMatchesSingleCallVariantForDifferentSizes) {
+		// Arrange: include sizes around rate (136) boundaries
+		std::vector<std::vector<uint8_t>> dataSets;
+		for (auto size : { 0u, 1u, 64u, 134u, 135u, 136u, 137u, 271u, 272u, 273u, 1000u, 10'000u, 3u })
+			dataSets.push_back(test::GenerateRandomVector(size));
+
+		// Act:
+		auto hashes = CalculateMultiHashes(dataSets);
+
+		// Assert:
+		EXPECT_EQ(CalculateSingleHashes(dataSets), hashes);
+	}
+
+	SHA3_256_TEST(MultiShaMatchesSingleCallVariantForConcatenatedBuffers) {
+		// Arrange: split each data set into three buffers (the last one is empty for some data sets)
+		std::vector<std::vector<uint8_t>> dataSets;
+		std::vector<RawBuffer> buffers;
+		for (auto size : { 0u, 10u, 100u, 135u, 136u, 200u, 500u }) {
+			dataSets.push_back(test::GenerateRandomVector(size));
+			const auto& data = dataSets.back();
+			buffers.push_back({ data.data(), size / 3 });
+			buffers.push_back({ data.data() + size / 3, size / 2 });
+			buffers.push_back({ data.data() + size / 3 + size / 2, size - size / 3 - size / 2 });
+		}
+
+		// Act:
+		std::vector<Hash256> hashes(dataSets.size());
+		Sha3_256_Multi(buffers.data(), 3, hashes.data(), hashes.size());
+
+		// Assert:
+		EXPECT_EQ(CalculateSingleHashes(dataSets), hashes);
+	}
 }}
@@ -390,4 +390,115 @@ namespace catapult { namespace crypto {
 			EXPECT_EQ(properSignature, result);
 		}
 	}
+
+	// region VerifyMulti
+
+	namespace {
+		struct MultiSignatureContext {
+		public:
+			explicit MultiSignatureContext(size_t count) : Payloads(count), Signatures(count) {
+				auto keyPair = GetDefaultKeyPair();
+				PublicKeys = std::vector<Key>(count, keyPair.publicKey());
+				for (auto i = 0u; i < count; ++i) {
+					Payloads[i] = test::GenerateRandomVector(100 + i);
+					Signatures[i] = SignPayload(keyPair, Payloads[i]);
+				}
+			}
+
+		public:
+			std::vector<SignatureInput> inputs() const {
+				std::vector<SignatureInput> inputs;
+				for (auto i = 0u; i < Payloads.size(); ++i)
+					inputs.emplace_back(PublicKeys[i], Payloads[i], Signatures[i]);
+
+				return inputs;
+			}
+
+		public:
+			std::vector<Key> PublicKeys;
+			std::vector<std::vector<uint8_t>> Payloads;
+			std::vector<Signature> Signatures;
+		};
+
+		void AssertVerifyMultiMatchesVerify(const MultiSignatureContext& context) {
+			// Act:
+			auto inputs = context.inputs();
+			auto results = VerifyMulti(inputs.data(), inputs.size());
+			auto areAllValid = VerifyMultiShortCircuit(inputs.data(), inputs.size());
+
+			// Assert:
+			ASSERT_EQ(inputs.size(), results.size());
+
+			auto expectedAreAllValid = true;
+			for (auto i = 0u; i < inputs.size(); ++i) {
+				auto expectedResult = Verify(inputs[i].PublicKey, inputs[i].DataBuffer, inputs[i].Signature);
+				EXPECT_EQ(expectedResult, results[i]) << "input at " << i;
+				expectedAreAllValid = expectedAreAllValid && expectedResult;
+			}
+
+			EXPECT_EQ(expectedAreAllValid, areAllValid);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenThereAreNoInputs) {
+		// Act:
+		auto results = VerifyMulti(nullptr, 0);
+		auto areAllValid = VerifyMultiShortCircuit(nullptr, 0);
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+		EXPECT_TRUE(areAllValid);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Arrange: use enough inputs to span multiple batches
+		MultiSignatureContext context(150);
+
+		// Act:
+		auto inputs = context.inputs();
+		auto results = VerifyMulti(inputs.data(), inputs.size());
+		auto areAllValid = VerifyMultiShortCircuit(inputs.data(), inputs.size());
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(150, true), results);
+		EXPECT_TRUE(areAllValid);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsOnlyInvalidSignatures) {
+		// Arrange: invalidate inputs at batch boundaries using all kinds of rejections
+		MultiSignatureContext context(150);
+		context.Signatures[0][0] ^= 0xFF; // R part
+		context.Signatures[63][Signature_Size - 1] ^= 0xFF; // S part (not canonical)
+		context.Payloads[64][10] ^= 0xFF; // data
+		context.PublicKeys[100] = GetAlteredKeyPair().publicKey(); // different key
+		context.PublicKeys[128] = Key(); // zero key
+		ScalarAddGroupOrder(context.Signatures[149].data() + Signature_Size / 2); // S part (reducible)
+
+		// Act:
+		auto inputs = context.inputs();
+		auto results = VerifyMulti(inputs.data(), inputs.size());
+		auto areAllValid = VerifyMultiShortCircuit(inputs.data(), inputs.size());
+
+		// Assert:
+		auto expectedResults = std::vector<bool>(150, true);
+		for (auto index : { 0u, 63u, 64u, 100u, 128u, 149u })
+			expectedResults[index] = false;
+
+		EXPECT_EQ(expectedResults, results);
+		EXPECT_FALSE(areAllValid);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiResultsMatchVerifyResults) {
+		// Arrange: randomly corrupt some signatures
+		MultiSignatureContext context(100);
+		for (auto i = 0u; i < 100; ++i) {
+			if (0 == test::RandomByte() % 3)
+				context.Signatures[i][test::RandomByte() % Signature_Size] ^= 0xFF;
+		}
+
+		// Act + Assert:
+		AssertVerifyMultiMatchesVerify(context);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tests/catapult/deltaset/test/BaseSetDeltaTests.h"
+#include "tests/catapult/deltaset/test/BaseSetTests.h"
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		template<typename TMutabilityTraits>
+		using FlatMapTraits = test::BaseSetTraits<
+			TMutabilityTraits,
+			test::FlatMapSetTraits<test::SetElementType<TMutabilityTraits>>>;
+
+		using FlatMapMutableTraits = FlatMapTraits<test::MutableElementValueTraits>;
+		using FlatMapMutablePointerTraits = FlatMapTraits<test::MutableElementPointerTraits>;
+		using FlatMapImmutableTraits = FlatMapTraits<test::ImmutableElementValueTraits>;
+		using FlatMapImmutablePointerTraits = FlatMapTraits<test::ImmutablePointerValueTraits>;
+	}
+
+// base (mutable)
+DEFINE_MUTABLE_BASE_SET_TESTS_FOR(FlatMapMutable);
+DEFINE_MUTABLE_BASE_SET_TESTS_FOR(FlatMapMutablePointer);
+
+// base (immutable)
+DEFINE_IMMUTABLE_BASE_SET_TESTS_FOR(FlatMapImmutable);
+DEFINE_IMMUTABLE_BASE_SET_TESTS_FOR(FlatMapImmutablePointer);
+
+// delta (mutable)
+DEFINE_MUTABLE_BASE_SET_DELTA_TESTS_FOR(FlatMapMutable);
+DEFINE_MUTABLE_BASE_SET_DELTA_TESTS_FOR(FlatMapMutablePointer);
+
+// delta (immutable)
+DEFINE_IMMUTABLE_BASE_SET_DELTA_TESTS_FOR(FlatMapImmutable);
+DEFINE_IMMUTABLE_BASE_SET_DELTA_TESTS_FOR(FlatMapImmutablePointer);
+
+#define TEST_CLASS FlatMapTests
+
+#define MAKE_FLAT_MAP_MUTABLE_TEST(TEST_NAME, TYPE) \
+	TEST(DeltaFlatMap##TYPE##Tests, TEST_NAME) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<test::DeltaTraits<deltaset::FlatMap##TYPE##Traits>>(); \
+	}
+
+#define FLAT_MAP_MUTABLE_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	MAKE_FLAT_MAP_MUTABLE_TEST(TEST_NAME, Mutable) \
+	MAKE_FLAT_MAP_MUTABLE_TEST(TEST_NAME, MutablePointer) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	FLAT_MAP_MUTABLE_TEST(FoundElementsAreStableAcrossCopiesOfOtherElements) {
+		// Arrange:
+		auto pSet = TTraits::CreateBase();
+		auto pDelta = pSet->rebase();
+		for (auto i = 0u; i < 100; ++i)
+			pDelta->insert(TTraits::CreateElement("TestElement", i));
+
+		pSet->commit();
+
+		// Act: find (and copy) the first element and then force the copied elements to grow
+		auto element = TTraits::CreateElement("TestElement", 0);
+		auto pDeltaElement = pDelta->find(TTraits::ToKey(element));
+		for (auto i = 1u; i < 100; ++i)
+			pDelta->find(TTraits::ToKey(TTraits::CreateElement("TestElement", i)));
+
+		// Assert: the first found element was not moved
+		EXPECT_EQ(pDeltaElement, pDelta->find(TTraits::ToKey(element)));
+	}
+}}
@@ -25,6 +25,7 @@
 #include "catapult/deltaset/BaseSetDefaultTraits.h"
 #include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/deltaset/OrderedSet.h"
+#include "catapult/utils/FlatHashMap.h"
 #include "catapult/utils/traits/StlTraits.h"
 #include "tests/TestHarness.h"
 #include <set>
@@ -356,6 +357,11 @@ namespace catapult { namespace test {
 		std::unordered_map<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
 		TestElementToKeyConverter<TElement>>;
 
+	template<typename TElement>
+	using FlatMapSetTraits = deltaset::MapStorageTraits<
+		utils::FlatHashMap<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
+		TestElementToKeyConverter<TElement>>;
+
 	template<typename TMutabilityTraits>
 	using SetElementType = typename std::remove_const<typename TMutabilityTraits::ElementType>::type;
 
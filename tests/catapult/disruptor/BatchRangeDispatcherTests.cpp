@@ -21,6 +21,7 @@
 #include "catapult/disruptor/BatchRangeDispatcher.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/TestHarness.h"
+#include <boost/thread.hpp>
 
 namespace catapult { namespace disruptor {
 
@@ -70,9 +71,44 @@ namespace catapult { namespace disruptor {
 			BatchBlockRangeDispatcher batchDispatcher(dispatcher);
 
 			// Act:
-			batchDispatcher.queue(test::CreateBlockEntityRange(7), InputSource::Local);
+			auto result = batchDispatcher.queue(test::CreateBlockEntityRange(7), InputSource::Local);
 
 			// Assert:
+			EXPECT_TRUE(result);
+			EXPECT_FALSE(batchDispatcher.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, CannotQueueMoreRangesThanQueueCapacity) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto&) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, 4);
+			for (auto i = 0u; i < 4; ++i)
+				EXPECT_TRUE(batchDispatcher.queue(test::CreateBlockEntityRange(1), InputSource::Local)) << i;
+
+			// Act:
+			auto result = batchDispatcher.queue(test::CreateBlockEntityRange(1), InputSource::Local);
+
+			// Assert:
+			EXPECT_FALSE(result);
+			EXPECT_FALSE(batchDispatcher.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, CanQueueRangeAfterDispatchFreesQueueCapacity) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto&) {
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher, 4);
+			for (auto i = 0u; i < 4; ++i)
+				batchDispatcher.queue(test::CreateBlockEntityRange(1), InputSource::Local);
+
+			batchDispatcher.dispatch();
+
+			// Act:
+			auto result = batchDispatcher.queue(test::CreateBlockEntityRange(1), InputSource::Local);
+
+			// Assert:
+			EXPECT_TRUE(result);
 			EXPECT_FALSE(batchDispatcher.empty());
 		});
 	}
@@ -223,5 +259,38 @@ namespace catapult { namespace disruptor {
 		});
 	}
 
+	TEST(TEST_CLASS, DispatchCanForwardRangesQueuedConcurrentlyByMultipleProducers) {
+		// Arrange:
+		RunTestWithConsumerDispatcher([](auto& dispatcher, const auto& inputs) {
+			// - use fewer producers than the dispatcher size because every producer is forwarded as a separate input
+			constexpr auto Num_Producers = 8u;
+			constexpr auto Num_Ranges_Per_Producer = 20u;
+			auto keys = test::GenerateRandomDataVector<Key>(Num_Producers);
+			BatchBlockRangeDispatcher batchDispatcher(dispatcher);
+
+			// Act: each producer queues ranges with increasing heights
+			boost::thread_group threads;
+			for (auto i = 0u; i < Num_Producers; ++i) {
+				threads.create_thread([&batchDispatcher, &key = keys[i]] {
+					for (auto j = 0u; j < Num_Ranges_Per_Producer; ++j)
+						batchDispatcher.queue({ CreateBlockEntityRange(1, Height(j + 1)), key }, InputSource::Remote_Push);
+				});
+			}
+
+			threads.join_all();
+			batchDispatcher.dispatch();
+
+			// Assert: ranges are grouped by producer and ranges of each producer are not reordered
+			AssertNumForwardedInputs(dispatcher, batchDispatcher, inputs, Num_Producers);
+
+			std::vector<Height::ValueType> expectedHeights;
+			for (auto i = 0u; i < Num_Ranges_Per_Producer; ++i)
+				expectedHeights.push_back(i + 1);
+
+			for (const auto& key : keys)
+				AssertDispatchedInput(inputs, InputSource::Remote_Push, expectedHeights, key);
+		});
+	}
+
 	// endregion
 }}
@@ -34,5 +34,7 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(123u, options.DisruptorSize);
 		EXPECT_EQ(1u, options.ElementTraceInterval);
 		EXPECT_TRUE(options.ShouldThrowIfFull);
+		EXPECT_EQ(1000u, options.NumSpinIterations);
+		EXPECT_EQ(100u, options.NumYieldIterations);
 	}
 }}
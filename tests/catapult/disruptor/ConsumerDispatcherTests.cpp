@@ -432,6 +432,77 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region wait strategy
+
+	namespace {
+		ConsumerDispatcherOptions CreateBlockingDispatcherOptions() {
+			auto options = Test_Dispatcher_Options;
+			options.NumSpinIterations = 0;
+			options.NumYieldIterations = 0;
+			return options;
+		}
+	}
+
+	TEST(TEST_CLASS, BlockedConsumersAreWokenUpByNewElements) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(1);
+		auto numInspectorCalls = 0u;
+		ConsumerDispatcher dispatcher(
+				CreateBlockingDispatcherOptions(),
+				{ CreateNoOpConsumer(), CreateNoOpConsumer() },
+				[&numInspectorCalls](const auto&, const auto&) { ++numInspectorCalls; });
+
+		// - wait for all consumers to block
+		test::Pause();
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ONE_EXPR(numInspectorCalls);
+
+		// Assert:
+		EXPECT_EQ(1u, dispatcher.numAddedElements());
+		EXPECT_EQ(1u, numInspectorCalls);
+	}
+
+	TEST(TEST_CLASS, ShutdownWakesUpBlockedConsumers) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(CreateBlockingDispatcherOptions(), { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// - wait for all consumers to block
+		test::Pause();
+
+		// Act:
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
+	TEST(TEST_CLASS, ConsumerIdleTimesAreAccumulated) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(1);
+		auto numInspectorCalls = 0u;
+		ConsumerDispatcher dispatcher(
+				CreateBlockingDispatcherOptions(),
+				{ CreateNoOpConsumer(), CreateNoOpConsumer() },
+				[&numInspectorCalls](const auto&, const auto&) { ++numInspectorCalls; });
+
+		// - let all consumers wait for a while
+		test::Pause();
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ONE_EXPR(numInspectorCalls);
+		auto idleTimes = dispatcher.consumerIdleTimes();
+
+		// Assert: both consumers waited before receiving the element
+		ASSERT_EQ(2u, idleTimes.size());
+		for (auto i = 0u; i < idleTimes.size(); ++i)
+			EXPECT_LT(std::chrono::microseconds(0), idleTimes[i]) << "consumer at " << i;
+	}
+
+	// endregion
+
 	// region element marking
 
 	namespace {
@@ -20,6 +20,7 @@
 
 #include "catapult/disruptor/DisruptorBarrier.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -45,4 +46,39 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	namespace {
+		template<typename TWakeUp>
+		void AssertWaitingConsumerIsWokenUp(TWakeUp wakeUp) {
+			// Arrange:
+			DisruptorBarrier barrier(100, 1);
+			std::atomic_bool isWakeUpSignaled(false);
+			std::atomic<size_t> numWakeUps(0);
+			std::thread waiter([&barrier, &isWakeUpSignaled, &numWakeUps]() {
+				barrier.wait([&isWakeUpSignaled]() { return isWakeUpSignaled.load(); });
+				++numWakeUps;
+			});
+
+			// - wait for the consumer to block
+			test::Pause();
+			auto numWakeUpsBeforeSignal = numWakeUps.load();
+
+			// Act:
+			isWakeUpSignaled = true;
+			wakeUp(barrier);
+			waiter.join();
+
+			// Assert:
+			EXPECT_EQ(0u, numWakeUpsBeforeSignal);
+			EXPECT_EQ(1u, numWakeUps);
+		}
+	}
+
+	TEST(TEST_CLASS, AdvanceWakesUpWaitingConsumer) {
+		AssertWaitingConsumerIsWokenUp([](auto& barrier) { barrier.advance(); });
+	}
+
+	TEST(TEST_CLASS, NotifyAllWakesUpWaitingConsumer) {
+		AssertWaitingConsumerIsWokenUp([](auto& barrier) { barrier.notifyAll(); });
+	}
 }}
@@ -111,9 +111,10 @@ namespace catapult { namespace extensions {
 			counters[counter.id().name()] = counter.value();
 
 		// Assert:
-		ASSERT_EQ(2u, counters.size());
+		ASSERT_EQ(3u, counters.size());
 		EXPECT_EQ(3u, counters.at("XYZ ELEM TOT"));
 		EXPECT_EQ(2u, counters.at("XYZ ELEM ACT"));
+		EXPECT_EQ(1u, counters.count("XYZ IDLE MS"));
 
 		// Cleanup:
 		isElementCallbackUnblocked.state()->set();
@@ -35,6 +35,7 @@ namespace catapult { namespace extensions {
 		auto config = test::CreateUninitializedLocalNodeConfiguration();
 		const_cast<uint32_t&>(config.BlockChain.BlockPruneInterval) = 15;
 		const_cast<bool&>(config.Node.ShouldUseCacheDatabaseStorage) = true;
+		const_cast<bool&>(config.Node.ShouldCalculateCacheStateRoots) = true;
 		const_cast<std::string&>(config.User.DataDirectory) = "base_data_dir";
 
 		// Act:
@@ -47,6 +48,7 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(15u, pluginManager.config().BlockPruneInterval);
 		EXPECT_TRUE(pluginManager.storageConfig().PreferCacheDatabase);
 		EXPECT_EQ("base_data_dir/statedb", pluginManager.storageConfig().CacheDatabaseDirectory);
+		EXPECT_TRUE(pluginManager.storageConfig().ShouldCalculateStateRoots);
 
 		// - resources path should be correct
 		EXPECT_EQ("resources path", bootstrapper.resourcesPath());
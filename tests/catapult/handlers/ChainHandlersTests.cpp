@@ -165,7 +165,7 @@ namespace catapult { namespace handlers {
 				PullBlocksHandlerConfiguration config;
 				config.MaxBlocks = 100;
 				config.MaxResponseBytes = 10 * 1024 * 1024;
-				RegisterPullBlocksHandler(handlers, storage, config);
+				RegisterPullBlocksHandler(handlers, storage, config, [](auto, auto) {});
 			}
 		};
 
@@ -394,7 +394,7 @@ namespace catapult { namespace handlers {
 			// Arrange:
 			ionet::ServerPacketHandlers handlers;
 			auto pStorage = CreateStorage(numBlocks);
-			RegisterPullBlocksHandler(handlers, *pStorage, config);
+			RegisterPullBlocksHandler(handlers, *pStorage, config, [](auto, auto) {});
 
 			// Act:
 			ionet::ServerPacketHandlerContext context({}, "");
@@ -477,6 +477,109 @@ namespace catapult { namespace handlers {
 		AssertCanRetrieveBlocks(12, 5, 10 * 1024 * 1024, Height(12), { Height(12) });
 	}
 
+	namespace {
+		class PullBlocksPrefetchTestContext {
+		public:
+			PullBlocksPrefetchTestContext() : m_pStorage(CreateStorage(12)) {
+				PullBlocksHandlerConfiguration config;
+				config.MaxBlocks = 5;
+				config.MaxResponseBytes = 10 * 1024 * 1024;
+				RegisterPullBlocksHandler(m_handlers, *m_pStorage, config, [&prefetchRanges = m_prefetchRanges](auto height, auto numBlocks) {
+					prefetchRanges.emplace_back(height, numBlocks);
+				});
+			}
+
+		public:
+			const auto& prefetchRanges() const {
+				return m_prefetchRanges;
+			}
+
+		public:
+			void process(const Key& key, Height height, uint32_t numBlocks) {
+				auto pRequest = ionet::CreateSharedPacket<api::PullBlocksRequest>();
+				pRequest->Height = height;
+				pRequest->NumBlocks = numBlocks;
+				pRequest->NumResponseBytes = 10 * 1024 * 1024;
+
+				ionet::ServerPacketHandlerContext context(key, "");
+				EXPECT_TRUE(m_handlers.process(*pRequest, context));
+				EXPECT_TRUE(context.hasResponse());
+			}
+
+		private:
+			ionet::ServerPacketHandlers m_handlers;
+			std::unique_ptr<io::BlockStorageCache> m_pStorage;
+			std::vector<std::pair<Height, uint32_t>> m_prefetchRanges;
+		};
+	}
+
+	TEST(TEST_CLASS, PullBlocksHandler_DoesNotPrefetchBlocksForFirstRequest) {
+		// Arrange:
+		PullBlocksPrefetchTestContext context;
+
+		// Act:
+		context.process(Key(), Height(3), 3);
+
+		// Assert:
+		EXPECT_TRUE(context.prefetchRanges().empty());
+	}
+
+	TEST(TEST_CLASS, PullBlocksHandler_PrefetchesBlocksFollowingConsecutiveRequest) {
+		// Arrange:
+		PullBlocksPrefetchTestContext context;
+		context.process(Key(), Height(3), 3);
+
+		// Act:
+		context.process(Key(), Height(6), 2);
+
+		// Assert: the range following the returned blocks was prefetched
+		ASSERT_EQ(1u, context.prefetchRanges().size());
+		EXPECT_EQ(Height(8), context.prefetchRanges()[0].first);
+		EXPECT_EQ(2u, context.prefetchRanges()[0].second);
+	}
+
+	TEST(TEST_CLASS, PullBlocksHandler_DoesNotPrefetchBlocksForNonConsecutiveRequest) {
+		// Arrange:
+		PullBlocksPrefetchTestContext context;
+		context.process(Key(), Height(3), 3);
+
+		// Act: skip a block and then repeat a request
+		context.process(Key(), Height(7), 2);
+		context.process(Key(), Height(7), 2);
+
+		// Assert:
+		EXPECT_TRUE(context.prefetchRanges().empty());
+	}
+
+	TEST(TEST_CLASS, PullBlocksHandler_TracksRequestsOfEachClientIndependently) {
+		// Arrange:
+		PullBlocksPrefetchTestContext context;
+		auto key1 = test::GenerateRandomData<Key_Size>();
+		auto key2 = test::GenerateRandomData<Key_Size>();
+		context.process(key1, Height(3), 3);
+
+		// Act: the first request of the second client continues the range of the first client
+		context.process(key2, Height(6), 3);
+		context.process(key1, Height(6), 3);
+
+		// Assert: only the request of the first client continued its own range
+		ASSERT_EQ(1u, context.prefetchRanges().size());
+		EXPECT_EQ(Height(9), context.prefetchRanges()[0].first);
+		EXPECT_EQ(3u, context.prefetchRanges()[0].second);
+	}
+
+	TEST(TEST_CLASS, PullBlocksHandler_DoesNotPrefetchBlocksAboveChainHeight) {
+		// Arrange:
+		PullBlocksPrefetchTestContext context;
+		context.process(Key(), Height(7), 3);
+
+		// Act: return the last blocks in the chain
+		context.process(Key(), Height(10), 3);
+
+		// Assert:
+		EXPECT_TRUE(context.prefetchRanges().empty());
+	}
+
 	namespace {
 		void AssertCanRetrieveBlocksWithNumBlocksClamping(
 				size_t numBlocks,
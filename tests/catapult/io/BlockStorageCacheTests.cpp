@@ -322,6 +322,179 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region caching
+
+	namespace {
+		// size of a cached block element created by CreateMemoryBasedStorage (excluding nemesis)
+		constexpr size_t Cached_Block_Size = sizeof(model::BlockElement) + sizeof(model::Block);
+
+		void LoadBlocks(const BlockStorageCache& cache, std::initializer_list<Height::ValueType> heights) {
+			auto view = cache.view();
+			for (auto height : heights)
+				view.loadBlockElement(Height(height));
+		}
+
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t numHits, uint64_t numMisses, uint64_t numEvictedBytes) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numEvictedBytes, statistics.NumEvictedBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, InitiallyCacheStatisticsAreZero) {
+		// Act:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementCachesLoadedElement) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(5));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(5));
+
+		// Assert: the second load is served from memory
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		AssertStatistics(cache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockAndLoadBlockElementShareCachedElement) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+
+		// Act:
+		auto pBlock = cache.view().loadBlock(Height(5));
+		auto pBlockElement = cache.view().loadBlockElement(Height(5));
+
+		// Assert:
+		EXPECT_EQ(&pBlockElement->Block, pBlock.get());
+		AssertStatistics(cache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, SavedBlocksAreCached) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		for (auto i = 0u; i < 3; ++i) {
+			blocks.push_back(test::GenerateVerifiableBlockAtHeight(Height(Delegation_Chain_Size + i + 1)));
+			blockElements.push_back(test::BlockToBlockElement(*blocks.back(), test::GenerateRandomData<Hash256_Size>()));
+		}
+
+		cache.modifier().saveBlocks(blockElements);
+
+		// Act:
+		LoadBlocks(cache, { Delegation_Chain_Size + 1, Delegation_Chain_Size + 2, Delegation_Chain_Size + 3 });
+
+		// Assert:
+		AssertStatistics(cache, 3, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUsedBlocksAreEvictedWhenCacheIsFull) {
+		// Arrange: make room for three blocks
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), 3 * Cached_Block_Size);
+		LoadBlocks(cache, { 2, 3, 4, 2 });
+
+		// Act: block 3 is least recently used
+		LoadBlocks(cache, { 5 });
+
+		// Assert:
+		AssertStatistics(cache, 1, 4, Cached_Block_Size);
+
+		LoadBlocks(cache, { 2, 4, 5 });
+		AssertStatistics(cache, 4, 4, Cached_Block_Size);
+
+		LoadBlocks(cache, { 3 });
+		AssertStatistics(cache, 4, 5, 2 * Cached_Block_Size);
+	}
+
+	TEST(TEST_CLASS, BlocksLargerThanCacheAreNotCached) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), Cached_Block_Size - 1);
+
+		// Act:
+		LoadBlocks(cache, { 2, 2, 2 });
+
+		// Assert:
+		AssertStatistics(cache, 0, 3, 0);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterRemovesCachedBlocksAboveHeight) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+		LoadBlocks(cache, { 5, 6, 7 });
+
+		// Act: drop block 6 and replace it with a different block
+		cache.modifier().dropBlocksAfter(Height(5));
+
+		auto pBlock = test::GenerateVerifiableBlockAtHeight(Height(6));
+		auto blockHash = test::GenerateRandomData<Hash256_Size>();
+		cache.modifier().saveBlock(test::BlockToBlockElement(*pBlock, blockHash));
+
+		auto pBlockElement = cache.view().loadBlockElement(Height(6));
+		LoadBlocks(cache, { 5 });
+
+		// Assert: dropped blocks are not counted as evicted
+		EXPECT_EQ(blockHash, pBlockElement->EntityHash);
+		EXPECT_EQ(*pBlock, pBlockElement->Block);
+		AssertStatistics(cache, 2, 3, 0);
+	}
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchLoadsBlocksIntoCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+
+		// Act:
+		cache.view().prefetch(Height(3), 4);
+
+		// Assert: prefetching is neither a hit nor a miss
+		AssertStatistics(cache, 0, 0, 0);
+
+		LoadBlocks(cache, { 3, 4, 5, 6 });
+		AssertStatistics(cache, 4, 0, 0);
+
+		LoadBlocks(cache, { 2, 7 });
+		AssertStatistics(cache, 4, 2, 0);
+	}
+
+	TEST(TEST_CLASS, PrefetchIgnoresBlocksAboveChainHeight) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size));
+
+		// Act:
+		cache.view().prefetch(Height(Delegation_Chain_Size - 1), 10);
+		cache.view().prefetch(Height(Delegation_Chain_Size + 1), 10);
+
+		// Assert:
+		LoadBlocks(cache, { Delegation_Chain_Size - 1, Delegation_Chain_Size });
+		AssertStatistics(cache, 2, 0, 0);
+	}
+
+	TEST(TEST_CLASS, PrefetchDoesNotChangeUsageOrderOfCachedBlocks) {
+		// Arrange: make room for three blocks
+		BlockStorageCache cache(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), 3 * Cached_Block_Size);
+		LoadBlocks(cache, { 2, 3, 4 });
+
+		// Act: prefetching block 2 should not prevent it from being evicted
+		cache.view().prefetch(Height(2), 1);
+		LoadBlocks(cache, { 5 });
+
+		// Assert:
+		LoadBlocks(cache, { 3, 4, 5 });
+		AssertStatistics(cache, 3, 4, Cached_Block_Size);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
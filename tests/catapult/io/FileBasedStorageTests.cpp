@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/PodIoUtils.h"
 #include "tests/catapult/io/test/BlockStorageTestUtils.h"
 #include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
@@ -95,6 +96,68 @@ namespace catapult { namespace io {
 		test::AssertEqual(element2, *pBlockElement2);
 	}
 
+	// region resident height and hashes
+
+	namespace {
+		std::vector<Hash256> ToVector(const model::HashRange& hashes) {
+			return std::vector<Hash256>(hashes.cbegin(), hashes.cend());
+		}
+	}
+
+	TEST(TEST_CLASS, ChainHeightIsNotReadFromJournalAfterCreation) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<FileBasedTraits>(10);
+
+		// Act: overwrite the journal
+		{
+			RawFile file(pStorage.pTempDirectoryGuard->name() + "/index.dat", OpenMode::Read_Write, LockMode::None);
+			Write64(file, 5);
+		}
+
+		// Assert: resident height is unchanged but a new storage sees the new height
+		EXPECT_EQ(Height(10), pStorage->chainHeight());
+		EXPECT_EQ(Height(5), FileBasedTraits::OpenStorage(pStorage.pTempDirectoryGuard->name())->chainHeight());
+	}
+
+	TEST(TEST_CLASS, HashesAreNotReadFromHashFilesAfterFirstLoad) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<FileBasedTraits>(10);
+		auto expectedHashes = ToVector(pStorage->loadHashesFrom(Height(2), 9));
+
+		// Act: delete the hash file
+		boost::filesystem::remove(pStorage.pTempDirectoryGuard->name() + "/00000/hashes.dat");
+		auto hashes = ToVector(pStorage->loadHashesFrom(Height(2), 9));
+
+		// Assert:
+		ASSERT_EQ(9u, hashes.size());
+		EXPECT_EQ(expectedHashes, hashes);
+	}
+
+	TEST(TEST_CLASS, ResidentHashesAreUpdatedWhenBlocksAreDroppedAndSaved) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<FileBasedTraits>(10);
+		auto originalHashes = ToVector(pStorage->loadHashesFrom(Height(6), 5));
+
+		// Act: drop blocks and save a block with a different hash
+		pStorage->dropBlocksAfter(Height(7));
+		auto hashesAfterDrop = ToVector(pStorage->loadHashesFrom(Height(6), 5));
+
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(8));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		pStorage->saveBlock(blockElement);
+		auto hashesAfterSave = ToVector(pStorage->loadHashesFrom(Height(6), 5));
+
+		// Assert:
+		EXPECT_EQ(std::vector<Hash256>(originalHashes.cbegin(), originalHashes.cbegin() + 2), hashesAfterDrop);
+		EXPECT_EQ(std::vector<Hash256>({ originalHashes[0], originalHashes[1], blockElement.EntityHash }), hashesAfterSave);
+
+		// - the hashes were persisted
+		auto pReopenedStorage = FileBasedTraits::OpenStorage(pStorage.pTempDirectoryGuard->name());
+		EXPECT_EQ(hashesAfterSave, ToVector(pReopenedStorage->loadHashesFrom(Height(6), 5)));
+	}
+
+	// endregion
+
 	namespace {
 		// note: for test purposes, hardcoded 00000 dir is ok
 		auto GetPath(const std::string& baseDirectory, uint64_t height) {
@@ -93,6 +93,29 @@ namespace catapult { namespace io {
 		EXPECT_EQ(inputData.size(), r.position());
 	}
 
+	WRITING_TRAITS_BASED_TEST(CanFlushWrittenData) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+
+		// Act:
+		{
+			RawFile r(guard.name(), TTraits::Mode);
+			r.write(inputData);
+			r.flush();
+
+			// Assert:
+			EXPECT_EQ(inputData.size(), r.size());
+			EXPECT_EQ(inputData.size(), r.position());
+		}
+
+		// - flushed data can be read
+		RawFile r(guard.name(), OpenMode::Read_Only);
+		std::vector<uint8_t> result(Default_Bytes_Written);
+		r.read(result);
+		EXPECT_EQ(inputData, result);
+	}
+
 	TEST(TEST_CLASS, WriteOnReadOnlyFileThrowsException) {
 		// Arrange:
 		TempFileGuard guard("test.dat");
@@ -0,0 +1,313 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/io/SegmentedFileStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "tests/catapult/io/test/BlockStorageTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+using catapult::test::TempDirectoryGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS SegmentedFileStorageTests
+
+	namespace {
+		// use small segments so that tests cross segment boundaries
+		// (65529 is a multiple of the segment size, which allows faking the chain height in LoadHashesFrom_LoadsCanCrossIndexFileBoundary)
+		constexpr uint32_t Blocks_Per_Segment = 3;
+
+		std::string GetSegmentsDirectory(const std::string& baseDirectory) {
+			return baseDirectory + "/segments";
+		}
+
+		struct SegmentedTraits {
+			using Guard = TempDirectoryGuard;
+			using StorageType = SegmentedFileStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(GetSegmentsDirectory(destination), Blocks_Per_Segment);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				auto pStorage = OpenStorage(destination);
+				if (Height() != height) {
+					// abuse drop blocks to fake current height (the block at height is the first block of a segment)
+					pStorage->dropBlocksAfter(height - Height(1));
+					return pStorage;
+				}
+
+				// convert a file-based storage containing the nemesis block
+				test::PrepareStorage(destination);
+				ConvertToSegmentedStorage(FileBasedStorage(destination), *pStorage);
+				return pStorage;
+			}
+		};
+
+		bool SegmentFileExists(const std::string& baseDirectory, const std::string& filename) {
+			return boost::filesystem::exists(GetSegmentsDirectory(baseDirectory) + "/" + filename);
+		}
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(SegmentedTraits)
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateStorageWithZeroBlocksPerSegment) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+
+		// Act + Assert:
+		EXPECT_THROW(SegmentedFileStorage(tempDir.name(), 0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, StorageIsInitiallyEmpty) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+
+		// Act:
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(0), pStorage->chainHeight());
+		EXPECT_TRUE(pStorage->loadHashesFrom(Height(1), 10).empty());
+	}
+
+	// endregion
+
+	// region save + load
+
+	TEST(TEST_CLASS, CanReadSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange: save blocks spanning four segments
+		TempDirectoryGuard tempDir;
+		std::vector<model::BlockElement> elements;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		{
+			auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+			for (auto height = 2u; height <= 12; ++height) {
+				blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(height % 4 + 1, height));
+				elements.push_back(test::CreateBlockElementForSaveTests(*blocks.back()));
+				pStorage->saveBlock(elements.back());
+			}
+		}
+
+		// Act:
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(12), pStorage->chainHeight());
+		for (auto height = 2u; height <= 12; ++height) {
+			auto pBlockElement = pStorage->loadBlockElement(Height(height));
+			test::AssertEqual(elements[height - 2], *pBlockElement);
+		}
+	}
+
+	TEST(TEST_CLASS, BlocksAreAppendedToSegmentFiles) {
+		// Act: segments contain heights 1 - 3, 4 - 6, 7 - 9, 10 - 12
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(12);
+
+		// Assert:
+		const auto& baseDirectory = pStorage.pTempDirectoryGuard->name();
+		for (const auto* pSegmentName : { "00000", "00001", "00002", "00003" }) {
+			EXPECT_TRUE(SegmentFileExists(baseDirectory, std::string(pSegmentName) + ".blocks")) << pSegmentName;
+			EXPECT_TRUE(SegmentFileExists(baseDirectory, std::string(pSegmentName) + ".index")) << pSegmentName;
+		}
+
+		EXPECT_FALSE(SegmentFileExists(baseDirectory, "00004.blocks"));
+		EXPECT_FALSE(SegmentFileExists(baseDirectory, "00004.index"));
+
+		auto numFiles = std::distance(
+				boost::filesystem::directory_iterator(GetSegmentsDirectory(baseDirectory)),
+				boost::filesystem::directory_iterator());
+		EXPECT_EQ(9, numFiles);
+	}
+
+	TEST(TEST_CLASS, CanLoadBlockSavedAfterSegmentWasMapped) {
+		// Arrange: map the third segment by loading a block from it
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(7);
+		pStorage->loadBlockElement(Height(7));
+
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(8));
+		auto expectedBlockElement = test::CreateBlockElementForSaveTests(*pBlock);
+
+		// Act:
+		pStorage->saveBlock(expectedBlockElement);
+		auto pBlockElement = pStorage->loadBlockElement(Height(8));
+
+		// Assert:
+		test::AssertEqual(expectedBlockElement, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CanOverwriteBlocksWithDifferentSizes) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(9);
+		auto pBlock5 = pStorage->loadBlockElement(Height(5));
+
+		// Act: drop blocks (within a segment) and save blocks with a different number of transactions in their place
+		pStorage->dropBlocksAfter(Height(5));
+
+		std::vector<model::BlockElement> elements;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		for (auto height = 6u; height <= 11; ++height) {
+			blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(height - 5, height));
+			elements.push_back(test::CreateBlockElementForSaveTests(*blocks.back()));
+			pStorage->saveBlock(elements.back());
+		}
+
+		// Assert:
+		EXPECT_EQ(Height(11), pStorage->chainHeight());
+		test::AssertEqual(*pBlock5, *pStorage->loadBlockElement(Height(5)));
+		for (auto height = 6u; height <= 11; ++height)
+			test::AssertEqual(elements[height - 6], *pStorage->loadBlockElement(Height(height)));
+	}
+
+	// endregion
+
+	// region pruneBlocksBefore
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DropsDataOfSegmentsBeforeHeight) {
+		// Arrange: segments contain heights 1 - 3, 4 - 6, 7 - 9, 10 - 12, 13 - 15, 16 - 17
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(17);
+		const auto& baseDirectory = pStorage.pTempDirectoryGuard->name();
+
+		// Act: prune will remove the segments with heights 4 - 12
+		pStorage->pruneBlocksBefore(Height(13));
+
+		// Assert:
+		EXPECT_EQ(Height(17), pStorage->chainHeight());
+		EXPECT_TRUE(SegmentFileExists(baseDirectory, "00000.blocks"));
+		EXPECT_FALSE(SegmentFileExists(baseDirectory, "00001.blocks"));
+		EXPECT_FALSE(SegmentFileExists(baseDirectory, "00002.blocks"));
+		EXPECT_FALSE(SegmentFileExists(baseDirectory, "00003.blocks"));
+		EXPECT_TRUE(SegmentFileExists(baseDirectory, "00004.blocks"));
+
+		EXPECT_TRUE(!!pStorage->loadBlock(Height(1)));
+		EXPECT_THROW(pStorage->loadBlock(Height(7)), catapult_runtime_error);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(12)), catapult_runtime_error);
+		EXPECT_TRUE(!!pStorage->loadBlockElement(Height(13)));
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DoesNotDropSegmentContainingHeight) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(17);
+
+		// Act: prune will only remove the segments with heights 4 - 9
+		pStorage->pruneBlocksBefore(Height(11));
+
+		// Assert:
+		EXPECT_THROW(pStorage->loadBlock(Height(9)), catapult_runtime_error);
+		for (auto height = 10u; height <= 17; ++height)
+			EXPECT_TRUE(!!pStorage->loadBlock(Height(height))) << height;
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_KeepsHashesOfPrunedBlocks) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(17);
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(13));
+		auto hashes = pStorage->loadHashesFrom(Height(4), 12);
+
+		// Assert:
+		ASSERT_EQ(12u, hashes.size());
+		auto height = 4u;
+		for (const auto& hash : hashes) {
+			auto expectedHash = Hash256();
+			expectedHash[Hash256_Size - 1] = static_cast<uint8_t>(height++);
+			EXPECT_EQ(expectedHash, hash);
+		}
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_ThrowsAtHeightAfterChainHeight) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(5);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->pruneBlocksBefore(Height(10)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region ConvertToSegmentedStorage
+
+	TEST(TEST_CLASS, ConvertToSegmentedStorage_CanConvertNemesisBlock) {
+		// Arrange:
+#ifdef SIGNATURE_SCHEME_NIS1
+		constexpr auto Source_Directory = "../seed/mijin-test.nis1";
+#else
+		constexpr auto Source_Directory = "../seed/mijin-test";
+#endif
+
+		TempDirectoryGuard tempDir;
+		FileBasedStorage source(Source_Directory);
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+
+		// Act:
+		auto numBlocks = ConvertToSegmentedStorage(source, *pStorage);
+
+		// Assert:
+		EXPECT_EQ(1u, numBlocks);
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+		test::AssertEqual(*source.loadBlockElement(Height(1)), *pStorage->loadBlockElement(Height(1)));
+	}
+
+	TEST(TEST_CLASS, ConvertToSegmentedStorage_CopiesAllBlocksNotContainedInDestination) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		mocks::MockMemoryBasedStorage source;
+		test::SeedBlocks(source, 12);
+
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+		for (auto height = 1u; height <= 7; ++height)
+			pStorage->saveBlock(*source.loadBlockElement(Height(height)));
+
+		// Act:
+		auto numBlocks = ConvertToSegmentedStorage(source, *pStorage);
+
+		// Assert:
+		EXPECT_EQ(5u, numBlocks);
+		EXPECT_EQ(Height(12), pStorage->chainHeight());
+		for (auto height = 1u; height <= 12; ++height)
+			test::AssertEqual(*source.loadBlockElement(Height(height)), *pStorage->loadBlockElement(Height(height)));
+	}
+
+	TEST(TEST_CLASS, ConvertToSegmentedStorage_HasNoEffectWhenDestinationContainsAllBlocks) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		mocks::MockMemoryBasedStorage source;
+		test::SeedBlocks(source, 5);
+
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+		ConvertToSegmentedStorage(source, *pStorage);
+
+		// Act:
+		auto numBlocks = ConvertToSegmentedStorage(source, *pStorage);
+
+		// Assert:
+		EXPECT_EQ(0u, numBlocks);
+		EXPECT_EQ(Height(5), pStorage->chainHeight());
+	}
+
+	// endregion
+}}
@@ -441,6 +441,9 @@ namespace catapult { namespace test {
 
 #define DEFINE_BLOCK_STORAGE_TESTS(TRAITS_NAME) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, StorageSeedInitiallyContainsNemesisBlock) \
+	DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(TRAITS_NAME)
+
+#define DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(TRAITS_NAME) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, SavingBlockWithHeightHigherThanChainHeightAltersChainHeight) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanOverwriteBlockWithSameData) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanOverwriteBlockWithDifferentData) \
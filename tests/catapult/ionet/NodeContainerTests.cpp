@@ -561,6 +561,61 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region versioning
+
+	TEST(TEST_CLASS, ViewDoesNotObserveChangesMadeAfterItWasCreated) {
+		// Arrange:
+		NodeContainer container;
+		auto keys = SeedThreeNodes(container);
+		auto view = container.view();
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.add(test::CreateNamedNode(test::GenerateRandomData<Key_Size>(), "dolly"), NodeSource::Dynamic);
+			modifier.provisionConnectionState(ServiceIdentifier(123), keys[0]).Age = 7;
+		}
+
+		// Assert:
+		EXPECT_EQ(3u, view.size());
+		EXPECT_FALSE(!!view.getNodeInfo(keys[0]).getConnectionState(ServiceIdentifier(123)));
+	}
+
+	TEST(TEST_CLASS, ViewObservesChangesMadeByDestroyedModifiers) {
+		// Arrange:
+		NodeContainer container;
+		auto keys = SeedThreeNodes(container);
+
+		// Act:
+		{
+			auto modifier = container.modifier();
+			modifier.add(test::CreateNamedNode(test::GenerateRandomData<Key_Size>(), "dolly"), NodeSource::Dynamic);
+			modifier.provisionConnectionState(ServiceIdentifier(123), keys[0]).Age = 7;
+		}
+
+		auto view = container.view();
+
+		// Assert:
+		EXPECT_EQ(4u, view.size());
+		EXPECT_EQ(7u, view.getNodeInfo(keys[0]).getConnectionState(ServiceIdentifier(123))->Age);
+	}
+
+	TEST(TEST_CLASS, ViewDoesNotObserveChangesMadeByActiveModifier) {
+		// Arrange:
+		NodeContainer container;
+		auto keys = SeedThreeNodes(container);
+		auto modifier = container.modifier();
+		modifier.add(test::CreateNamedNode(test::GenerateRandomData<Key_Size>(), "dolly"), NodeSource::Dynamic);
+
+		// Act:
+		auto view = container.view();
+
+		// Assert:
+		EXPECT_EQ(3u, view.size());
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -569,7 +624,7 @@ namespace catapult { namespace ionet {
 		}
 	}
 
-	DEFINE_LOCK_PROVIDER_TESTS(TEST_CLASS)
+	DEFINE_VERSIONED_SNAPSHOT_PROVIDER_TESTS(TEST_CLASS)
 
 	// endregion
 }}
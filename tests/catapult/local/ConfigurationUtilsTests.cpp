@@ -31,6 +31,7 @@ namespace catapult { namespace local {
 		auto config = config::NodeConfiguration::Uninitialized();
 		config.UnconfirmedTransactionsCacheMaxResponseSize = utils::FileSize::FromKilobytes(4);
 		config.UnconfirmedTransactionsCacheMaxSize = 234;
+		config.ShouldPrioritizeUnconfirmedTransactionsByFee = true;
 
 		// Act:
 		auto options = GetUtCacheOptions(config);
@@ -38,5 +39,6 @@ namespace catapult { namespace local {
 		// Assert:
 		EXPECT_EQ(4096u, options.MaxResponseSize);
 		EXPECT_EQ(234u, options.MaxCacheSize);
+		EXPECT_TRUE(options.ShouldPrioritizeByFee);
 	}
 }}
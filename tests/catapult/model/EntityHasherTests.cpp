@@ -361,4 +361,51 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region UpdateHashes (transaction elements)
+
+	TEST(TEST_CLASS, UpdateHashes_TransactionElementsHashesAreEqualToSingleElementHashes) {
+		// Arrange: use a count that is not a multiple of the number of parallel hash lanes
+		auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+				mocks::OffsetRange{ 6, 10 },
+				std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 } });
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(std::move(pPlugin));
+
+		std::vector<std::unique_ptr<Transaction>> transactions;
+		std::vector<TransactionElement> expectedTransactionElements;
+		std::vector<TransactionElement> transactionElements;
+		for (auto i = 0u; i < 7; ++i) {
+			transactions.push_back(test::GenerateRandomTransaction());
+			expectedTransactionElements.emplace_back(*transactions.back());
+			transactionElements.emplace_back(*transactions.back());
+		}
+
+		for (auto& transactionElement : expectedTransactionElements)
+			UpdateHashes(registry, transactionElement);
+
+		// Act:
+		std::vector<TransactionElement*> transactionElementPointers;
+		for (auto& transactionElement : transactionElements)
+			transactionElementPointers.push_back(&transactionElement);
+
+		UpdateHashes(registry, transactionElementPointers);
+
+		// Assert:
+		for (auto i = 0u; i < transactionElements.size(); ++i) {
+			auto message = "transaction at " + std::to_string(i);
+			EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << message;
+			EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash) << message;
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateZeroTransactionElements) {
+		// Arrange:
+		auto registry = TransactionRegistry();
+
+		// Act + Assert: no exception
+		UpdateHashes(registry, std::vector<TransactionElement*>());
+	}
+
+	// endregion
 }}
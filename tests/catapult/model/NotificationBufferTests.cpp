@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/model/NotificationBuffer.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/core/mocks/MockNotificationSubscriber.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationBufferTests
+
+	TEST(TEST_CLASS, BufferIsInitiallyEmpty) {
+		// Act:
+		NotificationBuffer buffer;
+		mocks::MockNotificationSubscriber sub;
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(0u, sub.numNotifications());
+	}
+
+	TEST(TEST_CLASS, CanReplayBufferedNotificationsInOrder) {
+		// Arrange:
+		auto sender = test::GenerateRandomData<Key_Size>();
+		auto recipient = test::GenerateRandomData<Address_Decoded_Size>();
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+
+		NotificationBuffer buffer;
+		buffer.notify(AccountPublicKeyNotification(sender));
+		buffer.notify(BalanceTransferNotification(sender, recipient, MosaicId(123), Amount(234)));
+		buffer.notify(AccountAddressNotification(address));
+
+		// Act:
+		mocks::MockNotificationSubscriber sub;
+		buffer.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(3u, buffer.size());
+		ASSERT_EQ(3u, sub.numNotifications());
+		EXPECT_EQ(Core_Register_Account_Public_Key_Notification, sub.notificationTypes()[0]);
+		EXPECT_EQ(Core_Balance_Transfer_Notification, sub.notificationTypes()[1]);
+		EXPECT_EQ(Core_Register_Account_Address_Notification, sub.notificationTypes()[2]);
+
+		EXPECT_TRUE(sub.contains(sender));
+		EXPECT_TRUE(sub.contains(sender, recipient, MosaicId(123), Amount(234)));
+		EXPECT_TRUE(sub.contains(address));
+	}
+
+	TEST(TEST_CLASS, CanReplayBufferedNotificationsMultipleTimes) {
+		// Arrange:
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+
+		NotificationBuffer buffer;
+		buffer.notify(AccountPublicKeyNotification(publicKey));
+		buffer.notify(AccountAddressNotification(address));
+
+		// Act:
+		mocks::MockNotificationSubscriber sub1;
+		buffer.replay(sub1);
+		mocks::MockNotificationSubscriber sub2;
+		buffer.replay(sub2);
+
+		// Assert:
+		EXPECT_EQ(2u, buffer.size());
+		EXPECT_EQ(sub1.notificationTypes(), sub2.notificationTypes());
+		EXPECT_EQ(1u, sub2.numKeys());
+		EXPECT_EQ(1u, sub2.numAddresses());
+		EXPECT_TRUE(sub2.contains(publicKey));
+		EXPECT_TRUE(sub2.contains(address));
+	}
+
+	TEST(TEST_CLASS, CannotBufferNotificationWithInvalidSize) {
+		// Arrange:
+		NotificationBuffer buffer;
+		Notification notification(Core_Register_Account_Address_Notification, sizeof(Notification) - 1);
+
+		// Act + Assert:
+		EXPECT_THROW(buffer.notify(notification), catapult_invalid_argument);
+		EXPECT_EQ(0u, buffer.size());
+	}
+}}
@@ -34,7 +34,7 @@ namespace catapult { namespace model {
 
 		class MockNotificationPublisher : public NotificationPublisher {
 		public:
-			enum class Mode { Address, Public_Key, Other };
+			enum class Mode { Address, Public_Key, Signature, Other };
 
 		public:
 			explicit MockNotificationPublisher(Mode mode) : m_mode(mode)
@@ -52,6 +52,10 @@ namespace catapult { namespace model {
 				} else if (Mode::Public_Key == m_mode) {
 					sub.notify(AccountPublicKeyNotification(transaction.Signer));
 					sub.notify(AccountPublicKeyNotification(transaction.Recipient));
+				} else if (Mode::Signature == m_mode) {
+					// simulate a cosignature by the recipient
+					sub.notify(SignatureNotification(transaction.Signer, transaction.Signature, {}));
+					sub.notify(SignatureNotification(transaction.Recipient, transaction.Signature, {}));
 				} else {
 					sub.notify(EntityNotification(transaction.Network()));
 				}
@@ -91,6 +95,11 @@ namespace catapult { namespace model {
 		RunExtractAddressesTest(MockNotificationPublisher::Mode::Public_Key);
 	}
 
+	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromSignatureNotifications) {
+		// Assert:
+		RunExtractAddressesTest(MockNotificationPublisher::Mode::Signature);
+	}
+
 	TEST(TEST_CLASS, ExtractAddressesDoesNotExtractAddressesFromOtherNotifications) {
 		// Arrange:
 		auto pTransaction = mocks::CreateMockTransactionWithSignerAndRecipient(
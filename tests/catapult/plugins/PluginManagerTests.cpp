@@ -39,6 +39,7 @@ namespace catapult { namespace plugins {
 		// Assert:
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_FALSE(config.ShouldCalculateStateRoots);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
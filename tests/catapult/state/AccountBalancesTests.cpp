@@ -78,9 +78,9 @@ namespace catapult { namespace state {
 		// Act:
 		AccountBalances balancesMoved(std::move(balances));
 
-		// Assert: the original values are moved into the copy (move does not clear first mosaic)
+		// Assert: the original values are moved into the copy (move shares balances with the original)
 		EXPECT_EQ(Amount(777), balances.get(Test_Mosaic_Id));
-		EXPECT_EQ(Amount(0), balances.get(Xem_Id));
+		EXPECT_EQ(Amount(1000), balances.get(Xem_Id));
 
 		EXPECT_EQ(Amount(777), balancesMoved.get(Test_Mosaic_Id));
 		EXPECT_EQ(Amount(1000), balancesMoved.get(Xem_Id));
@@ -112,15 +112,52 @@ namespace catapult { namespace state {
 		AccountBalances balancesMoved;
 		const auto& assignResult = balancesMoved = std::move(balances);
 
-		// Assert: the original values are moved into the copy (move does not clear first mosaic)
+		// Assert: the original values are moved into the copy (move shares balances with the original)
 		EXPECT_EQ(&balancesMoved, &assignResult);
 		EXPECT_EQ(Amount(777), balances.get(Test_Mosaic_Id));
-		EXPECT_EQ(Amount(0), balances.get(Xem_Id));
+		EXPECT_EQ(Amount(1000), balances.get(Xem_Id));
 
 		EXPECT_EQ(Amount(777), balancesMoved.get(Test_Mosaic_Id));
 		EXPECT_EQ(Amount(1000), balancesMoved.get(Xem_Id));
 	}
 
+	TEST(TEST_CLASS, CopySharesBalancesUntilModified) {
+		// Arrange:
+		auto balances = CreateBalancesForConstructionTests();
+
+		// Act:
+		AccountBalances balancesCopy(balances);
+
+		// Assert: the balances are shared
+		EXPECT_EQ(&*balances.begin(), &*balancesCopy.begin());
+	}
+
+	TEST(TEST_CLASS, ModifyingCopyDetachesBalances) {
+		// Arrange:
+		auto balances = CreateBalancesForConstructionTests();
+		AccountBalances balancesCopy(balances);
+
+		// Act:
+		balancesCopy.debit(Xem_Id, Amount(400));
+
+		// Assert: the balances are no longer shared and the original is unchanged
+		EXPECT_NE(&*balances.begin(), &*balancesCopy.begin());
+		EXPECT_EQ(Amount(1000), balances.get(Xem_Id));
+		EXPECT_EQ(Amount(600), balancesCopy.get(Xem_Id));
+	}
+
+	TEST(TEST_CLASS, FailedDebitDoesNotDetachBalances) {
+		// Arrange:
+		auto balances = CreateBalancesForConstructionTests();
+		AccountBalances balancesCopy(balances);
+
+		// Act:
+		EXPECT_THROW(balancesCopy.debit(Xem_Id, Amount(1001)), catapult_runtime_error);
+
+		// Assert: the balances are still shared
+		EXPECT_EQ(&*balances.begin(), &*balancesCopy.begin());
+	}
+
 	// endregion
 
 	// region credit
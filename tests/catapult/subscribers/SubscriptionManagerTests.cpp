@@ -22,10 +22,15 @@
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/io/FileBasedStorage.h"
 #include "tests/catapult/subscribers/test/UnsupportedSubscribers.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
 
 namespace catapult { namespace subscribers {
 
@@ -149,6 +154,54 @@ namespace catapult { namespace subscribers {
 		manager.fileStorage();
 	}
 
+	TEST(TEST_CLASS, CanCreateManagerWithSegmentedFileStorage) {
+		// Arrange: seed the data directory with a file-based storage
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		auto config = CreateConfiguration();
+		const_cast<bool&>(config.Node.ShouldUseSegmentedBlockStorage) = true;
+		const_cast<std::string&>(config.User.DataDirectory) = tempDir.name();
+
+		// Act:
+		SubscriptionManager manager(config);
+		const auto& fileStorage = manager.fileStorage();
+
+		// Assert: the nemesis block was converted into the segmented storage
+		EXPECT_EQ(Height(1), fileStorage.chainHeight());
+		EXPECT_EQ(Height(1), fileStorage.loadBlock(Height(1))->Height);
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/segments/height.dat"));
+	}
+
+	TEST(TEST_CLASS, CanCreateManagerWithPartiallyConvertedSegmentedFileStorage) {
+		// Arrange: seed the data directory with a file-based storage and convert the nemesis block
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		auto config = CreateConfiguration();
+		const_cast<bool&>(config.Node.ShouldUseSegmentedBlockStorage) = true;
+		const_cast<std::string&>(config.User.DataDirectory) = tempDir.name();
+		SubscriptionManager(config).fileStorage();
+
+		// - add more blocks to the file-based storage
+		{
+			io::FileBasedStorage legacyStorage(tempDir.name());
+			for (auto height = Height(2); height <= Height(4); height = height + Height(1)) {
+				auto pBlock = test::GenerateBlockWithTransactionsAtHeight(height);
+				legacyStorage.saveBlock(test::BlockToBlockElement(*pBlock));
+			}
+		}
+
+		// Act:
+		SubscriptionManager manager(config);
+		const auto& fileStorage = manager.fileStorage();
+
+		// Assert: the conversion was resumed
+		EXPECT_EQ(Height(4), fileStorage.chainHeight());
+		for (auto height = Height(1); height <= Height(4); height = height + Height(1))
+			EXPECT_EQ(height, fileStorage.loadBlock(height)->Height) << height;
+	}
+
 	// endregion
 
 	// region single aggregate creation
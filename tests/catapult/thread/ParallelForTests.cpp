@@ -433,4 +433,51 @@ namespace catapult { namespace thread {
 	}
 
 	// endregion
+
+	// region ParallelForEachAndWait
+
+	CONTAINER_TEST(ParallelForEachAndWaitCanProcessAllItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: capture all values by their index
+		std::vector<uint16_t> capturedValues(context.NumItems, 0);
+		ParallelForEachAndWait(context.pPool->service(), context.Items, [&capturedValues](auto value, auto index) {
+			capturedValues[index] = value;
+		});
+
+		// Assert: all values were processed before returning
+		for (auto i = 0u; i < capturedValues.size(); ++i)
+			EXPECT_EQ(i + 1, capturedValues[i]) << "i " << i;
+	}
+
+	CONTAINER_TEST(ParallelForEachAndWaitCanProcessZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		typename TTraits::ContainerType items;
+
+		// Act:
+		auto numCalls = 0u;
+		ParallelForEachAndWait(context.pPool->service(), items, [&numCalls](auto, auto) { ++numCalls; });
+
+		// Assert:
+		EXPECT_EQ(0u, numCalls);
+	}
+
+	CONTAINER_TEST(ParallelForEachAndWaitRethrowsExceptionAfterAllItemsAreProcessed) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act + Assert: exceptions do not prevent other items from being processed
+		std::atomic<size_t> sum(0);
+		EXPECT_THROW(ParallelForEachAndWait(context.pPool->service(), context.Items, [&sum](auto value, auto index) {
+			sum += value;
+			if (1 == index % 2)
+				CATAPULT_THROW_RUNTIME_ERROR("odd index");
+		}), catapult_runtime_error);
+
+		EXPECT_EQ(context.ItemsSum, sum);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,201 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS MemoryDataSourceTests
+
+	namespace {
+		LeafTreeNode CreateLeaf(uint32_t path) {
+			return LeafTreeNode(TreeNodePath(path), test::GenerateRandomData<Hash256_Size>());
+		}
+
+		BranchTreeNode CreateBranch(const std::vector<std::pair<size_t, Hash256>>& links) {
+			BranchTreeNode node(TreeNodePath(static_cast<uint8_t>(0x12)).subpath(0, 1));
+			for (const auto& pair : links)
+				node.setLink(pair.second, pair.first);
+
+			return node;
+		}
+
+		void AssertContains(const MemoryDataSource& dataSource, const Hash256& hash) {
+			const auto* pNode = dataSource.get(hash);
+			ASSERT_TRUE(!!pNode) << utils::HexFormat(hash);
+			EXPECT_EQ(hash, pNode->hash());
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, DataSourceIsInitiallyEmpty) {
+		// Act:
+		MemoryDataSource dataSource;
+
+		// Assert:
+		EXPECT_EQ(0u, dataSource.size());
+		EXPECT_FALSE(!!dataSource.get(test::GenerateRandomData<Hash256_Size>()));
+	}
+
+	TEST(TEST_CLASS, CanSetAndGetLeafNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto node = CreateLeaf(0x64'6F'67'00);
+
+		// Act:
+		dataSource.set(node);
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		AssertContains(dataSource, node.hash());
+		EXPECT_TRUE(dataSource.get(node.hash())->isLeaf());
+	}
+
+	TEST(TEST_CLASS, CanSetAndGetBranchNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto node = CreateBranch({ { 3, test::GenerateRandomData<Hash256_Size>() } });
+
+		// Act:
+		dataSource.set(node);
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		AssertContains(dataSource, node.hash());
+		EXPECT_TRUE(dataSource.get(node.hash())->isBranch());
+	}
+
+	TEST(TEST_CLASS, CanSetTreeNodes) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto leafNode = CreateLeaf(0x64'6F'67'00);
+		auto branchNode = CreateBranch({ { 3, test::GenerateRandomData<Hash256_Size>() } });
+
+		// Act:
+		dataSource.set(TreeNode(leafNode));
+		dataSource.set(TreeNode(branchNode));
+		dataSource.set(TreeNode());
+
+		// Assert: the empty node is not saved
+		EXPECT_EQ(2u, dataSource.size());
+		AssertContains(dataSource, leafNode.hash());
+		AssertContains(dataSource, branchNode.hash());
+	}
+
+	TEST(TEST_CLASS, SettingNodeWithSameHashIsNoOp) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto node = CreateLeaf(0x64'6F'67'00);
+		dataSource.set(node);
+		const auto* pOriginalNode = dataSource.get(node.hash());
+
+		// Act:
+		dataSource.set(node);
+
+		// Assert:
+		EXPECT_EQ(1u, dataSource.size());
+		EXPECT_EQ(pOriginalNode, dataSource.get(node.hash()));
+	}
+
+	// endregion
+
+	// region prune
+
+	TEST(TEST_CLASS, PruneRemovesAllNodesWhenRootIsUnknown) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		dataSource.set(CreateLeaf(0x64'6F'67'00));
+		dataSource.set(CreateLeaf(0x64'6F'67'01));
+
+		// Act:
+		auto numRemainingNodes = dataSource.prune(test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_EQ(0u, numRemainingNodes);
+		EXPECT_EQ(0u, dataSource.size());
+	}
+
+	TEST(TEST_CLASS, PruneKeepsRootLeafNode) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto node = CreateLeaf(0x64'6F'67'00);
+		dataSource.set(node);
+		dataSource.set(CreateLeaf(0x64'6F'67'01));
+
+		// Act:
+		auto numRemainingNodes = dataSource.prune(node.hash());
+
+		// Assert:
+		EXPECT_EQ(1u, numRemainingNodes);
+		EXPECT_EQ(1u, dataSource.size());
+		AssertContains(dataSource, node.hash());
+	}
+
+	TEST(TEST_CLASS, PruneKeepsAllNodesReachableFromRoot) {
+		// Arrange: root -> { branch -> { leaf1, leaf2 }, leaf3 }
+		MemoryDataSource dataSource;
+		auto leaf1 = CreateLeaf(0x64'6F'67'00);
+		auto leaf2 = CreateLeaf(0x64'6F'67'01);
+		auto leaf3 = CreateLeaf(0x64'6F'67'02);
+		auto branch = CreateBranch({ { 1, leaf1.hash() }, { 7, leaf2.hash() } });
+		auto root = CreateBranch({ { 0, branch.hash() }, { 15, leaf3.hash() } });
+
+		for (const auto& leaf : { leaf1, leaf2, leaf3 })
+			dataSource.set(leaf);
+
+		dataSource.set(branch);
+		dataSource.set(root);
+
+		// - add some unreachable nodes
+		auto unreachableLeaf = CreateLeaf(0x64'6F'67'03);
+		dataSource.set(unreachableLeaf);
+		dataSource.set(CreateBranch({ { 2, unreachableLeaf.hash() } }));
+
+		// Act:
+		auto numRemainingNodes = dataSource.prune(root.hash());
+
+		// Assert:
+		EXPECT_EQ(5u, numRemainingNodes);
+		EXPECT_EQ(5u, dataSource.size());
+		for (const auto& hash : { leaf1.hash(), leaf2.hash(), leaf3.hash(), branch.hash(), root.hash() })
+			AssertContains(dataSource, hash);
+	}
+
+	TEST(TEST_CLASS, PruneIgnoresLinksToUnknownNodes) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		auto leaf = CreateLeaf(0x64'6F'67'00);
+		auto root = CreateBranch({ { 1, leaf.hash() }, { 7, test::GenerateRandomData<Hash256_Size>() } });
+		dataSource.set(leaf);
+		dataSource.set(root);
+
+		// Act:
+		auto numRemainingNodes = dataSource.prune(root.hash());
+
+		// Assert:
+		EXPECT_EQ(2u, numRemainingNodes);
+		AssertContains(dataSource, leaf.hash());
+		AssertContains(dataSource, root.hash());
+	}
+
+	// endregion
+}}
@@ -1424,4 +1424,226 @@ namespace catapult { namespace tree {
 	}
 
 	// endregion
+
+	// region setBatch / unsetBatch
+
+	namespace {
+		using PairsVector = std::vector<std::pair<uint32_t, std::string>>;
+
+		Hash256 CalculateExpectedHashWithPerKeySet(const PairsVector& pairs) {
+			MemoryDataSource dataSource(false);
+			PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+			for (const auto& pair : pairs)
+				tree.set(pair.first, pair.second);
+
+			return tree.root();
+		}
+
+		PairsVector GenerateRandomPairs(size_t count) {
+			PairsVector pairs;
+			for (auto i = 0u; i < count; ++i) {
+				// - use a small key space with shared prefixes so that many branches are created
+				auto key = static_cast<uint32_t>(test::Random() & 0xFF'0F'FF'FF);
+				pairs.emplace_back(key, std::to_string(test::Random()));
+			}
+
+			return pairs;
+		}
+
+		std::vector<uint32_t> GetKeys(const PairsVector& pairs) {
+			std::vector<uint32_t> keys;
+			for (const auto& pair : pairs)
+				keys.push_back(pair.first);
+
+			return keys;
+		}
+	}
+
+	TEST(TEST_CLASS, SetBatchWithNoPairsHasNoEffect) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+		tree.set(0x64'6F'00'00, "verb");
+		auto expectedHash = tree.root();
+
+		// Act:
+		tree.setBatch({});
+
+		// Assert:
+		EXPECT_EQ(expectedHash, tree.root());
+		EXPECT_EQ(1u, dataSource.size());
+	}
+
+	TEST(TEST_CLASS, CanCreatePuppyTreeWithRootExtensionNodeWithSetBatch) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+
+		// Act: pairs are intentionally unordered
+		tree.setBatch({ { 0x68'6F'72'73, "stallion" }, { 0x64'6F'67'00, "puppy" }, { 0x64'6F'67'65, "coin" }, { 0x64'6F'00'00, "verb" } });
+
+		// Assert: only reachable nodes are saved
+		auto checker = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(dataSource);
+		EXPECT_EQ(checker.get("root"), tree.root());
+		EXPECT_EQ(4u + 3, dataSource.size());
+		checker.checkReachable(tree.root(), { "verb", "puppy", "coin", "puppy-coin", "verb-puppy-coin", "stallion", "root" });
+
+		AssertLeaves(tree, {
+			{ 0x64'6F'00'00, "verb" }, { 0x64'6F'67'00, "puppy" }, { 0x64'6F'67'65, "coin" }, { 0x68'6F'72'73, "stallion" }
+		});
+	}
+
+	TEST(TEST_CLASS, SetBatchUsesLastValueOfDuplicateKeys) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+
+		// Act:
+		tree.setBatch({ { 0x64'6F'00'00, "verb" }, { 0x64'6F'67'00, "dog" }, { 0x64'6F'00'00, "noun" }, { 0x64'6F'67'00, "puppy" } });
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedHashWithPerKeySet({ { 0x64'6F'00'00, "noun" }, { 0x64'6F'67'00, "puppy" } }), tree.root());
+		AssertLeaves(tree, { { 0x64'6F'00'00, "noun" }, { 0x64'6F'67'00, "puppy" } });
+	}
+
+	TEST(TEST_CLASS, SetBatchIntoExistingTreeProducesSameRootAsPerKeySet) {
+		// Arrange: split the puppy pairs (plus updates of existing values) into all possible existing / batch partitions
+		auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+		pairs.emplace_back(0x64'6F'67'00, "dog");
+		pairs.emplace_back(0x64'6F'00'65, "word");
+		pairs.emplace_back(0x68'6F'72'00, "horse");
+		for (auto mask = 0u; mask < (1u << pairs.size()); ++mask) {
+			PairsVector existingPairs;
+			PairsVector batchPairs;
+			for (auto i = 0u; i < pairs.size(); ++i)
+				(mask & (1u << i) ? batchPairs : existingPairs).push_back(pairs[i]);
+
+			MemoryDataSource dataSource(false);
+			PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+			for (const auto& pair : existingPairs)
+				tree.set(pair.first, pair.second);
+
+			// Act:
+			tree.setBatch(batchPairs);
+
+			// Assert: the batch is applied after all existing pairs
+			auto allPairs = existingPairs;
+			allPairs.insert(allPairs.end(), batchPairs.cbegin(), batchPairs.cend());
+			EXPECT_EQ(CalculateExpectedHashWithPerKeySet(allPairs), tree.root()) << "mask " << mask;
+		}
+	}
+
+	TEST(TEST_CLASS, SetBatchProducesSameRootAsPerKeySet_Random) {
+		// Arrange:
+		auto existingPairs = GenerateRandomPairs(200);
+		auto batchPairs = GenerateRandomPairs(300);
+
+		// - include updates of some existing keys
+		for (auto i = 0u; i < 50; ++i)
+			batchPairs.emplace_back(existingPairs[i].first, "updated");
+
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+		tree.setBatch(existingPairs);
+
+		// Sanity:
+		EXPECT_EQ(CalculateExpectedHashWithPerKeySet(existingPairs), tree.root());
+
+		// Act:
+		tree.setBatch(batchPairs);
+
+		// Assert:
+		auto allPairs = existingPairs;
+		allPairs.insert(allPairs.end(), batchPairs.cbegin(), batchPairs.cend());
+		EXPECT_EQ(CalculateExpectedHashWithPerKeySet(allPairs), tree.root());
+		AssertLeaves(tree, PairsVector(batchPairs.cbegin() + 300, batchPairs.cend()));
+	}
+
+	TEST(TEST_CLASS, UnsetBatchWithUnknownKeysHasNoEffect) {
+		// Arrange:
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+		tree.setBatch(GetPuppyTreeWithRootExtensionNodePairs());
+		auto expectedHash = tree.root();
+		auto numNodes = dataSource.size();
+
+		// Act:
+		tree.unsetBatch({ 0x64'6F'00'01, 0x64'6F'67'66, 0x68'6F'72'74, 0x12'34'56'78 });
+
+		// Assert:
+		EXPECT_EQ(expectedHash, tree.root());
+		EXPECT_EQ(numNodes, dataSource.size());
+	}
+
+	TEST(TEST_CLASS, UnsetBatchProducesSameRootAsPerKeyUnset) {
+		// Arrange: remove all possible subsets of the puppy pairs
+		auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+		for (auto mask = 0u; mask < (1u << pairs.size()); ++mask) {
+			PairsVector remainingPairs;
+			std::vector<uint32_t> removedKeys;
+			for (auto i = 0u; i < pairs.size(); ++i) {
+				if (mask & (1u << i))
+					removedKeys.push_back(pairs[i].first);
+				else
+					remainingPairs.push_back(pairs[i]);
+			}
+
+			MemoryDataSource dataSource(false);
+			PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+			tree.setBatch(pairs);
+
+			// Act:
+			tree.unsetBatch(removedKeys);
+
+			// Assert:
+			EXPECT_EQ(CalculateExpectedHashWithPerKeySet(remainingPairs), tree.root()) << "mask " << mask;
+			AssertLeaves(tree, remainingPairs);
+			for (auto key : removedKeys)
+				EXPECT_FALSE(!!tree.lookup(key)) << "mask " << mask << ", key " << key;
+		}
+	}
+
+	TEST(TEST_CLASS, UnsetBatchProducesSameRootAsPerKeyUnset_Random) {
+		// Arrange:
+		auto pairs = GenerateRandomPairs(500);
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+		tree.setBatch(pairs);
+
+		MemoryDataSource expectedDataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> expectedTree(expectedDataSource);
+		expectedTree.setBatch(pairs);
+
+		// - remove every third key (including some duplicates and unknown keys)
+		std::vector<uint32_t> removedKeys;
+		for (auto i = 0u; i < pairs.size(); i += 3) {
+			removedKeys.push_back(pairs[i].first);
+			expectedTree.unset(pairs[i].first);
+		}
+
+		removedKeys.push_back(pairs[0].first);
+		removedKeys.push_back(0xFF'FF'FF'FF);
+
+		// Act:
+		tree.unsetBatch(removedKeys);
+
+		// Assert:
+		EXPECT_EQ(expectedTree.root(), tree.root());
+	}
+
+	TEST(TEST_CLASS, UnsetBatchCanRemoveAllKeys) {
+		// Arrange:
+		auto pairs = GenerateRandomPairs(100);
+		MemoryDataSource dataSource(false);
+		PatriciaTree<PassThroughEncoder, MemoryDataSource> tree(dataSource);
+		tree.setBatch(pairs);
+
+		// Act:
+		tree.unsetBatch(GetKeys(pairs));
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+	}
+
+	// endregion
 }}
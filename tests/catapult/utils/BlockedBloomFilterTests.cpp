@@ -0,0 +1,162 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/BlockedBloomFilter.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS BlockedBloomFilterTests
+
+	namespace {
+		std::vector<Hash256> GenerateRandomHashes(size_t count) {
+			std::vector<Hash256> hashes(count);
+			for (auto& hash : hashes)
+				hash = test::GenerateRandomData<Hash256_Size>();
+
+			return hashes;
+		}
+
+		size_t CountMayContain(const BlockedBloomFilter& filter, const std::vector<Hash256>& hashes) {
+			return static_cast<size_t>(std::count_if(hashes.cbegin(), hashes.cend(), [&filter](const auto& hash) {
+				return filter.mayContain(hash);
+			}));
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateFilterWithPowerOfTwoBlocks) {
+		for (auto numBlocks : { 1u, 2u, 64u, 1024u }) {
+			// Act:
+			BlockedBloomFilter filter(numBlocks);
+
+			// Assert:
+			EXPECT_EQ(numBlocks, filter.numBlocks()) << numBlocks;
+			EXPECT_EQ(numBlocks * 512, filter.numBits()) << numBlocks;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateFilterWithOtherNumberOfBlocks) {
+		for (auto numBlocks : { 0u, 3u, 6u, 1000u }) {
+			// Act + Assert:
+			EXPECT_THROW(BlockedBloomFilter filter(numBlocks), catapult_invalid_argument) << numBlocks;
+		}
+	}
+
+	// endregion
+
+	// region insert / mayContain
+
+	TEST(TEST_CLASS, EmptyFilterDoesNotContainAnyHashes) {
+		// Arrange:
+		BlockedBloomFilter filter(64);
+		auto hashes = GenerateRandomHashes(100);
+
+		// Act + Assert:
+		EXPECT_EQ(0u, CountMayContain(filter, hashes));
+	}
+
+	TEST(TEST_CLASS, FilterMayContainAllInsertedHashes) {
+		// Arrange:
+		BlockedBloomFilter filter(64);
+		auto hashes = GenerateRandomHashes(1000);
+
+		// Act:
+		for (const auto& hash : hashes)
+			filter.insert(hash);
+
+		// Assert: there are no false negatives
+		EXPECT_EQ(1000u, CountMayContain(filter, hashes));
+	}
+
+	TEST(TEST_CLASS, FilterRulesOutMostUnknownHashesWhenNotOverloaded) {
+		// Arrange: insert 2048 hashes into 32768 bits (16 bits per hash)
+		BlockedBloomFilter filter(64);
+		for (const auto& hash : GenerateRandomHashes(2048))
+			filter.insert(hash);
+
+		// Act:
+		auto numFalsePositives = CountMayContain(filter, GenerateRandomHashes(10'000));
+
+		// Assert: expected false positive rate is well below 1%
+		EXPECT_GT(200u, numFalsePositives);
+	}
+
+	TEST(TEST_CLASS, InsertingSameHashMultipleTimesHasNoAdditionalEffect) {
+		// Arrange:
+		BlockedBloomFilter filter(1);
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto otherHashes = GenerateRandomHashes(100);
+		filter.insert(hash);
+		auto numMayContain = CountMayContain(filter, otherHashes);
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			filter.insert(hash);
+
+		// Assert:
+		EXPECT_TRUE(filter.mayContain(hash));
+		EXPECT_EQ(numMayContain, CountMayContain(filter, otherHashes));
+	}
+
+	TEST(TEST_CLASS, CanInsertHashesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Hashes_Per_Thread = 500u;
+		BlockedBloomFilter filter(16);
+		auto hashes = GenerateRandomHashes(Num_Threads * Num_Hashes_Per_Thread);
+
+		// Act:
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.create_thread([&filter, &hashes, i] {
+				for (auto j = 0u; j < Num_Hashes_Per_Thread; ++j)
+					filter.insert(hashes[i * Num_Hashes_Per_Thread + j]);
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: no bits were lost
+		EXPECT_EQ(hashes.size(), CountMayContain(filter, hashes));
+	}
+
+	// endregion
+
+	// region clear
+
+	TEST(TEST_CLASS, ClearRemovesAllHashes) {
+		// Arrange:
+		BlockedBloomFilter filter(64);
+		auto hashes = GenerateRandomHashes(100);
+		for (const auto& hash : hashes)
+			filter.insert(hash);
+
+		// Act:
+		filter.clear();
+
+		// Assert:
+		EXPECT_EQ(0u, CountMayContain(filter, hashes));
+	}
+
+	// endregion
+}}
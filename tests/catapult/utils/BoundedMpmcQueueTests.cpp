@@ -0,0 +1,239 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/BoundedMpmcQueue.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <thread>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS BoundedMpmcQueueTests
+
+	namespace {
+		using IntQueue = BoundedMpmcQueue<int>;
+
+		std::vector<int> PopAll(IntQueue& queue) {
+			std::vector<int> values;
+			int value;
+			while (queue.tryPop(value))
+				values.push_back(value);
+
+			return values;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateQueueWithPowerOfTwoCapacity) {
+		for (auto capacity : { 2u, 4u, 64u, 1024u }) {
+			// Act:
+			IntQueue queue(capacity);
+
+			// Assert:
+			EXPECT_EQ(capacity, queue.capacity()) << capacity;
+			EXPECT_TRUE(queue.empty()) << capacity;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateQueueWithOtherCapacity) {
+		for (auto capacity : { 0u, 1u, 3u, 6u, 1000u }) {
+			// Act + Assert:
+			EXPECT_THROW(IntQueue queue(capacity), catapult_invalid_argument) << capacity;
+		}
+	}
+
+	// endregion
+
+	// region tryPush / tryPop
+
+	TEST(TEST_CLASS, CannotPopFromEmptyQueue) {
+		// Arrange:
+		IntQueue queue(4);
+		int value = 7;
+
+		// Act:
+		auto result = queue.tryPop(value);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(7, value);
+	}
+
+	TEST(TEST_CLASS, CanPushAndPopSingleValue) {
+		// Arrange:
+		IntQueue queue(4);
+		int value = 0;
+
+		// Act:
+		auto pushResult = queue.tryPush(17);
+		auto isEmptyAfterPush = queue.empty();
+		auto popResult = queue.tryPop(value);
+
+		// Assert:
+		EXPECT_TRUE(pushResult);
+		EXPECT_FALSE(isEmptyAfterPush);
+		EXPECT_TRUE(popResult);
+		EXPECT_EQ(17, value);
+		EXPECT_TRUE(queue.empty());
+	}
+
+	TEST(TEST_CLASS, ValuesArePoppedInPushOrder) {
+		// Arrange:
+		IntQueue queue(8);
+
+		// Act:
+		for (auto value : { 5, 3, 9, 1 })
+			queue.tryPush(std::move(value));
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 5, 3, 9, 1 }), PopAll(queue));
+	}
+
+	TEST(TEST_CLASS, CannotPushIntoFullQueue) {
+		// Arrange:
+		IntQueue queue(4);
+		for (auto i = 0; i < 4; ++i)
+			EXPECT_TRUE(queue.tryPush(std::move(i))) << i;
+
+		// Act:
+		auto result = queue.tryPush(99);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(std::vector<int>({ 0, 1, 2, 3 }), PopAll(queue));
+	}
+
+	TEST(TEST_CLASS, ValueIsNotMovedFromWhenPushFails) {
+		// Arrange:
+		BoundedMpmcQueue<std::unique_ptr<int>> queue(2);
+		queue.tryPush(std::make_unique<int>(1));
+		queue.tryPush(std::make_unique<int>(1));
+		auto pValue = std::make_unique<int>(2);
+
+		// Act:
+		auto result = queue.tryPush(std::move(pValue));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		ASSERT_TRUE(!!pValue);
+		EXPECT_EQ(2, *pValue);
+	}
+
+	TEST(TEST_CLASS, SlotsAreReusedAcrossLaps) {
+		// Arrange:
+		IntQueue queue(2);
+
+		// Act: push and pop more values than the queue capacity
+		std::vector<int> values;
+		for (auto i = 0; i < 10; ++i) {
+			EXPECT_TRUE(queue.tryPush(std::move(i))) << i;
+
+			int value;
+			EXPECT_TRUE(queue.tryPop(value)) << i;
+			values.push_back(value);
+		}
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }), values);
+		EXPECT_TRUE(queue.empty());
+	}
+
+	TEST(TEST_CLASS, PopReleasesValueHeldBySlot) {
+		// Arrange:
+		BoundedMpmcQueue<std::shared_ptr<int>> queue(2);
+		auto pValue = std::make_shared<int>(3);
+		queue.tryPush(std::shared_ptr<int>(pValue));
+
+		// Act:
+		std::shared_ptr<int> pPoppedValue;
+		queue.tryPop(pPoppedValue);
+		pPoppedValue.reset();
+
+		// Assert: only the local reference is left
+		EXPECT_EQ(1, pValue.use_count());
+	}
+
+	// endregion
+
+	// region concurrency
+
+	TEST(TEST_CLASS, CanPushAndPopConcurrentlyWithMultipleProducersAndConsumers) {
+		// Arrange:
+		constexpr auto Num_Producers = 16u;
+		constexpr auto Num_Consumers = 4u;
+		constexpr auto Num_Values_Per_Producer = 10'000u;
+		IntQueue queue(256);
+
+		// Act: producers retry pushing until the queue has space
+		std::atomic<size_t> numPopped(0);
+		std::vector<std::vector<int>> consumerValues(Num_Consumers);
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.create_thread([&queue, i] {
+				for (auto j = 0u; j < Num_Values_Per_Producer; ++j) {
+					auto value = static_cast<int>(i * Num_Values_Per_Producer + j);
+					while (!queue.tryPush(std::move(value)))
+						std::this_thread::yield();
+				}
+			});
+		}
+
+		for (auto i = 0u; i < Num_Consumers; ++i) {
+			threads.create_thread([&queue, &numPopped, &values = consumerValues[i]] {
+				while (numPopped < Num_Producers * Num_Values_Per_Producer) {
+					int value;
+					if (!queue.tryPop(value)) {
+						std::this_thread::yield();
+						continue;
+					}
+
+					values.push_back(value);
+					++numPopped;
+				}
+			});
+		}
+
+		threads.join_all();
+
+		// Assert: all values were popped exactly once
+		std::vector<int> allValues;
+		for (const auto& values : consumerValues) {
+			// - values pushed by the same producer are popped in order by each consumer
+			std::vector<int> lastValues(Num_Producers, -1);
+			for (auto value : values) {
+				auto producerId = static_cast<size_t>(value) / Num_Values_Per_Producer;
+				EXPECT_LT(lastValues[producerId], value);
+				lastValues[producerId] = value;
+			}
+
+			allValues.insert(allValues.end(), values.cbegin(), values.cend());
+		}
+
+		std::sort(allValues.begin(), allValues.end());
+		ASSERT_EQ(Num_Producers * Num_Values_Per_Producer, allValues.size());
+		for (auto i = 0u; i < allValues.size(); ++i)
+			EXPECT_EQ(static_cast<int>(i), allValues[i]) << i;
+
+		EXPECT_TRUE(queue.empty());
+	}
+
+	// endregion
+}}
@@ -0,0 +1,159 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/CopyOnWrite.h"
+#include "tests/TestHarness.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS CopyOnWriteTests
+
+	namespace {
+		using Values = std::vector<int>;
+
+		struct CountingCopyPolicy {
+			static size_t NumCopies;
+			static size_t NumCopiedBytes;
+
+			static std::shared_ptr<Values> Copy(const Values& values) {
+				++NumCopies;
+				NumCopiedBytes += values.size() * sizeof(int);
+				return std::make_shared<Values>(values);
+			}
+		};
+
+		size_t CountingCopyPolicy::NumCopies;
+		size_t CountingCopyPolicy::NumCopiedBytes;
+
+		using CountingCopyOnWrite = CopyOnWrite<Values, CountingCopyPolicy>;
+
+		CountingCopyOnWrite CreateValues(const Values& values) {
+			CountingCopyOnWrite holder;
+			holder.getMutable() = values;
+			CountingCopyPolicy::NumCopies = 0;
+			CountingCopyPolicy::NumCopiedBytes = 0;
+			return holder;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateDefaultValue) {
+		// Act:
+		CopyOnWrite<Values> holder;
+
+		// Assert:
+		EXPECT_TRUE(holder.get().empty());
+		EXPECT_FALSE(holder.isShared());
+	}
+
+	TEST(TEST_CLASS, CanModifyUnsharedValueWithoutCopy) {
+		// Arrange:
+		auto holder = CreateValues({ 1, 2, 3 });
+		const auto* pOriginalValues = &holder.get();
+
+		// Act:
+		holder.getMutable().push_back(4);
+
+		// Assert:
+		EXPECT_EQ(Values({ 1, 2, 3, 4 }), holder.get());
+		EXPECT_EQ(pOriginalValues, &holder.get());
+		EXPECT_EQ(0u, CountingCopyPolicy::NumCopies);
+	}
+
+	TEST(TEST_CLASS, CopyConstructorSharesValue) {
+		// Arrange:
+		auto holder = CreateValues({ 1, 2, 3 });
+
+		// Act:
+		auto copy = holder;
+
+		// Assert:
+		EXPECT_TRUE(holder.isShared());
+		EXPECT_TRUE(copy.isShared());
+		EXPECT_EQ(&holder.get(), &copy.get());
+		EXPECT_EQ(0u, CountingCopyPolicy::NumCopies);
+	}
+
+	TEST(TEST_CLASS, AssignmentOperatorSharesValue) {
+		// Arrange:
+		auto holder = CreateValues({ 1, 2, 3 });
+		CountingCopyOnWrite copy;
+
+		// Act:
+		copy = holder;
+
+		// Assert:
+		EXPECT_TRUE(holder.isShared());
+		EXPECT_TRUE(copy.isShared());
+		EXPECT_EQ(&holder.get(), &copy.get());
+		EXPECT_EQ(0u, CountingCopyPolicy::NumCopies);
+	}
+
+	TEST(TEST_CLASS, ModifyingSharedValueCopiesValueOnce) {
+		// Arrange:
+		auto holder = CreateValues({ 1, 2, 3 });
+		auto copy = holder;
+
+		// Act:
+		copy.getMutable().push_back(4);
+		copy.getMutable().push_back(5);
+
+		// Assert: only the modified instance was changed
+		EXPECT_EQ(Values({ 1, 2, 3 }), holder.get());
+		EXPECT_EQ(Values({ 1, 2, 3, 4, 5 }), copy.get());
+		EXPECT_FALSE(holder.isShared());
+		EXPECT_FALSE(copy.isShared());
+		EXPECT_EQ(1u, CountingCopyPolicy::NumCopies);
+	}
+
+	TEST(TEST_CLASS, MovedFromInstanceRetainsValue) {
+		// Arrange:
+		auto holder = CreateValues({ 1, 2, 3 });
+
+		// Act:
+		auto moved = std::move(holder);
+
+		// Assert: move is a copy, so both instances share the value
+		EXPECT_EQ(Values({ 1, 2, 3 }), holder.get());
+		EXPECT_EQ(Values({ 1, 2, 3 }), moved.get());
+		EXPECT_EQ(&holder.get(), &moved.get());
+	}
+
+	TEST(TEST_CLASS, OnlyModifiedInstancesPayForCopiedBytes) {
+		// Arrange: simulate a delta that holds copies of many large values and modifies only a few of them
+		constexpr auto Num_Values = 100u;
+		constexpr auto Num_Modified_Values = 3u;
+		std::vector<CountingCopyOnWrite> originals;
+		for (auto i = 0u; i < Num_Values; ++i)
+			originals.push_back(CreateValues(Values(1000, static_cast<int>(i))));
+
+		// Act:
+		auto copies = originals;
+		for (auto i = 0u; i < Num_Modified_Values; ++i)
+			copies[i * 10].getMutable().push_back(-1);
+
+		// Assert: a deep copy of all values would copy every byte, but only the modified values were copied
+		auto numDeepCopyBytes = Num_Values * 1000 * sizeof(int);
+		auto numExpectedCopiedBytes = Num_Modified_Values * 1000 * sizeof(int);
+		EXPECT_EQ(Num_Modified_Values, CountingCopyPolicy::NumCopies);
+		EXPECT_EQ(numExpectedCopiedBytes, CountingCopyPolicy::NumCopiedBytes);
+		EXPECT_GT(numDeepCopyBytes, CountingCopyPolicy::NumCopiedBytes);
+	}
+}}
@@ -0,0 +1,349 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/FlatHashMap.h"
+#include "tests/TestHarness.h"
+#include <map>
+#include <string>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS FlatHashMapTests
+
+	namespace {
+		using IntMap = FlatHashMap<uint64_t, std::string>;
+
+		// hasher that maps all keys to the same hash in order to force collisions
+		struct ConstantHasher {
+			size_t operator()(uint64_t) const {
+				return 0x1234;
+			}
+		};
+
+		template<typename TMap>
+		void InsertRange(TMap& map, uint64_t start, uint64_t count) {
+			for (auto key = start; key < start + count; ++key)
+				map.emplace(key, std::to_string(key));
+		}
+
+		template<typename TMap>
+		std::map<uint64_t, std::string> ToOrderedMap(const TMap& map) {
+			std::map<uint64_t, std::string> orderedMap;
+			for (const auto& pair : map)
+				orderedMap.emplace(pair.first, pair.second);
+
+			return orderedMap;
+		}
+
+		std::map<uint64_t, std::string> CreateExpectedMap(uint64_t start, uint64_t count) {
+			std::map<uint64_t, std::string> expectedMap;
+			for (auto key = start; key < start + count; ++key)
+				expectedMap.emplace(key, std::to_string(key));
+
+			return expectedMap;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyMap) {
+		// Act:
+		IntMap map;
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(0u, map.size());
+		EXPECT_EQ(0u, map.capacity());
+		EXPECT_EQ(map.cend(), map.cbegin());
+		EXPECT_EQ(map.cend(), map.find(7));
+		EXPECT_EQ(0u, map.count(7));
+	}
+
+	TEST(TEST_CLASS, CanCopyMap) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		auto copy = map;
+		copy.erase(5);
+		copy[7] = "seven";
+
+		// Assert: the copy is deep
+		EXPECT_EQ(99u, copy.size());
+		EXPECT_EQ(0u, copy.count(5));
+		EXPECT_EQ("seven", copy.find(7)->second);
+
+		EXPECT_EQ(100u, map.size());
+		EXPECT_EQ(CreateExpectedMap(0, 100), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, CanMoveMap) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+		const auto* pValue = &map.find(7)->second;
+
+		// Act:
+		auto movedMap = std::move(map);
+
+		// Assert: elements are not moved
+		EXPECT_EQ(100u, movedMap.size());
+		EXPECT_EQ(pValue, &movedMap.find(7)->second);
+		EXPECT_EQ(CreateExpectedMap(0, 100), ToOrderedMap(movedMap));
+	}
+
+	// endregion
+
+	// region insert / emplace
+
+	TEST(TEST_CLASS, CanInsertSingleElement) {
+		// Arrange:
+		IntMap map;
+
+		// Act:
+		auto result = map.insert(std::make_pair(static_cast<uint64_t>(7), std::string("seven")));
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(7u, result.first->first);
+		EXPECT_EQ("seven", result.first->second);
+
+		EXPECT_FALSE(map.empty());
+		EXPECT_EQ(1u, map.size());
+		EXPECT_EQ(16u, map.capacity());
+		EXPECT_EQ(1u, map.count(7));
+		EXPECT_EQ("seven", map.find(7)->second);
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotOverwriteExistingElement) {
+		// Arrange:
+		IntMap map;
+		map.emplace(7, "seven");
+
+		// Act:
+		auto result = map.emplace(7, "eight");
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ("seven", result.first->second);
+		EXPECT_EQ(1u, map.size());
+	}
+
+	TEST(TEST_CLASS, CanInsertRange) {
+		// Arrange:
+		std::map<uint64_t, std::string> source{ { 1, "one" }, { 4, "four" }, { 9, "nine" } };
+		IntMap map;
+
+		// Act:
+		map.insert(source.cbegin(), source.cend());
+
+		// Assert:
+		EXPECT_EQ(source, ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, CanInsertManyElements) {
+		// Act:
+		IntMap map;
+		InsertRange(map, 0, 10'000);
+
+		// Assert:
+		EXPECT_EQ(10'000u, map.size());
+		EXPECT_EQ(16'384u, map.capacity());
+		EXPECT_EQ(CreateExpectedMap(0, 10'000), ToOrderedMap(map));
+		for (auto key = 0u; key < 10'000; ++key)
+			EXPECT_EQ(std::to_string(key), map.find(key)->second) << key;
+
+		EXPECT_EQ(map.cend(), map.find(10'000));
+	}
+
+	TEST(TEST_CLASS, CanInsertManyElementsWithCollidingHashes) {
+		// Act:
+		FlatHashMap<uint64_t, std::string, ConstantHasher> map;
+		InsertRange(map, 0, 100);
+
+		// Assert:
+		EXPECT_EQ(100u, map.size());
+		EXPECT_EQ(CreateExpectedMap(0, 100), ToOrderedMap(map));
+		for (auto key = 0u; key < 100; ++key)
+			EXPECT_EQ(std::to_string(key), map.find(key)->second) << key;
+
+		EXPECT_EQ(map.cend(), map.find(100));
+	}
+
+	TEST(TEST_CLASS, ElementAddressesAreStableWhenMapGrows) {
+		// Arrange:
+		IntMap map;
+		map.emplace(7, "seven");
+		const auto* pElement = &*map.find(7);
+
+		// Act:
+		InsertRange(map, 100, 10'000);
+
+		// Assert:
+		EXPECT_EQ(pElement, &*map.find(7));
+		EXPECT_EQ("seven", pElement->second);
+	}
+
+	TEST(TEST_CLASS, SubscriptOperatorInsertsDefaultValueWhenKeyIsUnknown) {
+		// Arrange:
+		IntMap map;
+		map.emplace(7, "seven");
+
+		// Act:
+		auto& value = map[8];
+
+		// Assert:
+		EXPECT_EQ("", value);
+		EXPECT_EQ(2u, map.size());
+		EXPECT_EQ("seven", map[7]);
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseElementByKey) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		auto numErased1 = map.erase(7);
+		auto numErased2 = map.erase(7);
+
+		// Assert:
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(0u, numErased2);
+		EXPECT_EQ(99u, map.size());
+		EXPECT_EQ(map.cend(), map.find(7));
+	}
+
+	TEST(TEST_CLASS, CanEraseElementByIterator) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act: erase all even keys while iterating
+		for (auto iter = map.begin(); map.end() != iter;)
+			iter = 0 == iter->first % 2 ? map.erase(iter) : std::next(iter);
+
+		// Assert:
+		EXPECT_EQ(50u, map.size());
+		for (auto key = 0u; key < 100; ++key)
+			EXPECT_EQ(key % 2, map.count(key)) << key;
+	}
+
+	TEST(TEST_CLASS, CanReinsertElementsAfterErase) {
+		// Arrange: repeatedly fill and empty the map to create deleted slots
+		FlatHashMap<uint64_t, std::string, ConstantHasher> map;
+		for (auto round = 0u; round < 10; ++round) {
+			InsertRange(map, round * 50, 50);
+			for (auto key = round * 50u; key < round * 50u + 50; ++key)
+				map.erase(key);
+		}
+
+		// Act:
+		InsertRange(map, 0, 50);
+
+		// Assert: deleted slots were purged instead of growing the map
+		EXPECT_EQ(50u, map.size());
+		EXPECT_EQ(64u, map.capacity());
+		EXPECT_EQ(CreateExpectedMap(0, 50), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, ClearRemovesAllElementsButKeepsCapacity) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		map.clear();
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(128u, map.capacity());
+		EXPECT_EQ(map.cend(), map.cbegin());
+		EXPECT_EQ(map.cend(), map.find(7));
+	}
+
+	// endregion
+
+	// region reserve
+
+	TEST(TEST_CLASS, ReserveAllocatesEnoughSlotsForRequestedElements) {
+		// Arrange:
+		IntMap map;
+		map.emplace(7, "seven");
+
+		// Act:
+		map.reserve(1000);
+
+		// Assert:
+		EXPECT_EQ(2048u, map.capacity());
+		EXPECT_EQ("seven", map.find(7)->second);
+	}
+
+	TEST(TEST_CLASS, ReserveDoesNotShrinkMap) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		map.reserve(10);
+
+		// Assert:
+		EXPECT_EQ(128u, map.capacity());
+		EXPECT_EQ(CreateExpectedMap(0, 100), ToOrderedMap(map));
+	}
+
+	// endregion
+
+	// region iteration
+
+	TEST(TEST_CLASS, CanModifyValuesThroughIterator) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		for (auto& pair : map)
+			pair.second += "!";
+
+		// Assert:
+		for (auto key = 0u; key < 10; ++key)
+			EXPECT_EQ(std::to_string(key) + "!", map.find(key)->second) << key;
+	}
+
+	TEST(TEST_CLASS, CanConvertIteratorToConstIterator) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		IntMap::const_iterator iter = map.find(7);
+
+		// Assert:
+		EXPECT_EQ(&*map.find(7), &*iter);
+		EXPECT_EQ("7", iter->second);
+	}
+
+	// endregion
+}}
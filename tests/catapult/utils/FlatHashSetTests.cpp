@@ -0,0 +1,268 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/FlatHashSet.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS FlatHashSetTests
+
+	namespace {
+		using IntSet = FlatHashSet<uint64_t>;
+
+		// hasher that maps all values to the same hash in order to force collisions
+		struct ConstantHasher {
+			size_t operator()(uint64_t) const {
+				return 0x1234;
+			}
+		};
+
+		template<typename TSet>
+		void InsertRange(TSet& set, uint64_t start, uint64_t count) {
+			for (auto value = start; value < start + count; ++value)
+				set.insert(value);
+		}
+
+		template<typename TSet>
+		std::set<uint64_t> ToOrderedSet(const TSet& set) {
+			return std::set<uint64_t>(set.cbegin(), set.cend());
+		}
+
+		std::set<uint64_t> CreateExpectedSet(uint64_t start, uint64_t count) {
+			std::set<uint64_t> expectedSet;
+			for (auto value = start; value < start + count; ++value)
+				expectedSet.insert(value);
+
+			return expectedSet;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptySet) {
+		// Act:
+		IntSet set;
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.size());
+		EXPECT_EQ(0u, set.capacity());
+		EXPECT_EQ(set.cend(), set.cbegin());
+		EXPECT_EQ(set.cend(), set.find(7));
+		EXPECT_EQ(0u, set.count(7));
+	}
+
+	TEST(TEST_CLASS, CanCreateSetFromInitializerList) {
+		// Act:
+		IntSet set{ 1, 4, 9, 4 };
+
+		// Assert:
+		EXPECT_EQ(3u, set.size());
+		EXPECT_EQ(std::set<uint64_t>({ 1, 4, 9 }), ToOrderedSet(set));
+	}
+
+	TEST(TEST_CLASS, CanCopySet) {
+		// Arrange:
+		IntSet set;
+		InsertRange(set, 0, 100);
+
+		// Act:
+		auto copy = set;
+		copy.erase(5);
+		copy.insert(100);
+
+		// Assert:
+		EXPECT_EQ(100u, copy.size());
+		EXPECT_EQ(0u, copy.count(5));
+		EXPECT_EQ(1u, copy.count(100));
+
+		EXPECT_EQ(100u, set.size());
+		EXPECT_EQ(CreateExpectedSet(0, 100), ToOrderedSet(set));
+	}
+
+	TEST(TEST_CLASS, CanMoveSet) {
+		// Arrange:
+		IntSet set;
+		InsertRange(set, 0, 100);
+
+		// Act:
+		auto movedSet = std::move(set);
+
+		// Assert:
+		EXPECT_EQ(100u, movedSet.size());
+		EXPECT_EQ(CreateExpectedSet(0, 100), ToOrderedSet(movedSet));
+
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.capacity());
+	}
+
+	// endregion
+
+	// region insert / emplace
+
+	TEST(TEST_CLASS, CanInsertSingleElement) {
+		// Arrange:
+		IntSet set;
+
+		// Act:
+		auto result = set.insert(7);
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(7u, *result.first);
+
+		EXPECT_FALSE(set.empty());
+		EXPECT_EQ(1u, set.size());
+		EXPECT_EQ(16u, set.capacity());
+		EXPECT_EQ(1u, set.count(7));
+		EXPECT_EQ(7u, *set.find(7));
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotAddDuplicateElement) {
+		// Arrange:
+		IntSet set;
+		set.emplace(7u);
+
+		// Act:
+		auto result = set.insert(7);
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(7u, *result.first);
+		EXPECT_EQ(1u, set.size());
+	}
+
+	TEST(TEST_CLASS, CanInsertManyElements) {
+		// Act:
+		IntSet set;
+		InsertRange(set, 0, 10'000);
+
+		// Assert:
+		EXPECT_EQ(10'000u, set.size());
+		EXPECT_EQ(16'384u, set.capacity());
+		EXPECT_EQ(CreateExpectedSet(0, 10'000), ToOrderedSet(set));
+		for (auto value = 0u; value < 10'000; ++value)
+			EXPECT_EQ(1u, set.count(value)) << value;
+
+		EXPECT_EQ(set.cend(), set.find(10'000));
+	}
+
+	TEST(TEST_CLASS, CanInsertManyElementsWithCollidingHashes) {
+		// Act:
+		FlatHashSet<uint64_t, ConstantHasher> set;
+		InsertRange(set, 0, 100);
+
+		// Assert:
+		EXPECT_EQ(100u, set.size());
+		EXPECT_EQ(CreateExpectedSet(0, 100), ToOrderedSet(set));
+		for (auto value = 0u; value < 100; ++value)
+			EXPECT_EQ(1u, set.count(value)) << value;
+
+		EXPECT_EQ(set.cend(), set.find(100));
+	}
+
+	// endregion
+
+	// region erase / clear
+
+	TEST(TEST_CLASS, CanEraseElementByValue) {
+		// Arrange:
+		IntSet set;
+		InsertRange(set, 0, 100);
+
+		// Act:
+		auto numErased1 = set.erase(7);
+		auto numErased2 = set.erase(7);
+
+		// Assert:
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(0u, numErased2);
+		EXPECT_EQ(99u, set.size());
+		EXPECT_EQ(0u, set.count(7));
+	}
+
+	TEST(TEST_CLASS, CanEraseAllElementsByIterator) {
+		// Arrange:
+		IntSet set;
+		InsertRange(set, 0, 100);
+
+		// Act:
+		auto numErased = 0u;
+		for (auto iter = set.cbegin(); set.cend() != iter; ++numErased)
+			iter = set.erase(iter);
+
+		// Assert:
+		EXPECT_EQ(100u, numErased);
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	TEST(TEST_CLASS, CanReinsertElementsAfterErase) {
+		// Arrange: repeatedly fill and empty the set with colliding hashes, which leaves deleted slots behind
+		FlatHashSet<uint64_t, ConstantHasher> set;
+		for (auto i = 0u; i < 10; ++i) {
+			InsertRange(set, i * 10, 50);
+			for (auto value = i * 10; value < i * 10 + 40; ++value)
+				set.erase(value);
+		}
+
+		// Assert:
+		EXPECT_EQ(10u, set.size());
+		EXPECT_EQ(CreateExpectedSet(130, 10), ToOrderedSet(set));
+	}
+
+	TEST(TEST_CLASS, ClearRemovesAllElementsButKeepsCapacity) {
+		// Arrange:
+		IntSet set;
+		InsertRange(set, 0, 100);
+		auto capacity = set.capacity();
+
+		// Act:
+		set.clear();
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(capacity, set.capacity());
+		EXPECT_EQ(set.cend(), set.cbegin());
+		EXPECT_EQ(0u, set.count(7));
+	}
+
+	// endregion
+
+	// region reserve
+
+	TEST(TEST_CLASS, ReserveAllocatesEnoughSlotsForRequestedElements) {
+		// Arrange:
+		IntSet set;
+
+		// Act:
+		set.reserve(1000);
+		auto capacity = set.capacity();
+		InsertRange(set, 0, 1000);
+
+		// Assert: no rehash was needed
+		EXPECT_EQ(2048u, capacity);
+		EXPECT_EQ(capacity, set.capacity());
+	}
+
+	// endregion
+}}
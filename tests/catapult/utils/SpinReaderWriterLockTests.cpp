@@ -180,6 +180,33 @@ namespace catapult { namespace utils {
 		EXPECT_TRUE(lock.isReaderActive());
 	}
 
+	TEST(TEST_CLASS, CanAcquireMoreReaderLocksThanFitIntoSingleByte) {
+		// Arrange: bypass reentrancy checks so that all readers can be acquired by the current thread
+		using LockType = BasicSpinReaderWriterLock<NoOpReaderNotificationPolicy>;
+		LockType lock;
+
+		// Act:
+		std::vector<LockType::ReaderLockGuard> readLocks;
+		for (auto i = 0u; i < 1000; ++i)
+			readLocks.push_back(lock.acquireReader());
+
+		// Assert:
+		EXPECT_FALSE(lock.isWriterPending());
+		EXPECT_FALSE(lock.isWriterActive());
+		EXPECT_TRUE(lock.isReaderActive());
+
+		// Act: release all but one reader and promote it
+		while (readLocks.size() > 1)
+			readLocks.pop_back();
+
+		auto writeLock = readLocks.back().promoteToWriter();
+
+		// Assert:
+		EXPECT_TRUE(lock.isWriterPending());
+		EXPECT_TRUE(lock.isWriterActive());
+		EXPECT_FALSE(lock.isReaderActive());
+	}
+
 	namespace {
 		struct ExclusiveLockGuard {
 		public:
@@ -0,0 +1,213 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/utils/TimingWheel.h"
+#include "tests/TestHarness.h"
+#include <map>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS TimingWheelTests
+
+	namespace {
+		using IntWheel = TimingWheel<int>;
+
+		void AddAll(IntWheel& wheel, const std::vector<std::pair<int, uint64_t>>& keyDeadlinePairs) {
+			for (const auto& pair : keyDeadlinePairs)
+				wheel.add(pair.first, Timestamp(pair.second));
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, InitiallyWheelIsEmpty) {
+		// Act:
+		IntWheel wheel;
+
+		// Assert:
+		EXPECT_EQ(0u, wheel.size());
+		EXPECT_TRUE(wheel.advance(Timestamp(1000)).empty());
+	}
+
+	// endregion
+
+	// region add / remove
+
+	TEST(TEST_CLASS, CanAddKeys) {
+		// Arrange:
+		IntWheel wheel;
+
+		// Act:
+		AddAll(wheel, { { 1, 10 }, { 2, 1'000 }, { 3, 100'000 }, { 4, 10'000'000'000 } });
+
+		// Assert:
+		EXPECT_EQ(4u, wheel.size());
+	}
+
+	TEST(TEST_CLASS, CannotAddSameKeyWithSameDeadlineTwice) {
+		// Arrange:
+		IntWheel wheel;
+		wheel.add(1, Timestamp(10));
+
+		// Act:
+		wheel.add(1, Timestamp(10));
+
+		// Assert:
+		EXPECT_EQ(1u, wheel.size());
+		EXPECT_EQ(std::vector<int>({ 1 }), wheel.advance(Timestamp(10)));
+	}
+
+	TEST(TEST_CLASS, CanRemoveKeysFromAllLevels) {
+		// Arrange:
+		IntWheel wheel;
+		AddAll(wheel, { { 1, 10 }, { 2, 1'000 }, { 3, 100'000 }, { 4, 10'000'000 }, { 5, 10'000'000'000 } });
+
+		// Act:
+		auto results = std::vector<bool>{
+			wheel.remove(1, Timestamp(10)),
+			wheel.remove(3, Timestamp(100'000)),
+			wheel.remove(5, Timestamp(10'000'000'000))
+		};
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>({ true, true, true }), results);
+		EXPECT_EQ(2u, wheel.size());
+		EXPECT_EQ(std::vector<int>({ 2, 4 }), wheel.advance(Timestamp(20'000'000'000)));
+	}
+
+	TEST(TEST_CLASS, CannotRemoveKeyWithDifferentDeadline) {
+		// Arrange:
+		IntWheel wheel;
+		wheel.add(1, Timestamp(10));
+
+		// Act:
+		auto result = wheel.remove(1, Timestamp(100'000));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(1u, wheel.size());
+	}
+
+	TEST(TEST_CLASS, CanRemoveKeyAfterWheelIsAdvanced) {
+		// Arrange: advance the wheel so that the key is cascaded into a lower level
+		IntWheel wheel;
+		wheel.add(1, Timestamp(100'000));
+		wheel.add(2, Timestamp(70'000));
+		wheel.advance(Timestamp(99'990));
+
+		// Act:
+		auto result = wheel.remove(1, Timestamp(100'000));
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(0u, wheel.size());
+	}
+
+	// endregion
+
+	// region advance
+
+	TEST(TEST_CLASS, AdvanceRemovesKeysWithDeadlinesAtOrBeforeTime) {
+		// Arrange:
+		IntWheel wheel;
+		AddAll(wheel, { { 1, 10 }, { 2, 11 }, { 3, 12 } });
+
+		// Act:
+		auto keys = wheel.advance(Timestamp(11));
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 1, 2 }), keys);
+		EXPECT_EQ(1u, wheel.size());
+	}
+
+	TEST(TEST_CLASS, AdvanceReturnsKeysOrderedByDeadlineAcrossLevels) {
+		// Arrange:
+		IntWheel wheel;
+		AddAll(wheel, { { 1, 10'000'000'000 }, { 2, 100'000 }, { 3, 10 }, { 4, 10'000'000 }, { 5, 1'000 }, { 6, 100'000 } });
+
+		// Act:
+		auto keys = wheel.advance(Timestamp(10'000'000'000));
+
+		// Assert: keys with equal deadlines are ordered by key
+		EXPECT_EQ(std::vector<int>({ 3, 5, 2, 6, 4, 1 }), keys);
+		EXPECT_EQ(0u, wheel.size());
+	}
+
+	TEST(TEST_CLASS, AdvanceRemovesKeysAddedWithPassedDeadlines) {
+		// Arrange:
+		IntWheel wheel;
+		wheel.advance(Timestamp(1'000));
+		AddAll(wheel, { { 1, 900 }, { 2, 1'000 }, { 3, 1'001 } });
+
+		// Act:
+		auto keys = wheel.advance(Timestamp(1'000));
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 1, 2 }), keys);
+		EXPECT_EQ(1u, wheel.size());
+	}
+
+	TEST(TEST_CLASS, AdvanceToEarlierTimeOnlyRemovesDueKeysWithDeadlinesAtOrBeforeTime) {
+		// Arrange:
+		IntWheel wheel;
+		wheel.advance(Timestamp(1'000));
+		AddAll(wheel, { { 1, 900 }, { 2, 950 }, { 3, 1'001 } });
+
+		// Act:
+		auto keys = wheel.advance(Timestamp(920));
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 1 }), keys);
+		EXPECT_EQ(2u, wheel.size());
+	}
+
+	TEST(TEST_CLASS, AdvanceIsConsistentWithOrderedIndexForRandomDeadlines) {
+		// Arrange:
+		IntWheel wheel;
+		std::multimap<uint64_t, int> deadlineKeyMap;
+		for (auto i = 0; i < 1000; ++i) {
+			// - spread deadlines across all levels and the overflow
+			auto deadline = test::Random() >> (test::Random() % 64);
+			deadline &= 0x0000'00FF'FFFF'FFFF;
+			wheel.add(i, Timestamp(deadline));
+			deadlineKeyMap.emplace(deadline, i);
+		}
+
+		// Act + Assert: advance in random steps of varying magnitudes
+		uint64_t time = 0;
+		while (!deadlineKeyMap.empty()) {
+			time += test::Random() % (static_cast<uint64_t>(1) << (test::Random() % 37));
+			auto keys = wheel.advance(Timestamp(time));
+
+			std::vector<std::pair<uint64_t, int>> expectedPairs(deadlineKeyMap.begin(), deadlineKeyMap.upper_bound(time));
+			std::sort(expectedPairs.begin(), expectedPairs.end());
+			std::vector<int> expectedKeys;
+			for (const auto& pair : expectedPairs)
+				expectedKeys.push_back(pair.second);
+
+			deadlineKeyMap.erase(deadlineKeyMap.cbegin(), deadlineKeyMap.upper_bound(time));
+			EXPECT_EQ(expectedKeys, keys) << time;
+			EXPECT_EQ(deadlineKeyMap.size(), wheel.size()) << time;
+		}
+	}
+
+	// endregion
+}}
@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/utils/VersionedSnapshot.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS VersionedSnapshotTests
+
+	namespace {
+		using IntSnapshot = VersionedSnapshot<int>;
+	}
+
+	TEST(TEST_CLASS, CanPinInitialVersion) {
+		// Act:
+		IntSnapshot snapshot(std::make_shared<const int>(7));
+		auto pValue = snapshot.pin();
+
+		// Assert:
+		ASSERT_TRUE(!!pValue);
+		EXPECT_EQ(7, *pValue);
+		EXPECT_EQ(0u, snapshot.version());
+	}
+
+	TEST(TEST_CLASS, PublishReplacesCurrentVersion) {
+		// Arrange:
+		IntSnapshot snapshot(std::make_shared<const int>(7));
+
+		// Act:
+		snapshot.publish(std::make_shared<const int>(11));
+		snapshot.publish(std::make_shared<const int>(13));
+		auto pValue = snapshot.pin();
+
+		// Assert:
+		EXPECT_EQ(13, *pValue);
+		EXPECT_EQ(2u, snapshot.version());
+	}
+
+	TEST(TEST_CLASS, PinnedVersionIsUnchangedByPublish) {
+		// Arrange:
+		IntSnapshot snapshot(std::make_shared<const int>(7));
+		auto pValue = snapshot.pin();
+
+		// Act:
+		snapshot.publish(std::make_shared<const int>(11));
+
+		// Assert:
+		EXPECT_EQ(7, *pValue);
+		EXPECT_EQ(11, *snapshot.pin());
+	}
+
+	TEST(TEST_CLASS, ReplacedVersionIsReclaimedWhenLastPinIsReleased) {
+		// Arrange:
+		IntSnapshot snapshot(std::make_shared<const int>(7));
+		auto pValue = snapshot.pin();
+		std::weak_ptr<const int> pWeakValue = pValue;
+
+		// Act:
+		snapshot.publish(std::make_shared<const int>(11));
+
+		// Sanity:
+		EXPECT_FALSE(pWeakValue.expired());
+
+		// Act:
+		pValue.reset();
+
+		// Assert:
+		EXPECT_TRUE(pWeakValue.expired());
+	}
+
+	TEST(TEST_CLASS, ReadersObserveConsistentVersionsWhileWriterPublishes) {
+		// Arrange: each version is a pair of equal values
+		using PairSnapshot = VersionedSnapshot<std::pair<uint32_t, uint32_t>>;
+		constexpr auto Num_Versions = 10'000u;
+		PairSnapshot snapshot(std::make_shared<const std::pair<uint32_t, uint32_t>>(0, 0));
+
+		// Act: readers pin versions while the writer is publishing
+		std::atomic<bool> isWriterDone(false);
+		std::atomic<uint32_t> numInconsistentReads(0);
+		boost::thread_group threads;
+		for (auto i = 0u; i < 8; ++i) {
+			threads.create_thread([&snapshot, &isWriterDone, &numInconsistentReads] {
+				auto lastValue = 0u;
+				while (!isWriterDone) {
+					auto pValue = snapshot.pin();
+
+					// - versions are never observed out of order
+					if (pValue->first != pValue->second || pValue->first < lastValue)
+						++numInconsistentReads;
+
+					lastValue = pValue->first;
+				}
+			});
+		}
+
+		for (auto i = 1u; i <= Num_Versions; ++i)
+			snapshot.publish(std::make_shared<const std::pair<uint32_t, uint32_t>>(i, i));
+
+		isWriterDone = true;
+		threads.join_all();
+
+		// Assert:
+		EXPECT_EQ(0u, numInconsistentReads);
+		EXPECT_EQ(Num_Versions, snapshot.pin()->first);
+		EXPECT_EQ(Num_Versions, snapshot.version());
+	}
+}}
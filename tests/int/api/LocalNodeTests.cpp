@@ -87,6 +87,8 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "ACNTST C")) << "cache counters";
 		EXPECT_TRUE(test::HasCounter(counters, "TX ELEM TOT")) << "service local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "basic local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE FPR")) << "basic local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLK C HIT")) << "basic local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "MEM CUR RSS")) << "memory counters";
 	}
 
@@ -39,6 +39,7 @@ namespace catapult { namespace test {
 			config.Port = Local_Node_Port;
 			config.ApiPort = Local_Node_Api_Port;
 			config.ShouldAllowAddressReuse = true;
+			config.BlockStorageCacheMaxSize = utils::FileSize::FromMegabytes(1);
 
 			config.MaxBlocksPerSyncAttempt = 4 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
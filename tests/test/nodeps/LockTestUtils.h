@@ -224,6 +224,25 @@ namespace catapult { namespace test {
 		EXPECT_EQ(1, flag);
 	}
 
+	/// Asserts that the lock obtained by \a acquireFirstLock does not prevent the lock obtained by \a acquireSecondLock
+	/// from being acquired.
+	template<typename TAcquireFirstLockFunc, typename TAcquireSecondLockFunc>
+	void AssertNonExclusiveLocks(TAcquireFirstLockFunc acquireFirstLock, TAcquireSecondLockFunc acquireSecondLock) {
+		// Arrange: get the first lock
+		std::atomic<int> flag(0);
+		auto lock1 = acquireFirstLock();
+
+		// Act: spawn another thread to acquire the second lock
+		std::thread([&flag, acquireSecondLock]() {
+			acquireSecondLock();
+			flag = 1;
+		}).detach();
+
+		// Assert: the other thread acquired the (second) lock while the first lock is held
+		WAIT_FOR_EXPR(0 != flag);
+		EXPECT_EQ(1, flag);
+	}
+
 	/// Asserts that a \a provider view blocks a modifier.
 	template<typename TProvider>
 	void AssertModifierIsBlockedByView(TProvider&& provider) {
@@ -251,6 +270,24 @@ namespace catapult { namespace test {
 			[&provider]() { return provider.modifier(); });
 	}
 
+	/// Asserts that a \a provider view does not block a modifier.
+	template<typename TProvider>
+	void AssertModifierIsNotBlockedByView(TProvider&& provider) {
+		// Assert:
+		AssertNonExclusiveLocks(
+			[&provider]() { return provider.view(); },
+			[&provider]() { return provider.modifier(); });
+	}
+
+	/// Asserts that a \a provider modifier does not block a view.
+	template<typename TProvider>
+	void AssertViewIsNotBlockedByModifier(TProvider&& provider) {
+		// Assert:
+		AssertNonExclusiveLocks(
+			[&provider]() { return provider.modifier(); },
+			[&provider]() { return provider.view(); });
+	}
+
 /// Adds all view/modifier lock provider tests to the specified test class (\a TEST_CLASS).
 #define DEFINE_LOCK_PROVIDER_TESTS(TEST_CLASS) \
 	TEST(TEST_CLASS, MultipleViewsCanBeAcquired) { test::AssertMultipleViewsCanBeAcquired(*CreateLockProvider()); } \
@@ -258,5 +295,13 @@ namespace catapult { namespace test {
 	TEST(TEST_CLASS, ViewIsBlockedByModifier) { test::AssertViewIsBlockedByModifier(*CreateLockProvider()); } \
 	TEST(TEST_CLASS, ModifierIsBlockedByModifier) { test::AssertModifierIsBlockedByModifier(*CreateLockProvider()); }
 
+/// Adds all view/modifier versioned snapshot provider tests to the specified test class (\a TEST_CLASS).
+/// \note Views of these providers pin immutable versions, so only modifiers are exclusive.
+#define DEFINE_VERSIONED_SNAPSHOT_PROVIDER_TESTS(TEST_CLASS) \
+	TEST(TEST_CLASS, MultipleViewsCanBeAcquired) { test::AssertMultipleViewsCanBeAcquired(*CreateLockProvider()); } \
+	TEST(TEST_CLASS, ModifierIsNotBlockedByView) { test::AssertModifierIsNotBlockedByView(*CreateLockProvider()); } \
+	TEST(TEST_CLASS, ViewIsNotBlockedByModifier) { test::AssertViewIsNotBlockedByModifier(*CreateLockProvider()); } \
+	TEST(TEST_CLASS, ModifierIsBlockedByModifier) { test::AssertModifierIsBlockedByModifier(*CreateLockProvider()); }
+
 	// endregion
 }}
@@ -0,0 +1,195 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/utils/FlatHashMap.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/StackLogger.h"
+#include "catapult/types.h"
+#include <atomic>
+#include <random>
+#include <unordered_map>
+#include <stdlib.h>
+
+namespace {
+	// track the number of heap bytes in use so that the memory overhead of each map can be reported
+	// (each allocation is prefixed with a header containing its size)
+	constexpr size_t Header_Size = alignof(std::max_align_t);
+	std::atomic<size_t> g_numAllocatedBytes(0);
+
+	void* Allocate(size_t size) {
+		auto* pBuffer = static_cast<uint8_t*>(malloc(size + Header_Size));
+		if (!pBuffer)
+			throw std::bad_alloc();
+
+		*reinterpret_cast<size_t*>(pBuffer) = size;
+		g_numAllocatedBytes += size;
+		return pBuffer + Header_Size;
+	}
+
+	void Free(void* pData) {
+		if (!pData)
+			return;
+
+		auto* pBuffer = static_cast<uint8_t*>(pData) - Header_Size;
+		g_numAllocatedBytes -= *reinterpret_cast<size_t*>(pBuffer);
+		free(pBuffer);
+	}
+}
+
+void* operator new(size_t size) {
+	return Allocate(size);
+}
+
+void* operator new[](size_t size) {
+	return Allocate(size);
+}
+
+void operator delete(void* pData) noexcept {
+	Free(pData);
+}
+
+void operator delete[](void* pData) noexcept {
+	Free(pData);
+}
+
+void operator delete(void* pData, size_t) noexcept {
+	Free(pData);
+}
+
+void operator delete[](void* pData, size_t) noexcept {
+	Free(pData);
+}
+
+namespace catapult { namespace tools { namespace mapbenchmark {
+
+	namespace {
+		// value with roughly the size of a small account state
+		using ValueType = std::array<uint8_t, 96>;
+
+		using StlMap = std::unordered_map<Address, ValueType, utils::ArrayHasher<Address>>;
+		using FlatMap = utils::FlatHashMap<Address, ValueType, utils::ArrayHasher<Address>>;
+
+		class MapBenchmarkTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Map Benchmark Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("num elements,n",
+						OptionsValue<uint32_t>(m_numElements)->default_value(10'000'000),
+						"the number of elements inserted into each map");
+				optionsBuilder("num lookups,l",
+						OptionsValue<uint32_t>(m_numLookups)->default_value(10'000'000),
+						"the number of lookups performed against each map");
+			}
+
+			int run(const Options&) override {
+				CATAPULT_LOG(info) << "num elements (" << m_numElements << "), num lookups (" << m_numLookups << ")";
+
+				auto keys = GenerateRandomAddresses(m_numElements);
+				auto lookupKeys = GenerateLookupAddresses(keys, m_numLookups);
+
+				auto stlNumFound = Benchmark<StlMap>("std::unordered_map", keys, lookupKeys);
+				auto flatNumFound = Benchmark<FlatMap>("utils::FlatHashMap", keys, lookupKeys);
+
+				if (stlNumFound != flatNumFound) {
+					CATAPULT_LOG(error) << "maps found different numbers of elements!";
+					return -1;
+				}
+
+				return 0;
+			}
+
+		private:
+			template<typename TMap>
+			static size_t Benchmark(const std::string& mapName, const std::vector<Address>& keys, const std::vector<Address>& lookupKeys) {
+				auto numBytesBefore = g_numAllocatedBytes.load();
+				size_t numFound = 0;
+				{
+					TMap map;
+					Run(mapName + " insert", keys.size(), [&keys, &map]() {
+						for (const auto& key : keys)
+							map.emplace(key, ValueType());
+					});
+
+					auto numBytes = g_numAllocatedBytes.load() - numBytesBefore;
+					CATAPULT_LOG(info)
+							<< mapName << " memory: " << numBytes << " bytes ("
+							<< (keys.empty() ? 0 : numBytes / keys.size()) << " bytes per element)";
+
+					Run(mapName + " find", lookupKeys.size(), [&lookupKeys, &map, &numFound]() {
+						for (const auto& key : lookupKeys)
+							numFound += map.cend() == map.find(key) ? 0 : 1;
+					});
+
+					Run(mapName + " erase", keys.size() / 2, [&keys, &map]() {
+						for (auto i = 0u; i < keys.size() / 2; ++i)
+							map.erase(keys[i]);
+					});
+				}
+
+				CATAPULT_LOG(info) << mapName << " found " << numFound << " elements";
+				return numFound;
+			}
+
+			std::vector<Address> GenerateRandomAddresses(size_t count) {
+				std::vector<Address> addresses(count);
+				for (auto& address : addresses)
+					std::generate_n(address.begin(), address.size(), [this]() { return static_cast<uint8_t>(m_generator()); });
+
+				return addresses;
+			}
+
+			std::vector<Address> GenerateLookupAddresses(const std::vector<Address>& existingAddresses, size_t count) {
+				// half of the lookups are for existing keys and half of the lookups are for unknown keys
+				auto addresses = GenerateRandomAddresses(count);
+				for (auto i = 0u; i < count / 2 && !existingAddresses.empty(); ++i)
+					addresses[i] = existingAddresses[m_generator() % existingAddresses.size()];
+
+				std::shuffle(addresses.begin(), addresses.end(), m_generator);
+				return addresses;
+			}
+
+			template<typename TAction>
+			static void Run(const std::string& testName, size_t numOperations, TAction action) {
+				utils::StackLogger stopwatch(testName.c_str(), utils::LogLevel::Info);
+				action();
+
+				auto elapsedMillis = stopwatch.millis();
+				auto opsPerSecond = 0 == elapsedMillis ? 0 : numOperations * 1000u / elapsedMillis;
+				CATAPULT_LOG(info)
+						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
+						<< "(elapsed time " << elapsedMillis << "ms)";
+			}
+
+		private:
+			uint32_t m_numElements;
+			uint32_t m_numLookups;
+			std::mt19937_64 m_generator;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::mapbenchmark::MapBenchmarkTool mapBenchmarkTool;
+	return catapult::tools::ToolMain(argc, argv, mapBenchmarkTool);
+}
@@ -0,0 +1,182 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/utils/StackLogger.h"
+#include <random>
+
+namespace catapult { namespace tools { namespace treebenchmark {
+
+	namespace {
+		struct PassThroughEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using BenchmarkTree = tree::PatriciaTree<PassThroughEncoder, tree::MemoryDataSource>;
+		using HashPairs = std::vector<std::pair<Hash256, Hash256>>;
+
+		class TreeBenchmarkTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Tree Benchmark Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("num elements,n",
+						OptionsValue<uint32_t>(m_numElements)->default_value(100'000),
+						"the number of elements initially in the tree");
+				optionsBuilder("batch size,b",
+						OptionsValue<uint32_t>(m_batchSize)->default_value(10'000),
+						"the number of elements updated in each batch");
+				optionsBuilder("num batches,r",
+						OptionsValue<uint32_t>(m_numBatches)->default_value(10),
+						"the number of batches");
+			}
+
+			int run(const Options&) override {
+				CATAPULT_LOG(info)
+						<< "num elements (" << m_numElements
+						<< "), batch size (" << m_batchSize
+						<< "), num batches (" << m_numBatches << ")";
+
+				auto initialPairs = GenerateRandomPairs(m_numElements);
+				std::vector<HashPairs> batches;
+				for (auto i = 0u; i < m_numBatches; ++i)
+					batches.push_back(GenerateUpdatePairs(initialPairs, m_batchSize));
+
+				tree::MemoryDataSource singleDataSource;
+				BenchmarkTree singleTree(singleDataSource);
+				tree::MemoryDataSource batchDataSource;
+				BenchmarkTree batchTree(batchDataSource);
+
+				Run("Initial Set (single)", initialPairs.size(), [&initialPairs, &singleTree]() {
+					for (const auto& pair : initialPairs)
+						singleTree.set(pair.first, pair.second);
+				});
+
+				Run("Initial Set (batch)", initialPairs.size(), [&initialPairs, &batchTree]() {
+					batchTree.setBatch(initialPairs);
+				});
+
+				Run("Update Set (single)", m_numBatches * m_batchSize, [&batches, &singleTree]() {
+					for (const auto& batch : batches) {
+						for (const auto& pair : batch)
+							singleTree.set(pair.first, pair.second);
+					}
+				});
+
+				Run("Update Set (batch)", m_numBatches * m_batchSize, [&batches, &batchTree]() {
+					for (const auto& batch : batches)
+						batchTree.setBatch(batch);
+				});
+
+				auto removedKeys = GetKeys(initialPairs, m_batchSize);
+				Run("Unset (single)", removedKeys.size(), [&removedKeys, &singleTree]() {
+					for (const auto& key : removedKeys)
+						singleTree.unset(key);
+				});
+
+				Run("Unset (batch)", removedKeys.size(), [&removedKeys, &batchTree]() {
+					batchTree.unsetBatch(removedKeys);
+				});
+
+				CATAPULT_LOG(info)
+						<< "num nodes: single (" << singleDataSource.size() << "), batch (" << batchDataSource.size() << ")";
+
+				if (singleTree.root() != batchTree.root()) {
+					CATAPULT_LOG(error) << "single and batch trees have different roots!";
+					return -1;
+				}
+
+				return 0;
+			}
+
+		private:
+			HashPairs GenerateRandomPairs(size_t count) {
+				HashPairs pairs(count);
+				for (auto& pair : pairs) {
+					pair.first = GenerateRandomHash();
+					pair.second = GenerateRandomHash();
+				}
+
+				return pairs;
+			}
+
+			HashPairs GenerateUpdatePairs(const HashPairs& existingPairs, size_t count) {
+				// half of the pairs update existing keys and half of the pairs add new keys
+				auto pairs = GenerateRandomPairs(count);
+				for (auto i = 0u; i < count / 2 && !existingPairs.empty(); ++i)
+					pairs[i].first = existingPairs[m_generator() % existingPairs.size()].first;
+
+				return pairs;
+			}
+
+			static std::vector<Hash256> GetKeys(const HashPairs& pairs, size_t count) {
+				std::vector<Hash256> keys;
+				for (auto i = 0u; i < count && i < pairs.size(); ++i)
+					keys.push_back(pairs[i].first);
+
+				return keys;
+			}
+
+			Hash256 GenerateRandomHash() {
+				Hash256 hash;
+				std::generate_n(hash.begin(), hash.size(), [this]() { return static_cast<uint8_t>(m_generator()); });
+				return hash;
+			}
+
+			template<typename TAction>
+			static void Run(const char* testName, size_t numOperations, TAction action) {
+				utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
+				action();
+
+				auto elapsedMillis = stopwatch.millis();
+				auto opsPerSecond = 0 == elapsedMillis ? 0 : numOperations * 1000u / elapsedMillis;
+				CATAPULT_LOG(info)
+						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
+						<< "(elapsed time " << elapsedMillis << "ms)";
+			}
+
+		private:
+			uint32_t m_numElements;
+			uint32_t m_batchSize;
+			uint32_t m_numBatches;
+			std::mt19937_64 m_generator;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::treebenchmark::TreeBenchmarkTool treeBenchmarkTool;
+	return catapult::tools::ToolMain(argc, argv, treeBenchmarkTool);
+}
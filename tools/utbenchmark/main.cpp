@@ -0,0 +1,348 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/utils/BoundedMpmcQueue.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include "catapult/utils/StackLogger.h"
+#include <boost/thread.hpp>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <thread>
+
+namespace catapult { namespace tools { namespace utbenchmark {
+
+	namespace {
+		struct BenchmarkResult {
+			uint64_t TotalFees = 0;
+			uint64_t NumHarvestedTransactions = 0;
+			uint64_t NumEvictedTransactions = 0;
+			uint64_t NumDroppedTransactions = 0;
+			uint64_t TotalSelectionMicros = 0;
+		};
+
+		uint64_t GetElapsedMicros(std::chrono::steady_clock::time_point start) {
+			auto elapsed = std::chrono::steady_clock::now() - start;
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+		}
+
+		// mirrors the spin lock protected container that was previously used for queueing incoming ranges
+		class SpinLockedQueue {
+		public:
+			bool tryPush(uint64_t&& value) {
+				utils::SpinLockGuard guard(m_lock);
+				m_values.push_back(value);
+				return true;
+			}
+
+			bool tryPop(uint64_t& value) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_values.empty())
+					return false;
+
+				value = m_values.front();
+				m_values.pop_front();
+				return true;
+			}
+
+		private:
+			std::deque<uint64_t> m_values;
+			utils::SpinLock m_lock;
+		};
+
+		class UtBenchmarkTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Unconfirmed Transactions Benchmark Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("cache size,c",
+						OptionsValue<uint32_t>(m_cacheSize)->default_value(100'000),
+						"the maximum number of transactions in the unconfirmed transactions cache");
+				optionsBuilder("num blocks,b",
+						OptionsValue<uint32_t>(m_numBlocks)->default_value(100),
+						"the number of harvested blocks");
+				optionsBuilder("block size,s",
+						OptionsValue<uint32_t>(m_blockSize)->default_value(5'000),
+						"the maximum number of transactions in each block");
+				optionsBuilder("num incoming,i",
+						OptionsValue<uint32_t>(m_numIncoming)->default_value(20'000),
+						"the number of transactions received between blocks");
+				optionsBuilder("num signers,a",
+						OptionsValue<uint32_t>(m_numSigners)->default_value(10'000),
+						"the number of distinct transaction signers");
+				optionsBuilder("num producers,p",
+						OptionsValue<uint32_t>(m_numProducers)->default_value(16),
+						"the number of producer threads used by the contention benchmarks");
+				optionsBuilder("num items per producer,n",
+						OptionsValue<uint32_t>(m_numItemsPerProducer)->default_value(100'000),
+						"the number of items queued by each producer in the contention benchmarks");
+			}
+
+			int run(const Options&) override {
+				CATAPULT_LOG(info)
+						<< "cache size (" << m_cacheSize
+						<< "), num blocks (" << m_numBlocks
+						<< "), block size (" << m_blockSize
+						<< "), num incoming (" << m_numIncoming
+						<< "), num signers (" << m_numSigners << ")";
+
+				// both caches receive the same stream of transactions because the generator is reseeded by each benchmark
+				auto fifoResult = Benchmark("fifo", false);
+				auto feeResult = Benchmark("fee prioritized", true);
+
+				if (0 != fifoResult.TotalFees) {
+					CATAPULT_LOG(info)
+							<< "fee prioritized cache collected " << (feeResult.TotalFees * 100 / fifoResult.TotalFees)
+							<< "% of the fees collected by fifo cache";
+				}
+
+				CATAPULT_LOG(info)
+						<< "contention benchmarks with " << m_numProducers << " producers queueing "
+						<< m_numItemsPerProducer << " items each";
+
+				SpinLockedQueue spinLockedQueue;
+				benchmarkQueue("spin locked queue", spinLockedQueue);
+
+				utils::BoundedMpmcQueue<uint64_t> lockFreeQueue(16 * 1024);
+				benchmarkQueue("lock-free queue", lockFreeQueue);
+
+				benchmarkReaders();
+				return 0;
+			}
+
+		private:
+			BenchmarkResult Benchmark(const std::string& cacheName, bool shouldPrioritizeByFee) {
+				m_generator.seed(0);
+				auto signers = generateRandomSigners();
+
+				BenchmarkResult result;
+				cache::MemoryUtCache cache(cache::MemoryCacheOptions(1'000'000, m_cacheSize, shouldPrioritizeByFee));
+				{
+					utils::StackLogger stopwatch((cacheName + " benchmark").c_str(), utils::LogLevel::Info);
+					for (auto i = 0u; i < m_numBlocks; ++i) {
+						addIncomingTransactions(cache, signers, result);
+						harvestBlock(cache, result);
+					}
+				}
+
+				auto numBlocks = std::max<uint64_t>(1, m_numBlocks);
+				CATAPULT_LOG(info)
+						<< cacheName << ": fees per block " << result.TotalFees / numBlocks
+						<< ", transactions per block " << result.NumHarvestedTransactions / numBlocks
+						<< ", selection time per block " << result.TotalSelectionMicros / numBlocks << "us"
+						<< ", evicted " << result.NumEvictedTransactions
+						<< ", dropped " << result.NumDroppedTransactions;
+				return result;
+			}
+
+			template<typename TQueue>
+			void benchmarkQueue(const std::string& queueName, TQueue& queue) {
+				// producers push concurrently while a single consumer drains the queue, like the batch dispatcher task
+				auto numTotalItems = static_cast<uint64_t>(m_numProducers) * m_numItemsPerProducer;
+				std::atomic<uint64_t> numFailedPushes(0);
+				uint64_t numPopped = 0;
+
+				auto start = std::chrono::steady_clock::now();
+				boost::thread_group threads;
+				for (auto i = 0u; i < m_numProducers; ++i) {
+					threads.create_thread([&queue, &numFailedPushes, numItems = m_numItemsPerProducer] {
+						for (auto j = 0u; j < numItems; ++j) {
+							uint64_t value = j;
+							while (!queue.tryPush(std::move(value))) {
+								++numFailedPushes;
+								std::this_thread::yield();
+							}
+						}
+					});
+				}
+
+				threads.create_thread([&queue, &numPopped, numTotalItems] {
+					uint64_t value;
+					while (numPopped < numTotalItems) {
+						if (queue.tryPop(value))
+							++numPopped;
+					}
+				});
+
+				threads.join_all();
+				auto elapsedMicros = std::max<uint64_t>(1, GetElapsedMicros(start));
+
+				CATAPULT_LOG(info)
+						<< queueName << ": " << numPopped << " items in " << elapsedMicros << "us ("
+						<< (numPopped * 1'000'000 / elapsedMicros) << " items/s), "
+						<< numFailedPushes << " pushes retried because the queue was full";
+			}
+
+			void benchmarkReaders() {
+				// a single writer continuously modifies the cache (like the ut updater) while the producer threads act as readers
+				// (like the unconfirmed transactions pull handler)
+				m_generator.seed(0);
+				auto signers = generateRandomSigners();
+				cache::MemoryUtCache cache(cache::MemoryCacheOptions(1'000'000, m_cacheSize));
+				std::vector<model::TransactionInfo> transactionInfos;
+				for (auto i = 0u; i < m_cacheSize; ++i)
+					transactionInfos.push_back(generateRandomTransactionInfo(signers));
+
+				benchmarkReaders("view", cache, transactionInfos, [](const auto& utCache) {
+					return utCache.view().shortHashes().size();
+				});
+				benchmarkReaders("snapshot", cache, transactionInfos, [](const auto& utCache) {
+					return utCache.snapshot()->shortHashes().size();
+				});
+			}
+
+			template<typename TRead>
+			void benchmarkReaders(
+					const std::string& readerName,
+					cache::MemoryUtCache& cache,
+					const std::vector<model::TransactionInfo>& transactionInfos,
+					TRead read) {
+				cache.modifier().removeAll();
+
+				std::atomic<bool> isWriterDone(false);
+				std::atomic<uint64_t> numReads(0);
+				std::atomic<uint64_t> maxReadMicros(0);
+				uint64_t numWrites = 0;
+
+				auto start = std::chrono::steady_clock::now();
+				boost::thread_group threads;
+				threads.create_thread([&cache, &transactionInfos, &isWriterDone, &numWrites] {
+					// add transactions in batches, mirroring ut updater updates with new transactions
+					constexpr auto Batch_Size = 100u;
+					for (auto i = 0u; i < transactionInfos.size(); i += Batch_Size) {
+						auto modifier = cache.modifier();
+						for (auto j = i; j < std::min<size_t>(i + Batch_Size, transactionInfos.size()); ++j)
+							modifier.add(transactionInfos[j]);
+
+						++numWrites;
+					}
+
+					isWriterDone = true;
+				});
+
+				for (auto i = 0u; i < m_numProducers; ++i) {
+					threads.create_thread([&cache, &isWriterDone, &numReads, &maxReadMicros, read] {
+						while (!isWriterDone) {
+							auto readStart = std::chrono::steady_clock::now();
+							read(cache);
+							auto readMicros = GetElapsedMicros(readStart);
+
+							++numReads;
+							auto currentMaxReadMicros = maxReadMicros.load();
+							while (readMicros > currentMaxReadMicros && !maxReadMicros.compare_exchange_weak(currentMaxReadMicros, readMicros))
+							{}
+						}
+					});
+				}
+
+				threads.join_all();
+				auto elapsedMicros = GetElapsedMicros(start);
+
+				CATAPULT_LOG(info)
+						<< readerName << " readers: " << numWrites << " writes in " << elapsedMicros << "us, "
+						<< numReads << " reads, max read latency " << maxReadMicros << "us";
+			}
+
+			void addIncomingTransactions(cache::MemoryUtCache& cache, const std::vector<Key>& signers, BenchmarkResult& result) {
+				auto modifier = cache.modifier();
+				for (auto i = 0u; i < m_numIncoming; ++i) {
+					auto transactionInfo = generateRandomTransactionInfo(signers);
+					if (modifier.add(transactionInfo))
+						continue;
+
+					// mirror UtUpdater, which only accepts a transaction into a full cache after evicting a lower priority one
+					if (modifier.evict(transactionInfo, []() { return true; }) && modifier.add(transactionInfo))
+						++result.NumEvictedTransactions;
+					else
+						++result.NumDroppedTransactions;
+				}
+			}
+
+			void harvestBlock(cache::MemoryUtCache& cache, BenchmarkResult& result) {
+				std::vector<Hash256> hashes;
+				{
+					auto view = cache.view();
+					auto start = std::chrono::steady_clock::now();
+					auto transactionInfos = view.prioritizedTransactionInfos(m_blockSize);
+					auto elapsed = std::chrono::steady_clock::now() - start;
+					result.TotalSelectionMicros += static_cast<uint64_t>(
+							std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+					for (const auto* pTransactionInfo : transactionInfos) {
+						result.TotalFees += pTransactionInfo->pEntity->Fee.unwrap();
+						hashes.push_back(pTransactionInfo->EntityHash);
+					}
+				}
+
+				result.NumHarvestedTransactions += hashes.size();
+
+				auto modifier = cache.modifier();
+				for (const auto& hash : hashes)
+					modifier.remove(hash);
+			}
+
+			std::vector<Key> generateRandomSigners() {
+				std::vector<Key> signers(std::max<uint32_t>(1, m_numSigners));
+				for (auto& signer : signers)
+					std::generate_n(signer.begin(), signer.size(), [this]() { return static_cast<uint8_t>(m_generator()); });
+
+				return signers;
+			}
+
+			model::TransactionInfo generateRandomTransactionInfo(const std::vector<Key>& signers) {
+				// sizes are uniformly distributed and fees per byte are heavily skewed (most transactions pay close to the minimum)
+				auto size = static_cast<uint32_t>(std::uniform_int_distribution<uint32_t>(150, 1000)(m_generator));
+				auto feePerByte = static_cast<uint64_t>(std::lognormal_distribution<double>(0, 1.5)(m_generator) * 10);
+
+				auto pTransaction = utils::MakeUniqueWithSize<model::Transaction>(size);
+				std::memset(static_cast<void*>(pTransaction.get()), 0, size);
+				pTransaction->Size = size;
+				pTransaction->Signer = signers[m_generator() % signers.size()];
+				pTransaction->Fee = Amount(feePerByte * size);
+				pTransaction->Deadline = Timestamp(m_generator());
+
+				Hash256 hash;
+				std::generate_n(hash.begin(), hash.size(), [this]() { return static_cast<uint8_t>(m_generator()); });
+				return model::TransactionInfo(std::move(pTransaction), hash);
+			}
+
+		private:
+			uint32_t m_cacheSize;
+			uint32_t m_numBlocks;
+			uint32_t m_blockSize;
+			uint32_t m_numIncoming;
+			uint32_t m_numSigners;
+			uint32_t m_numProducers;
+			uint32_t m_numItemsPerProducer;
+			std::mt19937_64 m_generator;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::utbenchmark::UtBenchmarkTool utBenchmarkTool;
+	return catapult::tools::ToolMain(argc, argv, utBenchmarkTool);
+}